@@ -0,0 +1,107 @@
+#ifndef VITA_ALGORITHM_ASCII_H
+#define VITA_ALGORITHM_ASCII_H
+
+/** ASCII MODULE
+ * Byte kernels for ASCII text: case mapping, spans, removal and replacement of character sets. They work on
+ * raw buffers (not required to be zero-terminated) 16 bytes at a time with SSE2, or 32 with AVX2 if the CPU
+ * supports it. Bytes outside of ASCII are left as is.
+
+ * Functions
+    - vt_ascii_to_upper
+    - vt_ascii_to_lower
+    - vt_ascii_set_init
+    - vt_ascii_set_space
+    - vt_ascii_set_space_punct
+    - vt_ascii_set_has
+    - vt_ascii_span
+    - vt_ascii_span_last
+    - vt_ascii_remove
+    - vt_ascii_replace
+*/
+
+#include "vita/core/core.h"
+#include "vita/util/debug.h"
+
+// character classes of the "C" locale, see isspace and ispunct
+#define VT_ASCII_SPACE " \t\n\v\f\r"
+#define VT_ASCII_PUNCT "!\"#$%&'()*+,-./:;<=>?@[\\]^_`{|}~"
+
+// sets made of up to this many ranges of consecutive bytes are checked with SIMD
+#define VT_ASCII_SET_MAX_RANGES 8
+
+// set of bytes
+typedef struct VitaAsciiSet {
+    uint64_t bits[4];                           // one bit per byte value
+    uint8_t lo[VT_ASCII_SET_MAX_RANGES];        // first byte of each range
+    uint8_t width[VT_ASCII_SET_MAX_RANGES];     // last byte minus first byte of each range
+    size_t count_ranges;                        // number of ranges, the set is checked bytewise if above the maximum
+} vt_ascii_set_t;
+
+/** Converts lowercase ASCII letters to uppercase
+    @param z data
+    @param len data length
+*/
+extern void vt_ascii_to_upper(char *const z, const size_t len);
+
+/** Converts uppercase ASCII letters to lowercase
+    @param z data
+    @param len data length
+*/
+extern void vt_ascii_to_lower(char *const z, const size_t len);
+
+/** Creates a set from the characters of a string
+    @param set vt_ascii_set_t instance
+    @param chars zero-terminated string of set members, order and duplicates do not matter
+*/
+extern void vt_ascii_set_init(vt_ascii_set_t *const set, const char *const chars);
+
+/** Returns the set of whitespace and control symbols matched by isspace, same as initialized with VT_ASCII_SPACE
+    @returns `vt_ascii_set_t*`
+*/
+extern const vt_ascii_set_t *vt_ascii_set_space(void);
+
+/** Returns the set of whitespace, control symbols and punctuation marks, same as initialized with VT_ASCII_SPACE VT_ASCII_PUNCT
+    @returns `vt_ascii_set_t*`
+*/
+extern const vt_ascii_set_t *vt_ascii_set_space_punct(void);
+
+/** Checks if a character belongs to a set
+    @param set vt_ascii_set_t instance
+    @param c character
+    @returns `true` if it does
+*/
+extern bool vt_ascii_set_has(const vt_ascii_set_t *const set, const char c);
+
+/** Counts leading characters that belong to a set
+    @param z data
+    @param len data length
+    @param set vt_ascii_set_t instance
+    @returns number of characters
+*/
+extern size_t vt_ascii_span(const char *const z, const size_t len, const vt_ascii_set_t *const set);
+
+/** Counts trailing characters that belong to a set
+    @param z data
+    @param len data length
+    @param set vt_ascii_set_t instance
+    @returns number of characters
+*/
+extern size_t vt_ascii_span_last(const char *const z, const size_t len, const vt_ascii_set_t *const set);
+
+/** Removes all characters that belong to a set, keeping the order of the rest
+    @param z data
+    @param len data length
+    @param set vt_ascii_set_t instance
+    @returns new length
+*/
+extern size_t vt_ascii_remove(char *const z, const size_t len, const vt_ascii_set_t *const set);
+
+/** Replaces all characters that belong to a set using a lookup table
+    @param z data
+    @param len data length
+    @param set vt_ascii_set_t instance
+    @param map replacement for each byte value, 256 chars; only set members are looked up
+*/
+extern void vt_ascii_replace(char *const z, const size_t len, const vt_ascii_set_t *const set, const char *const map);
+
+#endif // VITA_ALGORITHM_ASCII_H
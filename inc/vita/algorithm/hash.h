@@ -0,0 +1,110 @@
+#ifndef VITA_ALGORITHM_HASH_H
+#define VITA_ALGORITHM_HASH_H
+
+/** HASH MODULE
+ * Fast non-cryptographic 64-bit hashes for hashed containers. Buffers and strings are hashed with XXH64
+ * (same values as the reference implementation), either at once or incrementally, chunk by chunk. Integers
+ * have their own, cheaper mixing functions. All hashes are seeded. Do not use them where an attacker
+ * controls the keys and a collision can hurt, these are not cryptographic.
+
+ * Functions
+    - vt_hash
+    - vt_hash_z
+    - vt_hash_str
+    - vt_hash_u32
+    - vt_hash_u64
+    - vt_hash_init
+    - vt_hash_update
+    - vt_hash_digest
+
+ * Usage
+    const uint64_t h = vt_hash("hello", 5, VT_HASH_DEFAULT_SEED);
+
+    // incremental: the same value as if all chunks were hashed at once
+    vt_hash_state_t state;
+    vt_hash_init(&state, VT_HASH_DEFAULT_SEED);
+    while ((n = fread(buf, 1, sizeof(buf), fp)) > 0) {
+        vt_hash_update(&state, buf, n);
+    }
+    const uint64_t hf = vt_hash_digest(&state);
+*/
+
+#include "vita/core/core.h"
+#include "vita/util/debug.h"
+#include "vita/container/str.h"
+
+// constants
+#define VT_HASH_DEFAULT_SEED 0
+#define VT_HASH_STRIPE_SIZE 32
+
+// incremental hashing state
+typedef struct VitaHashState {
+    uint64_t acc[4];                        // stripe accumulators
+    uint8_t buf[VT_HASH_STRIPE_SIZE];       // bytes that do not make up a whole stripe yet
+    size_t buf_len;                         // number of bytes in buf
+    uint64_t total_len;                     // number of bytes hashed
+    uint64_t seed;                          // seed
+} vt_hash_state_t;
+
+/** Hashes a buffer (XXH64)
+    @param data data
+    @param len data length
+    @param seed seed
+    @returns 64-bit hash
+*/
+extern uint64_t vt_hash(const void *const data, const size_t len, const uint64_t seed);
+
+/** Hashes a zero-terminated string
+    @param z zero-terminated string
+    @param seed seed
+    @returns 64-bit hash, same as of vt_hash(z, strlen(z), seed)
+*/
+extern uint64_t vt_hash_z(const char *const z, const uint64_t seed);
+
+/** Hashes a vt_str_t
+    @param s vt_str_t instance
+    @param seed seed
+    @returns 64-bit hash, same as of vt_hash over its characters
+*/
+extern uint64_t vt_hash_str(const vt_str_t *const s, const uint64_t seed);
+
+/** Hashes a 32-bit integer
+    @param v value
+    @param seed seed
+    @returns 64-bit hash
+
+    @note not the same as hashing the value as a buffer
+*/
+extern uint64_t vt_hash_u32(const uint32_t v, const uint64_t seed);
+
+/** Hashes a 64-bit integer
+    @param v value
+    @param seed seed
+    @returns 64-bit hash
+
+    @note not the same as hashing the value as a buffer
+*/
+extern uint64_t vt_hash_u64(const uint64_t v, const uint64_t seed);
+
+/** Starts incremental hashing
+    @param state vt_hash_state_t instance
+    @param seed seed
+*/
+extern void vt_hash_init(vt_hash_state_t *const state, const uint64_t seed);
+
+/** Hashes the next chunk
+    @param state vt_hash_state_t instance
+    @param data chunk
+    @param len chunk length
+*/
+extern void vt_hash_update(vt_hash_state_t *const state, const void *const data, const size_t len);
+
+/** Returns the hash of all chunks so far
+    @param state vt_hash_state_t instance
+    @returns 64-bit hash, same as of vt_hash over the chunks concatenated
+
+    @note the state is not changed, more chunks can be added
+*/
+extern uint64_t vt_hash_digest(const vt_hash_state_t *const state);
+
+#endif // VITA_ALGORITHM_HASH_H
@@ -0,0 +1,145 @@
+#ifndef VITA_ALGORITHM_MATCHER_H
+#define VITA_ALGORITHM_MATCHER_H
+
+/** MATCHER MODULE (multi-pattern search)
+ * Aho-Corasick: a set of needles is compiled once into an automaton that finds all of them in a single pass
+ * over the text, however many there are. Transitions are a full table over byte classes (bytes that occur in
+ * the needles get a class each, all other bytes share one), so the scan is one table lookup per byte.
+ * Text can be fed in chunks: the automaton state carries over, so matches spanning chunk borders are found.
+
+ * Functions
+    - vt_matcher_create
+    - vt_matcher_destroy
+    - vt_matcher_count_patterns
+    - vt_matcher_reset
+    - vt_matcher_feed
+    - vt_matcher_find_all
+    - vt_matcher_find_all_str
+    - vt_matcher_find_first
+
+ * Usage
+    vt_plist_t *keywords = vt_plist_create(3, NULL);
+    vt_plist_push_back(keywords, "error");
+    vt_plist_push_back(keywords, "timeout");
+    vt_plist_push_back(keywords, "denied");
+    vt_matcher_t *m = vt_matcher_create(keywords, NULL);
+
+    // stream a file in chunks
+    char buf[4096];
+    size_t n = 0;
+    vt_vec_t *matches = vt_vec_create(VT_ARRAY_DEFAULT_INIT_ELEMENTS, sizeof(vt_matcher_match_t), NULL);
+    while ((n = fread(buf, 1, sizeof(buf), fp)) > 0) {
+        vt_matcher_feed(m, matches, buf, n);
+    }
+
+    vt_vec_destroy(matches);
+    vt_matcher_destroy(m);
+    vt_plist_destroy(keywords);
+*/
+
+#include "vita/container/common.h"
+#include "vita/container/vec.h"
+#include "vita/container/plist.h"
+#include "vita/container/str.h"
+
+// no needle
+#define VT_MATCHER_NONE UINT32_MAX
+
+// a match: which needle and where it starts
+typedef struct VitaMatcherMatch {
+    size_t id;          // needle index in the list the matcher was created from
+    size_t offset;      // start of the match in the text (or the stream, see vt_matcher_feed)
+} vt_matcher_match_t;
+
+// compiled automaton
+typedef struct VitaMatcher {
+    struct VitaBaseAllocatorType *alloctr;  // allocator, `NULL` for the default one
+    uint8_t classes[256];                   // byte class, 0 for bytes not found in the needles
+    size_t count_classes;                   // number of classes, including 0
+    size_t count_states;                    // number of states, the root is 0
+    size_t count_patterns;                  // number of needles
+    uint32_t *next;                         // transitions: target state multiplied by the number of classes
+    uint32_t output_from;                   // states with output are numbered last, transitions to them are not less than this
+    uint32_t *out;                          // first needle ending in a state
+    uint32_t *out_link;                     // nearest state along the failure chain with output, 0 if none
+    uint32_t *pattern_len;                  // needle lengths
+    uint32_t *pattern_next;                 // next needle ending in the same state
+    uint32_t state;                         // current transition value, for feeding chunks
+    size_t offset;                          // number of bytes fed since the last reset
+} vt_matcher_t;
+
+/** Compiles needles into a matcher
+    @param needles vt_plist_t of zero-terminated strings, empty strings are ignored
+    @param alloctr allocator instance
+    @returns `vt_matcher_t*`
+
+    @note the needles are not referenced after the call
+    @note if `NULL` is specified, then vita calloc/realloc/free is used
+*/
+extern vt_matcher_t *vt_matcher_create(const vt_plist_t *const needles, struct VitaBaseAllocatorType *const alloctr);
+
+/** Destroys the matcher
+    @param m vt_matcher_t instance
+*/
+extern void vt_matcher_destroy(vt_matcher_t *m);
+
+/** Returns the number of needles
+    @param m vt_matcher_t instance
+    @returns size_t
+*/
+extern size_t vt_matcher_count_patterns(const vt_matcher_t *const m);
+
+/** Starts a new stream
+    @param m vt_matcher_t instance
+*/
+extern void vt_matcher_reset(vt_matcher_t *const m);
+
+/** Feeds the next chunk of a stream, matches are appended
+    @param m vt_matcher_t instance
+    @param vm vt_vec_t of vt_matcher_match_t, if `NULL` allocates
+    @param z chunk
+    @param len chunk length
+
+    @returns `vt_vec_t` of `vt_matcher_match_t`
+
+    @note offsets are counted from the start of the stream; matches spanning chunks are found
+    @note all occurrences are reported, overlapping ones too, in the order of their ends
+*/
+extern vt_vec_t *vt_matcher_feed(vt_matcher_t *const m, vt_vec_t *vm, const char *const z, const size_t len);
+
+/** Finds all occurrences of all needles in a buffer
+    @param m vt_matcher_t instance
+    @param vm vt_vec_t of vt_matcher_match_t, if `NULL` allocates; it is cleared
+    @param z data
+    @param len data length
+
+    @returns `vt_vec_t` of `vt_matcher_match_t`
+
+    @note resets the stream
+*/
+extern vt_vec_t *vt_matcher_find_all(vt_matcher_t *const m, vt_vec_t *vm, const char *const z, const size_t len);
+
+/** Finds all occurrences of all needles in a vt_str_t
+    @param m vt_matcher_t instance
+    @param vm vt_vec_t of vt_matcher_match_t, if `NULL` allocates; it is cleared
+    @param s vt_str_t instance
+
+    @returns `vt_vec_t` of `vt_matcher_match_t`
+
+    @note resets the stream
+*/
+extern vt_vec_t *vt_matcher_find_all_str(vt_matcher_t *const m, vt_vec_t *vm, const vt_str_t *const s);
+
+/** Finds the occurrence that ends first, stops there
+    @param m vt_matcher_t instance
+    @param z data
+    @param len data length
+    @param match the occurrence found, if not `NULL`
+
+    @returns `true` if any needle was found
+
+    @note the stream state is not used, nor changed
+*/
+extern bool vt_matcher_find_first(const vt_matcher_t *const m, const char *const z, const size_t len, vt_matcher_match_t *const match);
+
+#endif // VITA_ALGORITHM_MATCHER_H
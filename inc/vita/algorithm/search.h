@@ -2,12 +2,38 @@
 #define VITA_ALGORITHM_SEARCH_H
 
 /** SEARCH MODULE
-    - //
+    - vt_search_substr
+    - vt_search_substr_last
 */
 
-// #include <stdlib.h>
-// #include <stdint.h>
-// #include <stdbool.h>
+#include "vita/core/core.h"
+#include "vita/util/debug.h"
+
+/** Finds the first occurrence of a substring, the data is not required to be zero-terminated
+    @param z haystack
+    @param zLen haystack length
+    @param sub needle
+    @param subLen needle length
+
+    @returns pointer to the first occurrence in `z`, `NULL` if not found
+
+    @note candidates are filtered by two needle bytes with AVX2 (if the CPU supports it) or SSE2; upon too many
+          false candidates the search switches to Two-Way, so it stays linear in the haystack length
+    @note an empty needle is found at the start of the haystack
+*/
+extern const char *vt_search_substr(const char *const z, const size_t zLen, const char *const sub, const size_t subLen);
+
+/** Finds the last occurrence of a substring, the data is not required to be zero-terminated
+    @param z haystack
+    @param zLen haystack length
+    @param sub needle
+    @param subLen needle length
+
+    @returns pointer to the last occurrence in `z`, `NULL` if not found
+
+    @note an empty needle is found at the end of the haystack
+*/
+extern const char *vt_search_substr_last(const char *const z, const size_t zLen, const char *const sub, const size_t subLen);
 
 /** 
 Linear search algorithm
@@ -0,0 +1,127 @@
+#ifndef VITA_ALLOCATOR_ARENA_H
+#define VITA_ALLOCATOR_ARENA_H
+
+/** ARENA MODULE 
+ * This allocator carves memory from large chunks (bump allocation). Freeing individual objects
+ * is a no-op, instead all memory is released at once with `vt_arena_reset` or `vt_arena_destroy`.
+ * It is well suited for request-scoped containers: create everything with the arena, 
+ * then reset it at the end of the request.
+
+ * Functions
+    - vt_arena_create
+    - vt_arena_destroy
+    - vt_arena_reset
+    - vt_arena_alloc
+    - vt_arena_alloc_aligned
+    - vt_arena_realloc
+    - vt_arena_free
+    - vt_arena_capacity
+
+ * Usage
+    vt_arena_t *arena = vt_arena_create(VT_ARENA_DEFAULT_CHUNK_SIZE, NULL);
+    vt_str_t *s = vt_str_create("hello", &arena->base);
+    // ...
+    vt_arena_reset(arena);
+*/
+
+#include "vita/allocator/common.h"
+
+// constants
+#define VT_ARENA_DEFAULT_CHUNK_SIZE (64 * 1024)
+#define VT_ARENA_ALIGNMENT 16
+
+// memory chunk that allocations are carved from (data follows the header)
+struct VitaArenaChunk {
+    struct VitaArenaChunk *next;    // previously filled chunk
+    size_t capacity;                // chunk data size in bytes
+    size_t offset;                  // bytes used
+};
+
+// arena allocator
+typedef struct VitaArenaAllocator {
+    struct VitaBaseAllocatorType base;  // allocator interface, pass `&arena->base` to containers
+
+    struct VitaBaseAllocatorType *alloctr; // allocator for the arena and its chunks, `NULL` for the default one
+    struct VitaArenaChunk *chunk;       // current chunk
+    size_t chunk_size;                  // minimum chunk size
+    void *last_ptr;                     // last allocation, can be resized in place
+} vt_arena_t;
+
+/** Creates an arena allocator
+    @param chunk_size minimum size of memory chunks allocated by the arena
+    @param alloctr allocator instance the chunks are allocated with
+    @returns vt_arena_t*
+
+    @note if `NULL` is specified, then vita malloc/free is used
+*/
+extern vt_arena_t *vt_arena_create(const size_t chunk_size, struct VitaBaseAllocatorType *const alloctr);
+
+/** Frees all chunks and destroys the arena
+    @param arena vt_arena_t instance
+*/
+extern void vt_arena_destroy(vt_arena_t *arena);
+
+/** Releases all allocations at once, the memory is kept for reuse
+    @param arena vt_arena_t instance
+
+    @note if the arena grew beyond one chunk, chunks are merged into a single chunk of the same total capacity
+*/
+extern void vt_arena_reset(vt_arena_t *const arena);
+
+/** Allocates zero-initialized memory from the arena
+    @param alloctr arena allocator instance (`&arena->base`)
+    @param bytes number of bytes to allocate
+    @param file __SOURCE_FILENAME__
+    @param func __func__
+    @param line __LINE__
+
+    @returns pointer to allocated block of memory (aligned to VT_ARENA_ALIGNMENT)
+*/
+extern void *vt_arena_alloc(struct VitaBaseAllocatorType *const alloctr, const size_t bytes, const char *const file, const char *const func, const size_t line);
+
+/** Allocates zero-initialized aligned memory from the arena
+    @param alloctr arena allocator instance (`&arena->base`)
+    @param bytes number of bytes to allocate
+    @param alignment power of 2
+    @param file __SOURCE_FILENAME__
+    @param func __func__
+    @param line __LINE__
+
+    @returns pointer to allocated block of memory
+
+    @note the alignment is kept upon reallocation
+*/
+extern void *vt_arena_alloc_aligned(struct VitaBaseAllocatorType *const alloctr, const size_t bytes, const size_t alignment, const char *const file, const char *const func, const size_t line);
+
+/** Reallocates memory from the arena
+    @param alloctr arena allocator instance (`&arena->base`)
+    @param ptr pointer to the previously allocated block of memory
+    @param bytes number of bytes to allocate
+    @param file __SOURCE_FILENAME__
+    @param func __func__
+    @param line __LINE__
+
+    @returns pointer to reallocated block of memory
+
+    @note the last allocation is resized in place if the current chunk has enough space
+*/
+extern void *vt_arena_realloc(struct VitaBaseAllocatorType *const alloctr, void *ptr, const size_t bytes, const char *const file, const char *const func, const size_t line);
+
+/** Does nothing: memory is released with `vt_arena_reset` or `vt_arena_destroy`
+    @param alloctr arena allocator instance (`&arena->base`)
+    @param ptr pointer to the previously allocated block of memory
+    @param file __SOURCE_FILENAME__
+    @param func __func__
+    @param line __LINE__
+
+    @note only `count_frees` is updated, live objects and bytes are released with `vt_arena_reset`, so a block allocated before the last reset may be freed safely
+*/
+extern void vt_arena_free(struct VitaBaseAllocatorType *const alloctr, void *ptr, const char *const file, const char *const func, const size_t line);
+
+/** Returns total capacity of all arena chunks
+    @param arena vt_arena_t instance
+    @returns capacity in bytes
+*/
+extern size_t vt_arena_capacity(const vt_arena_t *const arena);
+
+#endif // VITA_ALLOCATOR_ARENA_H
@@ -0,0 +1,178 @@
+#ifndef VITA_ALLOCATOR_COMMON_H
+#define VITA_ALLOCATOR_COMMON_H
+
+/** ALLOCATOR COMMON MODULE
+ * This module defines the allocator interface shared by all allocators. 
+ * Every allocator embeds (or is) a `struct VitaBaseAllocatorType` and fills in its function pointers.
+
+ * Macros
+    - VT_ALLOCATOR_ALLOC
+    - VT_ALLOCATOR_REALLOC
+    - VT_ALLOCATOR_FREE
+    - VT_ALLOCATOR_ALLOC_ALIGNED
+    - VT_ALLOCATOR_EXPAND
+
+ * Functions
+    - vt_allocator_alloc_aligned
+    - vt_allocator_expand
+    - vt_allocator_get_stats
+    - vt_allocator_stats_on_alloc
+    - vt_allocator_stats_on_realloc
+    - vt_allocator_stats_on_free
+    - vt_allocator_stats_update_peak
+    - vt_allocator_stats_hist_bin
+*/
+
+#include "vita/core/core.h"
+#include "vita/util/debug.h"
+
+// macros
+#define VT_ALLOCATOR_ALLOC(alloctr, bytes) (alloctr)->alloc(alloctr, bytes, __SOURCE_FILENAME__, __func__, __LINE__)
+#define VT_ALLOCATOR_REALLOC(alloctr, ptr, bytes) (alloctr)->realloc(alloctr, ptr, bytes, __SOURCE_FILENAME__, __func__, __LINE__)
+#define VT_ALLOCATOR_FREE(alloctr, ptr) (alloctr)->free(alloctr, ptr, __SOURCE_FILENAME__, __func__, __LINE__)
+#define VT_ALLOCATOR_ALLOC_ALIGNED(alloctr, bytes, alignment) vt_allocator_alloc_aligned(alloctr, bytes, alignment, __SOURCE_FILENAME__, __func__, __LINE__)
+#define VT_ALLOCATOR_EXPAND(alloctr, ptr, bytes) vt_allocator_expand(alloctr, ptr, bytes, __SOURCE_FILENAME__, __func__, __LINE__)
+
+// same as above, but fall back to vt_calloc/vt_free if `alloctr` is NULL (`alloctr` is evaluated twice)
+#define VT_ALLOCATOR_ALLOC_OR_DEFAULT(alloctr, bytes) ((alloctr) ? VT_ALLOCATOR_ALLOC(alloctr, bytes) : VT_CALLOC(bytes))
+#define VT_ALLOCATOR_FREE_OR_DEFAULT(alloctr, ptr) ((alloctr) ? VT_ALLOCATOR_FREE(alloctr, ptr) : VT_FREE(ptr))
+
+// alignment guaranteed by `alloc` of every allocator
+#define VT_ALLOCATOR_DEFAULT_ALIGNMENT 16
+
+// size classes used by pooling allocators: 16, 32, 64, ..., 4096 bytes
+#define VT_ALLOCATOR_SIZE_CLASS_MIN 16
+#define VT_ALLOCATOR_SIZE_CLASS_MAX 4096
+#define VT_ALLOCATOR_SIZE_CLASS_COUNT 9
+
+// allocation size histogram bins: bin `i` counts sizes in [2^i, 2^(i+1)), the last bin counts everything bigger
+#define VT_ALLOCATOR_HIST_BINS 32
+
+// allocator statistics
+struct VitaAllocatorStats {
+    size_t count_allocs;                    // number of allocations made
+    size_t count_reallocs;                  // number of reallocations made
+    size_t count_frees;                     // number of frees made
+    size_t count_bytes_allocated;           // number of bytes currently allocated
+    size_t count_bytes_freed;               // number of bytes released by frees and shrinking reallocations
+    size_t count_bytes_peak;                // maximum of count_bytes_allocated (high-water mark)
+    size_t count_objects_live;              // number of objects currently allocated
+    size_t count_objects_peak;              // maximum of count_objects_live
+    size_t count_reallocs_grow;             // number of reallocations to a bigger size
+    size_t count_reallocs_shrink;           // number of reallocations to a smaller size
+
+    // log2 histogram of requested sizes (allocations and reallocations)
+    size_t count_size_hist[VT_ALLOCATOR_HIST_BINS];
+
+    // size class statistics (pooling allocators only)
+    size_t count_class_hits[VT_ALLOCATOR_SIZE_CLASS_COUNT];     // allocations served from a free list
+    size_t count_class_misses[VT_ALLOCATOR_SIZE_CLASS_COUNT];   // allocations that required a new block
+};
+
+// allocator cache entry (`ptr == NULL` marks an empty slot)
+struct VitaAllocatedObject {
+    void *ptr;
+    size_t bytes;
+    size_t alignment;                       // requested alignment, 0 if allocated with the default alignment
+    size_t site;                            // call site index in the allocation profile (mallocator profiling only)
+};
+
+// allocation profile (see mallocator.h)
+struct VitaAllocationProfile;
+
+// base allocator type for all allocator-like primitives
+struct VitaBaseAllocatorType {
+    // statistics
+    struct VitaAllocatorStats stats;
+
+    // obj cache list: open-addressing hash table indexed by pointer (capacity is a power of 2)
+    // only used by allocators that track individual objects (mallocator), otherwise NULL
+    struct VitaAllocatedObject *obj_list;
+    size_t obj_list_len;                    // number of tracked objects
+    size_t obj_list_capacity;               // number of slots
+
+    // call site profile (mallocator only), NULL if profiling is disabled
+    struct VitaAllocationProfile *profile;
+
+    // functions
+    void *(*alloc)(struct VitaBaseAllocatorType *const, const size_t, const char *const, const char *const, const size_t);           // custom allocation function
+    void *(*realloc)(struct VitaBaseAllocatorType *const, void*, const size_t, const char *const, const char *const, const size_t);  // custom reallocation function
+    void  (*free)(struct VitaBaseAllocatorType *const, void*, const char *const, const char *const, const size_t);                   // custom free function
+
+    // custom aligned allocation function, optional (NULL if only the default alignment is supported)
+    // blocks are reallocated and freed with `realloc` and `free`, which must preserve the alignment
+    void *(*alloc_aligned)(struct VitaBaseAllocatorType *const, const size_t, const size_t, const char *const, const char *const, const size_t);
+
+    // custom in-place growth function, optional (NULL if blocks can only grow with `realloc`)
+    // returns `false` and leaves the block untouched if it cannot grow without moving
+    bool  (*expand)(struct VitaBaseAllocatorType *const, void*, const size_t, const char *const, const char *const, const size_t);
+};
+
+/** Allocates zero-initialized aligned memory
+    @param alloctr allocator instance
+    @param bytes number of bytes to allocate
+    @param alignment power of 2
+    @param file __SOURCE_FILENAME__
+    @param func __func__
+    @param line __LINE__
+
+    @returns pointer to allocated block of memory
+
+    @note falls back to `alloc` if alignment does not exceed VT_ALLOCATOR_DEFAULT_ALIGNMENT
+    @note enforces that the allocator supports alignments above VT_ALLOCATOR_DEFAULT_ALIGNMENT
+*/
+extern void *vt_allocator_alloc_aligned(struct VitaBaseAllocatorType *const alloctr, const size_t bytes, const size_t alignment, const char *const file, const char *const func, const size_t line);
+
+/** Tries to grow a block without moving it
+    @param alloctr allocator instance
+    @param ptr pointer to the previously allocated block of memory
+    @param bytes new size in bytes
+    @param file __SOURCE_FILENAME__
+    @param func __func__
+    @param line __LINE__
+
+    @returns `true` if the block was resized in place, `false` if it must be reallocated
+
+    @note returns `false` if the allocator does not support in-place growth
+*/
+extern bool vt_allocator_expand(struct VitaBaseAllocatorType *const alloctr, void *const ptr, const size_t bytes, const char *const file, const char *const func, const size_t line);
+
+/** Returns a snapshot of allocator statistics
+    @param alloctr allocator instance
+    @returns VitaAllocatorStats struct
+
+    @note cheap enough to be polled periodically
+*/
+extern struct VitaAllocatorStats vt_allocator_get_stats(const struct VitaBaseAllocatorType *const alloctr);
+
+/** Records an allocation
+    @param stats VitaAllocatorStats instance
+    @param bytes number of bytes allocated
+*/
+extern void vt_allocator_stats_on_alloc(struct VitaAllocatorStats *const stats, const size_t bytes);
+
+/** Records a reallocation
+    @param stats VitaAllocatorStats instance
+    @param bytes_old previous size
+    @param bytes new size
+*/
+extern void vt_allocator_stats_on_realloc(struct VitaAllocatorStats *const stats, const size_t bytes_old, const size_t bytes);
+
+/** Records a free
+    @param stats VitaAllocatorStats instance
+    @param bytes number of bytes freed
+*/
+extern void vt_allocator_stats_on_free(struct VitaAllocatorStats *const stats, const size_t bytes);
+
+/** Updates high-water marks from current values
+    @param stats VitaAllocatorStats instance
+*/
+extern void vt_allocator_stats_update_peak(struct VitaAllocatorStats *const stats);
+
+/** Returns histogram bin of an allocation size
+    @param bytes number of bytes
+    @returns bin index in [0; VT_ALLOCATOR_HIST_BINS)
+*/
+extern size_t vt_allocator_stats_hist_bin(const size_t bytes);
+
+#endif // VITA_ALLOCATOR_COMMON_H
@@ -0,0 +1,117 @@
+#ifndef VITA_ALLOCATOR_HPALLOCATOR_H
+#define VITA_ALLOCATOR_HPALLOCATOR_H
+
+/** HPALLOCATOR MODULE
+ * This allocator maps large blocks directly from the OS and requests transparent huge pages for them
+ * (`madvise(MADV_HUGEPAGE)` where available), so big buffers see fewer TLB misses. Mappings are
+ * aligned to VT_HPALLOCATOR_HUGE_PAGE_SIZE. On Linux, large blocks are resized with `mremap`,
+ * which avoids copying. Blocks below the threshold are allocated from the heap. All blocks are
+ * aligned to VT_HPALLOCATOR_ALIGNMENT, which makes it a good fit for big SIMD vectors.
+
+ * Functions
+    - vt_hpallocator_create
+    - vt_hpallocator_destroy
+    - vt_hpallocator_alloc
+    - vt_hpallocator_alloc_aligned
+    - vt_hpallocator_realloc
+    - vt_hpallocator_expand
+    - vt_hpallocator_free
+
+ * Usage
+    vt_hpallocator_t *hp = vt_hpallocator_create(VT_HPALLOCATOR_DEFAULT_THRESHOLD);
+    vt_vec_t *v = vt_vec_create_aligned(1024, sizeof(float), 64, &hp->base);
+*/
+
+#include "vita/allocator/common.h"
+
+// constants
+#define VT_HPALLOCATOR_HUGE_PAGE_SIZE (2 * 1024 * 1024)
+#define VT_HPALLOCATOR_DEFAULT_THRESHOLD VT_HPALLOCATOR_HUGE_PAGE_SIZE
+#define VT_HPALLOCATOR_ALIGNMENT 64
+
+// block header, data starts VT_HPALLOCATOR_ALIGNMENT bytes after it
+struct VitaHugePageBlock {
+    struct VitaHugePageBlock *next;
+    struct VitaHugePageBlock *prev;
+    size_t bytes;                       // requested size
+    size_t map_len;                     // mapping length, 0 if the block is allocated from the heap
+};
+
+// huge page allocator
+typedef struct VitaHugePageAllocator {
+    struct VitaBaseAllocatorType base;  // allocator interface, pass `&hp->base` to containers
+
+    size_t threshold;                   // blocks of this size and bigger are mapped from the OS
+    struct VitaHugePageBlock *blocks;   // list of all blocks
+} vt_hpallocator_t;
+
+/** Creates a huge page allocator
+    @param threshold minimum block size to be mapped from the OS
+    @returns vt_hpallocator_t*
+*/
+extern vt_hpallocator_t *vt_hpallocator_create(const size_t threshold);
+
+/** Frees all blocks and destroys the allocator
+    @param hp vt_hpallocator_t instance
+*/
+extern void vt_hpallocator_destroy(vt_hpallocator_t *hp);
+
+/** Allocates zero-initialized memory aligned to VT_HPALLOCATOR_ALIGNMENT
+    @param alloctr allocator instance (`&hp->base`)
+    @param bytes number of bytes to allocate
+    @param file __SOURCE_FILENAME__
+    @param func __func__
+    @param line __LINE__
+
+    @returns pointer to allocated block of memory
+*/
+extern void *vt_hpallocator_alloc(struct VitaBaseAllocatorType *const alloctr, const size_t bytes, const char *const file, const char *const func, const size_t line);
+
+/** Allocates zero-initialized aligned memory
+    @param alloctr allocator instance (`&hp->base`)
+    @param bytes number of bytes to allocate
+    @param alignment power of 2, up to VT_HPALLOCATOR_ALIGNMENT
+    @param file __SOURCE_FILENAME__
+    @param func __func__
+    @param line __LINE__
+
+    @returns pointer to allocated block of memory
+*/
+extern void *vt_hpallocator_alloc_aligned(struct VitaBaseAllocatorType *const alloctr, const size_t bytes, const size_t alignment, const char *const file, const char *const func, const size_t line);
+
+/** Reallocates memory
+    @param alloctr allocator instance (`&hp->base`)
+    @param ptr pointer to the previously allocated block of memory
+    @param bytes number of bytes to allocate
+    @param file __SOURCE_FILENAME__
+    @param func __func__
+    @param line __LINE__
+
+    @returns pointer to reallocated block of memory
+*/
+extern void *vt_hpallocator_realloc(struct VitaBaseAllocatorType *const alloctr, void *ptr, const size_t bytes, const char *const file, const char *const func, const size_t line);
+
+/** Grows a mapped block without moving it
+    @param alloctr allocator instance (`&hp->base`)
+    @param ptr pointer to the previously allocated block of memory
+    @param bytes new size in bytes
+    @param file __SOURCE_FILENAME__
+    @param func __func__
+    @param line __LINE__
+
+    @returns `true` if the block was resized in place
+
+    @note succeeds if the mapping has enough space, or (on Linux) if it can be extended at the same address
+*/
+extern bool vt_hpallocator_expand(struct VitaBaseAllocatorType *const alloctr, void *ptr, const size_t bytes, const char *const file, const char *const func, const size_t line);
+
+/** Frees memory
+    @param alloctr allocator instance (`&hp->base`)
+    @param ptr pointer to the previously allocated block of memory
+    @param file __SOURCE_FILENAME__
+    @param func __func__
+    @param line __LINE__
+*/
+extern void vt_hpallocator_free(struct VitaBaseAllocatorType *const alloctr, void *ptr, const char *const file, const char *const func, const size_t line);
+
+#endif // VITA_ALLOCATOR_HPALLOCATOR_H
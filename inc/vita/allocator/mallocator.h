@@ -4,58 +4,58 @@
 /** MALLOCATOR MODULE 
  * This allocator utilizes plain calloc/free functions for memory management. 
  * However, it also keeps the allocation statistics for further examination.
-
- * Macros
-    - VT_ALLOCATOR_ALLOC
-    - VT_ALLOCATOR_REALLOC
-    - VT_ALLOCATOR_FREE
+ * Allocated pointers are tracked in a hash table, so alloc/realloc/free are O(1) on average.
+ * Optionally, allocations can be aggregated per call site (file:func:line) to find out which
+ * code paths dominate memory traffic (see vt_mallocator_profile_enable).
 
  * Functions
     - vt_mallocator_create
     - vt_mallocator_destroy
     - vt_mallocator_alloc
+    - vt_mallocator_alloc_aligned
     - vt_mallocator_realloc
     - vt_mallocator_free
     - vt_mallocator_print_stats
+    - vt_mallocator_profile_enable
+    - vt_mallocator_profile_dump
 */
 
-#include "vita/core/core.h"
-#include "vita/util/debug.h"
+#include "vita/allocator/common.h"
 
-// macros
-#define VT_ALLOCATOR_ALLOC(alloctr, bytes) alloctr->alloc(alloctr, bytes, __SOURCE_FILENAME__, __func__, __LINE__)
-#define VT_ALLOCATOR_REALLOC(alloctr, ptr, bytes) alloctr->realloc(alloctr, ptr, bytes, __SOURCE_FILENAME__, __func__, __LINE__)
-#define VT_ALLOCATOR_FREE(alloctr, ptr) alloctr->free(alloctr, ptr, __SOURCE_FILENAME__, __func__, __LINE__)
+// marks objects allocated while profiling was disabled
+#define VT_MALLOCATOR_PROFILE_SITE_NONE SIZE_MAX
 
-// allocator statistics
-struct VitaAllocatorStats {
-    size_t count_allocs;                    // number of allocations made
-    size_t count_reallocs;                  // number of reallocations made
-    size_t count_frees;                     // number of frees made
-    size_t count_bytes_allocated;           // number of bytes currently allocated
-    size_t count_bytes_freed;               // number of bytes freed
+// profile dump format
+enum VitaMallocatorProfileFormat {
+    VT_MALLOCATOR_PROFILE_FORMAT_TEXT,      // human-readable table
+    VT_MALLOCATOR_PROFILE_FORMAT_CSV,       // comma-separated values with a header row
+    VT_MALLOCATOR_PROFILE_FORMAT_COUNT
 };
 
-// allocator cache
-struct VitaAllocatedObject {
-    void *ptr;
-    size_t bytes;
-};
+// allocation statistics of a call site
+struct VitaAllocationSite {
+    const char *file;
+    const char *func;
+    size_t line;
 
-// base allocator type for all allocator-like primitives
-struct VitaBaseAllocatorType {
-    // statistics
-    struct VitaAllocatorStats stats;
+    size_t count_allocs;                    // number of allocations made
+    size_t count_reallocs;                  // number of reallocations made
+    size_t count_frees;                     // number of frees of blocks owned by this site
+    size_t bytes_allocated;                 // total bytes requested by allocations and growing reallocations
+    size_t bytes_live;                      // bytes currently owned by this site
+    size_t bytes_live_peak;                 // maximum of bytes_live
+    size_t bytes_realloc_churn;             // bytes copied by reallocations that moved the block
+};
 
-    // obj cache list
-    struct VitaAllocatedObject *obj_list;
-    size_t obj_list_len;
-    size_t obj_list_capacity;
+// call site profile
+struct VitaAllocationProfile {
+    struct VitaAllocationSite *sites;       // sites in order of first use
+    size_t sites_len;
+    size_t sites_capacity;
 
-    // functions
-    void *(*alloc)(struct VitaBaseAllocatorType *const, const size_t, const char *const, const char *const, const size_t);           // custom allocation function
-    void *(*realloc)(struct VitaBaseAllocatorType *const, void*, const size_t, const char *const, const char *const, const size_t);  // custom reallocation function
-    void  (*free)(struct VitaBaseAllocatorType *const, void*, const char *const, const char *const, const size_t);                   // custom free function
+    // open-addressing table of site indices (capacity is a power of 2, VT_MALLOCATOR_PROFILE_SITE_NONE marks an empty slot)
+    size_t *index;
+    size_t index_capacity;
 };
 
 // mallocator
@@ -82,6 +82,20 @@ extern void vt_mallocator_destroy(vt_mallocator_t *alloctr);
 */
 extern void *vt_mallocator_alloc(vt_mallocator_t *const alloctr, const size_t bytes, const char *const file, const char *const func, const size_t line);
 
+/** Allocates aligned memory using the mallocator object
+    @param alloctr vt_mallocator_t object
+    @param bytes number of bytes to allocate
+    @param alignment power of 2 (`0` for the default alignment)
+    @param file __SOURCE_FILENAME__
+    @param func __func__
+    @param line __LINE__
+
+    @returns pointer to allocated block of memory
+
+    @note the alignment is kept upon reallocation
+*/
+extern void *vt_mallocator_alloc_aligned(vt_mallocator_t *const alloctr, const size_t bytes, const size_t alignment, const char *const file, const char *const func, const size_t line);
+
 /** Reallocates memory using the mallocator object
     @param alloctr vt_mallocator_t object
     @param ptr pointer to the previously allocated block of memory
@@ -108,4 +122,21 @@ extern void vt_mallocator_free(vt_mallocator_t *const alloctr, void *ptr, const
 */
 extern void vt_mallocator_print_stats(const struct VitaAllocatorStats stats);
 
+/** Enables call site profiling
+    @param alloctr vt_mallocator_t object
+
+    @note blocks allocated before profiling was enabled are not attributed to any site
+    @note a block's live bytes are owned by the site that allocated or last reallocated it
+*/
+extern void vt_mallocator_profile_enable(vt_mallocator_t *const alloctr);
+
+/** Writes call site profile sorted by total bytes allocated
+    @param alloctr vt_mallocator_t object
+    @param stream output stream, e.g. stdout or an opened file
+    @param format enum VitaMallocatorProfileFormat
+
+    @note does nothing if profiling is disabled
+*/
+extern void vt_mallocator_profile_dump(const vt_mallocator_t *const alloctr, FILE *stream, const enum VitaMallocatorProfileFormat format);
+
 #endif // VITA_ALLOCATOR_MALLOCATOR_H
@@ -0,0 +1,119 @@
+#ifndef VITA_ALLOCATOR_POOL_H
+#define VITA_ALLOCATOR_POOL_H
+
+/** POOL MODULE 
+ * This allocator serves small allocations from per-size-class free lists. Blocks are carved 
+ * from large slabs and recycled upon free, so allocating and freeing identically sized objects 
+ * (container headers, small buffers) does not go through libc. Allocations bigger than 
+ * VT_ALLOCATOR_SIZE_CLASS_MAX are passed to vt_calloc/vt_free.
+
+ * Functions
+    - vt_pool_create
+    - vt_pool_destroy
+    - vt_pool_alloc
+    - vt_pool_realloc
+    - vt_pool_free
+    - vt_pool_print_stats
+    - vt_pool_class_index
+    - vt_pool_class_size
+
+ * Usage
+    vt_pool_t *pool = vt_pool_create();
+    vt_str_t *s = vt_str_create("hello", &pool->base);
+*/
+
+#include "vita/allocator/common.h"
+
+// constants
+#define VT_POOL_SLAB_SIZE (64 * 1024)
+
+// header stored in front of every block
+struct VitaPoolBlockHeader {
+    size_t bytes;               // requested size
+    size_t class_idx;           // size class index or VT_ALLOCATOR_SIZE_CLASS_COUNT for large blocks
+};
+
+// size class free list and the slab it is carving blocks from
+struct VitaPoolSizeClass {
+    void *free_list;            // recycled blocks (next pointer is stored inside the block)
+    char *cursor;               // next unused block in the current slab
+    char *cursor_end;           // end of the current slab
+};
+
+// allocation bigger than the biggest size class
+struct VitaPoolLargeBlock {
+    struct VitaPoolLargeBlock *next;
+    struct VitaPoolLargeBlock *prev;
+};
+
+// pool allocator
+typedef struct VitaPoolAllocator {
+    struct VitaBaseAllocatorType base;  // allocator interface, pass `&pool->base` to containers
+
+    struct VitaPoolSizeClass classes[VT_ALLOCATOR_SIZE_CLASS_COUNT];
+    void *slabs;                        // list of all slabs (next pointer is stored inside the slab)
+    struct VitaPoolLargeBlock *large;   // list of large allocations
+} vt_pool_t;
+
+/** Creates a pool allocator
+    @returns vt_pool_t*
+*/
+extern vt_pool_t *vt_pool_create(void);
+
+/** Frees all slabs and large allocations, and destroys the pool
+    @param pool vt_pool_t instance
+*/
+extern void vt_pool_destroy(vt_pool_t *pool);
+
+/** Allocates zero-initialized memory from the pool
+    @param alloctr pool allocator instance (`&pool->base`)
+    @param bytes number of bytes to allocate
+    @param file __SOURCE_FILENAME__
+    @param func __func__
+    @param line __LINE__
+
+    @returns pointer to allocated block of memory
+*/
+extern void *vt_pool_alloc(struct VitaBaseAllocatorType *const alloctr, const size_t bytes, const char *const file, const char *const func, const size_t line);
+
+/** Reallocates memory from the pool
+    @param alloctr pool allocator instance (`&pool->base`)
+    @param ptr pointer to the previously allocated block of memory
+    @param bytes number of bytes to allocate
+    @param file __SOURCE_FILENAME__
+    @param func __func__
+    @param line __LINE__
+
+    @returns pointer to reallocated block of memory
+
+    @note the block is kept if the new size fits into the same size class
+*/
+extern void *vt_pool_realloc(struct VitaBaseAllocatorType *const alloctr, void *ptr, const size_t bytes, const char *const file, const char *const func, const size_t line);
+
+/** Returns memory to its size class free list
+    @param alloctr pool allocator instance (`&pool->base`)
+    @param ptr pointer to the previously allocated block of memory
+    @param file __SOURCE_FILENAME__
+    @param func __func__
+    @param line __LINE__
+*/
+extern void vt_pool_free(struct VitaBaseAllocatorType *const alloctr, void *ptr, const char *const file, const char *const func, const size_t line);
+
+/** Prints per size class hit/miss statistics
+    @param stats VitaAllocatorStats struct
+*/
+extern void vt_pool_print_stats(const struct VitaAllocatorStats stats);
+
+/** Returns size class index for the requested number of bytes
+    @param bytes number of bytes
+    @returns size class index or VT_ALLOCATOR_SIZE_CLASS_COUNT if it is too big for the pool
+*/
+extern size_t vt_pool_class_index(const size_t bytes);
+
+/** Returns block size of a size class
+    @param class_idx size class index
+    @returns size in bytes
+*/
+extern size_t vt_pool_class_size(const size_t class_idx);
+
+#endif // VITA_ALLOCATOR_POOL_H
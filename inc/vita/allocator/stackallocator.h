@@ -0,0 +1,129 @@
+#ifndef VITA_ALLOCATOR_STACKALLOCATOR_H
+#define VITA_ALLOCATOR_STACKALLOCATOR_H
+
+/** STACKALLOCATOR MODULE
+ * This allocator carves memory from a caller-provided buffer, for example a local array. It needs
+ * no heap memory of its own. Freed blocks are reclaimed in LIFO order: freeing the most recent block
+ * rewinds the buffer, including blocks below it that were already freed. The most recent block can
+ * grow in place. When the buffer runs out of space, allocations spill to the heap. Spilled blocks
+ * are released upon free or by `vt_stackallocator_destroy`. It suits small temporary containers
+ * on hot paths.
+
+ * Functions
+    - vt_stackallocator_create
+    - vt_stackallocator_destroy
+    - vt_stackallocator_reset
+    - vt_stackallocator_alloc
+    - vt_stackallocator_alloc_aligned
+    - vt_stackallocator_realloc
+    - vt_stackallocator_free
+
+ * Usage
+    char buf[VT_STACKALLOCATOR_DEFAULT_SIZE];
+    vt_stackallocator_t sa = vt_stackallocator_create(buf, sizeof(buf));
+    vt_str_t *s = vt_str_create("hello", &sa.base);
+    // ...
+    vt_str_destroy(s);
+    vt_stackallocator_destroy(&sa);
+*/
+
+#include "vita/allocator/common.h"
+
+// constants
+#define VT_STACKALLOCATOR_DEFAULT_SIZE 4096
+#define VT_STACKALLOCATOR_ALIGNMENT 16
+
+// header stored in front of every block
+struct VitaStackBlockHeader {
+    struct VitaStackBlockHeader *prev;  // buffer: block carved before this one; heap: previous spilled block
+    struct VitaStackBlockHeader *next;  // heap: next spilled block
+    size_t bytes;                       // block size
+    size_t alignment;                   // block alignment, 0 once a buffer block is freed
+    size_t generation;                  // allocator generation the block was allocated in
+};
+
+// stack allocator
+typedef struct VitaStackAllocator {
+    struct VitaBaseAllocatorType base;  // allocator interface, pass `&sa.base` to containers
+
+    char *buf;                          // caller-provided buffer
+    size_t capacity;                    // buffer size in bytes
+    size_t offset;                      // bytes used
+    struct VitaStackBlockHeader *top;   // last block carved from the buffer
+    struct VitaStackBlockHeader *spills; // blocks allocated from the heap
+    size_t count_spills;                // number of blocks that spilled to the heap
+    size_t generation;                  // number of resets, blocks of older generations are ignored upon free
+} vt_stackallocator_t;
+
+/** Creates a stack allocator on top of a buffer
+    @param buf buffer to carve memory from, must outlive the allocator
+    @param size buffer size in bytes
+    @returns vt_stackallocator_t
+
+    @note returned by value, so the allocator itself can live on the stack too
+*/
+extern vt_stackallocator_t vt_stackallocator_create(void *const buf, const size_t size);
+
+/** Frees spilled blocks and destroys the allocator
+    @param sa vt_stackallocator_t instance
+*/
+extern void vt_stackallocator_destroy(vt_stackallocator_t *const sa);
+
+/** Releases all allocations at once, the buffer is kept for reuse
+    @param sa vt_stackallocator_t instance
+
+    @note blocks allocated before the reset may still be freed, which does nothing
+*/
+extern void vt_stackallocator_reset(vt_stackallocator_t *const sa);
+
+/** Allocates zero-initialized memory from the buffer, or from the heap if the buffer is full
+    @param alloctr allocator instance (`&sa.base`)
+    @param bytes number of bytes to allocate
+    @param file __SOURCE_FILENAME__
+    @param func __func__
+    @param line __LINE__
+
+    @returns pointer to allocated block of memory (aligned to VT_STACKALLOCATOR_ALIGNMENT)
+*/
+extern void *vt_stackallocator_alloc(struct VitaBaseAllocatorType *const alloctr, const size_t bytes, const char *const file, const char *const func, const size_t line);
+
+/** Allocates zero-initialized aligned memory from the buffer, or from the heap if the buffer is full
+    @param alloctr allocator instance (`&sa.base`)
+    @param bytes number of bytes to allocate
+    @param alignment power of 2
+    @param file __SOURCE_FILENAME__
+    @param func __func__
+    @param line __LINE__
+
+    @returns pointer to allocated block of memory
+
+    @note the alignment is kept upon reallocation
+*/
+extern void *vt_stackallocator_alloc_aligned(struct VitaBaseAllocatorType *const alloctr, const size_t bytes, const size_t alignment, const char *const file, const char *const func, const size_t line);
+
+/** Reallocates memory
+    @param alloctr allocator instance (`&sa.base`)
+    @param ptr pointer to the previously allocated block of memory
+    @param bytes number of bytes to allocate
+    @param file __SOURCE_FILENAME__
+    @param func __func__
+    @param line __LINE__
+
+    @returns pointer to reallocated block of memory
+
+    @note the last buffer block is resized in place if the buffer has enough space
+*/
+extern void *vt_stackallocator_realloc(struct VitaBaseAllocatorType *const alloctr, void *ptr, const size_t bytes, const char *const file, const char *const func, const size_t line);
+
+/** Frees memory, buffer space is reclaimed once all blocks above it are freed
+    @param alloctr allocator instance (`&sa.base`)
+    @param ptr pointer to the previously allocated block of memory
+    @param file __SOURCE_FILENAME__
+    @param func __func__
+    @param line __LINE__
+
+    @note a block allocated before the last reset was already released, only `count_frees` is updated
+*/
+extern void vt_stackallocator_free(struct VitaBaseAllocatorType *const alloctr, void *ptr, const char *const file, const char *const func, const size_t line);
+
+#endif // VITA_ALLOCATOR_STACKALLOCATOR_H
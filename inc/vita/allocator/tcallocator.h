@@ -0,0 +1,117 @@
+#ifndef VITA_ALLOCATOR_TCALLOCATOR_H
+#define VITA_ALLOCATOR_TCALLOCATOR_H
+
+/** TCALLOCATOR MODULE
+ * Thread-safe allocator with thread caching. Each thread keeps small per-size-class caches of
+ * free blocks, so most allocations and frees do not synchronize. Caches are refilled from and
+ * drained to a shared vt_pool_t in batches under a spinlock. Allocations bigger than
+ * VT_ALLOCATOR_SIZE_CLASS_MAX always go to the shared pool.
+
+ * Statistics are accumulated per thread and merged into `base.stats` whenever the thread touches
+ * the shared pool, so peaks are only sampled at those points. Call vt_tcallocator_flush from each
+ * thread to return its cache and merge its statistics before the thread exits. A thread that exits
+ * without flushing loses its unmerged statistics, and its cached blocks stay unused in the pool
+ * until the allocator is destroyed. While other threads are running, read the stats with
+ * vt_tcallocator_get_stats instead of vt_allocator_get_stats, which does not take the lock.
+
+ * A thread caches blocks for at most VT_TCALLOCATOR_THREAD_CACHES allocators at once; it uses any
+ * further allocator without a cache, taking the lock on every call, until one of its caches is
+ * released with vt_tcallocator_flush or its allocator is destroyed by any thread.
+
+ * Functions
+    - vt_tcallocator_create
+    - vt_tcallocator_destroy
+    - vt_tcallocator_flush
+    - vt_tcallocator_get_stats
+    - vt_tcallocator_alloc
+    - vt_tcallocator_realloc
+    - vt_tcallocator_free
+
+ * Usage
+    vt_tcallocator_t *tc = vt_tcallocator_create();
+    // in worker threads
+    vt_vec_t *v = vt_vec_create(16, sizeof(int32_t), &tc->base);
+    ...
+    vt_vec_destroy(v);
+    vt_tcallocator_flush(tc);
+    // after threads are joined
+    vt_tcallocator_destroy(tc);
+*/
+
+#include <stdatomic.h>
+#include "vita/allocator/pool.h"
+
+// constants
+#define VT_TCALLOCATOR_CACHE_SIZE 64        // max number of cached blocks per size class
+#define VT_TCALLOCATOR_CACHE_BATCH 32       // number of blocks moved between a thread cache and the pool at once
+#define VT_TCALLOCATOR_THREAD_CACHES 4      // number of allocators a thread can cache blocks for at the same time
+
+// thread-safe allocator
+typedef struct VitaThreadCachingAllocator {
+    struct VitaBaseAllocatorType base;  // allocator interface, pass `&tc->base` to containers
+
+    size_t id;                          // unique allocator id used to find thread caches
+    vt_pool_t *pool;                    // shared backing store
+    atomic_flag lock;                   // guards the pool and `base.stats`
+} vt_tcallocator_t;
+
+/** Creates a thread-safe allocator
+    @returns vt_tcallocator_t*
+*/
+extern vt_tcallocator_t *vt_tcallocator_create(void);
+
+/** Destroys the allocator and frees all memory allocated with it
+    @param tc vt_tcallocator_t instance
+
+    @note no other thread may use the allocator at this point
+*/
+extern void vt_tcallocator_destroy(vt_tcallocator_t *tc);
+
+/** Returns cached blocks of the calling thread to the shared pool and merges its statistics
+    @param tc vt_tcallocator_t instance
+*/
+extern void vt_tcallocator_flush(vt_tcallocator_t *const tc);
+
+/** Returns a snapshot of allocator statistics, safe to call while other threads use the allocator
+    @param tc vt_tcallocator_t instance
+    @returns VitaAllocatorStats struct
+
+    @note includes statistics of the calling thread, but not unmerged statistics of other threads
+*/
+extern struct VitaAllocatorStats vt_tcallocator_get_stats(vt_tcallocator_t *const tc);
+
+/** Allocates zero-initialized memory
+    @param alloctr allocator instance (`&tc->base`)
+    @param bytes number of bytes to allocate
+    @param file __SOURCE_FILENAME__
+    @param func __func__
+    @param line __LINE__
+
+    @returns pointer to allocated block of memory
+*/
+extern void *vt_tcallocator_alloc(struct VitaBaseAllocatorType *const alloctr, const size_t bytes, const char *const file, const char *const func, const size_t line);
+
+/** Reallocates memory
+    @param alloctr allocator instance (`&tc->base`)
+    @param ptr pointer to the previously allocated block of memory
+    @param bytes number of bytes to allocate
+    @param file __SOURCE_FILENAME__
+    @param func __func__
+    @param line __LINE__
+
+    @returns pointer to reallocated block of memory
+*/
+extern void *vt_tcallocator_realloc(struct VitaBaseAllocatorType *const alloctr, void *ptr, const size_t bytes, const char *const file, const char *const func, const size_t line);
+
+/** Frees memory
+    @param alloctr allocator instance (`&tc->base`)
+    @param ptr pointer to the previously allocated block of memory
+    @param file __SOURCE_FILENAME__
+    @param func __func__
+    @param line __LINE__
+
+    @note blocks may be freed by a thread other than the one that allocated them
+*/
+extern void vt_tcallocator_free(struct VitaBaseAllocatorType *const alloctr, void *ptr, const char *const file, const char *const func, const size_t line);
+
+#endif // VITA_ALLOCATOR_TCALLOCATOR_H
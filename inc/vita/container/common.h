@@ -8,6 +8,8 @@
     - vt_array_has_space
     - vt_array_elsize
     - vt_array_has_alloctr
+    - vt_array_set_growth_policy
+    - vt_array_growth
     - vt_array_set
     - vt_array_get
     - vt_array_slide_front
@@ -23,6 +25,17 @@
 #include "vita/util/debug.h"
 #include "vita/allocator/mallocator.h"
 
+/// growth policy used when a container runs out of space
+enum VitaGrowthPolicy {
+    VT_GROWTH_POLICY_DEFAULT,       // adds capacity * VT_ARRAY_DEFAULT_GROWTH_RATE elements
+    VT_GROWTH_POLICY_FACTOR_2,      // doubles the capacity
+    VT_GROWTH_POLICY_FACTOR_1_5,    // multiplies the capacity by 1.5
+    VT_GROWTH_POLICY_LINEAR,        // adds VT_ARRAY_GROWTH_CHUNK_BYTES worth of elements
+    VT_GROWTH_POLICY_CAPPED,        // doubles the capacity, but adds at most VT_ARRAY_GROWTH_CAP_BYTES at once
+    VT_GROWTH_POLICY_EXACT,         // adds only the required number of elements
+    VT_GROWTH_POLICY_COUNT
+};
+
 /// base array type for all array-like primitives
 struct VitaBaseArrayType {
     // data information
@@ -34,6 +47,9 @@ struct VitaBaseArrayType {
     // viewable (non-modifiable)
     bool is_view;
 
+    // how the container grows when it runs out of space
+    enum VitaGrowthPolicy growth_policy;
+
     // data pointers
     union {
         void *ptr;
@@ -111,6 +127,19 @@ extern bool vt_array_is_valid_object(const struct VitaBaseArrayType *const vbat)
 */
 extern bool vt_array_has_alloctr(const struct VitaBaseArrayType *const vbat);
 
+/** Sets the growth policy
+    @param vbat VitaBaseArrayType instance
+    @param policy growth policy
+*/
+extern void vt_array_set_growth_policy(struct VitaBaseArrayType *const vbat, const enum VitaGrowthPolicy policy);
+
+/** Computes how many elements to reserve according to the growth policy
+    @param vbat VitaBaseArrayType instance
+    @param n minimum number of additional elements
+    @returns number of elements to reserve, at least `n`
+*/
+extern size_t vt_array_growth(const struct VitaBaseArrayType *const vbat, const size_t n);
+
 /** Returns value at index
     @param vbat VitaBaseArrayType instance
     @param at index
@@ -0,0 +1,314 @@
+#ifndef VITA_CONTAINER_DEQUE_H
+#define VITA_CONTAINER_DEQUE_H
+
+/** DEQUE MODULE (ring buffer)
+ * A double-ended queue of fixed-size elements, set up like vt_vec_create elements. Elements are stored in a
+ * circular buffer, so pushing and popping at either end is O(1) (amortized when growing), unlike
+ * vt_vec_push_front which moves the whole array. The contents are at most two contiguous segments of the buffer,
+ * see vt_deque_spans, so bulk copies take two memcpy calls.
+
+ * Functions
+    - vt_deque_create
+    - vt_deque_destroy
+    - vt_deque_len
+    - vt_deque_capacity
+    - vt_deque_is_empty
+    - vt_deque_clear
+    - vt_deque_reserve
+    - vt_deque_push_front
+    - vt_deque_push_frontT (T = i8, u8, i16, u16, i32, u32, i64, u64, f, d, r)
+    - vt_deque_push_back
+    - vt_deque_push_backT (T = i8, u8, i16, u16, i32, u32, i64, u64, f, d, r)
+    - vt_deque_push_back_n
+    - vt_deque_pop_front
+    - vt_deque_pop_back
+    - vt_deque_pop_get_front
+    - vt_deque_pop_get_frontT (T = i8, u8, i16, u16, i32, u32, i64, u64, f, d, r)
+    - vt_deque_pop_get_back
+    - vt_deque_pop_get_backT (T = i8, u8, i16, u16, i32, u32, i64, u64, f, d, r)
+    - vt_deque_pop_front_n
+    - vt_deque_set
+    - vt_deque_setT (T = i8, u8, i16, u16, i32, u32, i64, u64, f, d, r)
+    - vt_deque_get
+    - vt_deque_getT (T = i8, u8, i16, u16, i32, u32, i64, u64, f, d, r)
+    - vt_deque_spans
+    - vt_deque_apply
+
+ * Usage
+    // FIFO queue
+    vt_deque_t *queue = vt_deque_create(64, sizeof(int32_t), NULL);
+    vt_deque_push_backi32(queue, 42);
+    while (!vt_deque_is_empty(queue)) {
+        const int32_t x = vt_deque_pop_get_fronti32(queue);
+        ...
+    }
+
+    // copy out
+    vt_span_t first, second;
+    vt_deque_spans(queue, &first, &second);
+    memcpy(dst, first.instance.ptr, vt_span_len(first) * sizeof(int32_t));
+    memcpy(dst + vt_span_len(first), second.instance.ptr, vt_span_len(second) * sizeof(int32_t));
+    vt_deque_destroy(queue);
+*/
+
+#include "vita/container/common.h"
+#include "vita/container/span.h"
+
+// deque
+typedef struct VitaDeque {
+    struct VitaBaseAllocatorType *alloctr;  // allocator, `NULL` for the default one
+    void *ptr;                              // circular buffer
+    size_t head;                            // buffer index of the first element
+    size_t len;                             // number of elements
+    size_t capacity;                        // number of elements that fit into the buffer, power of 2
+    size_t elsize;                          // element size in bytes
+} vt_deque_t;
+
+/** Allocates and constructs vt_deque_t
+    @param n number of elements to make room for
+    @param elsize element size
+    @param alloctr allocator instance
+
+    @returns `vt_deque_t*`
+
+    @note the capacity is n rounded up to a power of 2
+    @note if `alloctr = NULL` is specified, then vt_calloc/realloc/free is used
+*/
+extern vt_deque_t *vt_deque_create(const size_t n, const size_t elsize, struct VitaBaseAllocatorType *const alloctr);
+
+/** Destroys vt_deque_t
+    @param d vt_deque_t instance
+*/
+extern void vt_deque_destroy(vt_deque_t *d);
+
+/** Returns vt_deque_t length
+    @param d vt_deque_t instance
+    @returns size_t
+*/
+extern size_t vt_deque_len(const vt_deque_t *const d);
+
+/** Returns vt_deque_t capacity
+    @param d vt_deque_t instance
+    @returns size_t
+*/
+extern size_t vt_deque_capacity(const vt_deque_t *const d);
+
+/** Checks if vt_deque_t is empty
+    @param d vt_deque_t instance
+    @returns `true` if length is 0
+*/
+extern bool vt_deque_is_empty(const vt_deque_t *const d);
+
+/** Removes all elements, the capacity is kept
+    @param d vt_deque_t instance
+*/
+extern void vt_deque_clear(vt_deque_t *const d);
+
+/** Reserves memory for additional n elements
+    @param d vt_deque_t instance
+    @param n number of elements
+
+    @note the capacity is rounded up to a power of 2
+*/
+extern void vt_deque_reserve(vt_deque_t *const d, const size_t n);
+
+/** Pushes an element at the front
+    @param d vt_deque_t instance
+    @param val value to push
+*/
+extern void vt_deque_push_front(vt_deque_t *const d, const void *const val);
+
+/** Pushes an element at the front
+    @param d vt_deque_t instance
+    @param val value to push
+*/
+#define VT_PROTOTYPE_DEQUE_PUSH_FRONT(T, t) extern void vt_deque_push_front##t(vt_deque_t *const d, const T val)
+VT_PROTOTYPE_DEQUE_PUSH_FRONT(int8_t, i8);
+VT_PROTOTYPE_DEQUE_PUSH_FRONT(uint8_t, u8);
+VT_PROTOTYPE_DEQUE_PUSH_FRONT(int16_t, i16);
+VT_PROTOTYPE_DEQUE_PUSH_FRONT(uint16_t, u16);
+VT_PROTOTYPE_DEQUE_PUSH_FRONT(int32_t, i32);
+VT_PROTOTYPE_DEQUE_PUSH_FRONT(uint32_t, u32);
+VT_PROTOTYPE_DEQUE_PUSH_FRONT(int64_t, i64);
+VT_PROTOTYPE_DEQUE_PUSH_FRONT(uint64_t, u64);
+VT_PROTOTYPE_DEQUE_PUSH_FRONT(float, f);
+VT_PROTOTYPE_DEQUE_PUSH_FRONT(double, d);
+VT_PROTOTYPE_DEQUE_PUSH_FRONT(real, r);
+#undef VT_PROTOTYPE_DEQUE_PUSH_FRONT
+
+/** Pushes an element at the back
+    @param d vt_deque_t instance
+    @param val value to push
+*/
+extern void vt_deque_push_back(vt_deque_t *const d, const void *const val);
+
+/** Pushes an element at the back
+    @param d vt_deque_t instance
+    @param val value to push
+*/
+#define VT_PROTOTYPE_DEQUE_PUSH_BACK(T, t) extern void vt_deque_push_back##t(vt_deque_t *const d, const T val)
+VT_PROTOTYPE_DEQUE_PUSH_BACK(int8_t, i8);
+VT_PROTOTYPE_DEQUE_PUSH_BACK(uint8_t, u8);
+VT_PROTOTYPE_DEQUE_PUSH_BACK(int16_t, i16);
+VT_PROTOTYPE_DEQUE_PUSH_BACK(uint16_t, u16);
+VT_PROTOTYPE_DEQUE_PUSH_BACK(int32_t, i32);
+VT_PROTOTYPE_DEQUE_PUSH_BACK(uint32_t, u32);
+VT_PROTOTYPE_DEQUE_PUSH_BACK(int64_t, i64);
+VT_PROTOTYPE_DEQUE_PUSH_BACK(uint64_t, u64);
+VT_PROTOTYPE_DEQUE_PUSH_BACK(float, f);
+VT_PROTOTYPE_DEQUE_PUSH_BACK(double, d);
+VT_PROTOTYPE_DEQUE_PUSH_BACK(real, r);
+#undef VT_PROTOTYPE_DEQUE_PUSH_BACK
+
+/** Pushes n elements at the back
+    @param d vt_deque_t instance
+    @param vals array of n elements
+    @param n number of elements
+
+    @note copies at most two contiguous segments
+*/
+extern void vt_deque_push_back_n(vt_deque_t *const d, const void *const vals, const size_t n);
+
+/** Pops off the first element
+    @param d vt_deque_t instance
+*/
+extern void vt_deque_pop_front(vt_deque_t *const d);
+
+/** Pops off the last element
+    @param d vt_deque_t instance
+*/
+extern void vt_deque_pop_back(vt_deque_t *const d);
+
+/** Pops off and returns the first element
+    @param d vt_deque_t instance
+    @returns void* if len > 0 else NULL
+
+    @note the pointer is valid until the next push
+*/
+extern void *vt_deque_pop_get_front(vt_deque_t *const d);
+
+/** Pops off and returns the first element
+    @param d vt_deque_t instance
+    @returns element of type T if len > 0 else 0
+*/
+#define VT_PROTOTYPE_DEQUE_POP_GET_FRONT(T, t) extern T vt_deque_pop_get_front##t(vt_deque_t *const d)
+VT_PROTOTYPE_DEQUE_POP_GET_FRONT(int8_t, i8);
+VT_PROTOTYPE_DEQUE_POP_GET_FRONT(uint8_t, u8);
+VT_PROTOTYPE_DEQUE_POP_GET_FRONT(int16_t, i16);
+VT_PROTOTYPE_DEQUE_POP_GET_FRONT(uint16_t, u16);
+VT_PROTOTYPE_DEQUE_POP_GET_FRONT(int32_t, i32);
+VT_PROTOTYPE_DEQUE_POP_GET_FRONT(uint32_t, u32);
+VT_PROTOTYPE_DEQUE_POP_GET_FRONT(int64_t, i64);
+VT_PROTOTYPE_DEQUE_POP_GET_FRONT(uint64_t, u64);
+VT_PROTOTYPE_DEQUE_POP_GET_FRONT(float, f);
+VT_PROTOTYPE_DEQUE_POP_GET_FRONT(double, d);
+VT_PROTOTYPE_DEQUE_POP_GET_FRONT(real, r);
+#undef VT_PROTOTYPE_DEQUE_POP_GET_FRONT
+
+/** Pops off and returns the last element
+    @param d vt_deque_t instance
+    @returns void* if len > 0 else NULL
+
+    @note the pointer is valid until the next push
+*/
+extern void *vt_deque_pop_get_back(vt_deque_t *const d);
+
+/** Pops off and returns the last element
+    @param d vt_deque_t instance
+    @returns element of type T if len > 0 else 0
+*/
+#define VT_PROTOTYPE_DEQUE_POP_GET_BACK(T, t) extern T vt_deque_pop_get_back##t(vt_deque_t *const d)
+VT_PROTOTYPE_DEQUE_POP_GET_BACK(int8_t, i8);
+VT_PROTOTYPE_DEQUE_POP_GET_BACK(uint8_t, u8);
+VT_PROTOTYPE_DEQUE_POP_GET_BACK(int16_t, i16);
+VT_PROTOTYPE_DEQUE_POP_GET_BACK(uint16_t, u16);
+VT_PROTOTYPE_DEQUE_POP_GET_BACK(int32_t, i32);
+VT_PROTOTYPE_DEQUE_POP_GET_BACK(uint32_t, u32);
+VT_PROTOTYPE_DEQUE_POP_GET_BACK(int64_t, i64);
+VT_PROTOTYPE_DEQUE_POP_GET_BACK(uint64_t, u64);
+VT_PROTOTYPE_DEQUE_POP_GET_BACK(float, f);
+VT_PROTOTYPE_DEQUE_POP_GET_BACK(double, d);
+VT_PROTOTYPE_DEQUE_POP_GET_BACK(real, r);
+#undef VT_PROTOTYPE_DEQUE_POP_GET_BACK
+
+/** Pops off up to n elements from the front
+    @param d vt_deque_t instance
+    @param dst array of n elements to copy the elements into, if not `NULL`
+    @param n number of elements
+
+    @returns number of elements popped off
+
+    @note copies at most two contiguous segments
+*/
+extern size_t vt_deque_pop_front_n(vt_deque_t *const d, void *const dst, const size_t n);
+
+/** Assigns a new value at an index
+    @param d vt_deque_t instance
+    @param val value
+    @param at index from the front
+*/
+extern void vt_deque_set(vt_deque_t *const d, const void *const val, const size_t at);
+
+/** Assigns a new value at an index
+    @param d vt_deque_t instance
+    @param val value
+    @param at index from the front
+*/
+#define VT_PROTOTYPE_DEQUE_SET(T, t) extern void vt_deque_set##t(vt_deque_t *const d, const T val, const size_t at)
+VT_PROTOTYPE_DEQUE_SET(int8_t, i8);
+VT_PROTOTYPE_DEQUE_SET(uint8_t, u8);
+VT_PROTOTYPE_DEQUE_SET(int16_t, i16);
+VT_PROTOTYPE_DEQUE_SET(uint16_t, u16);
+VT_PROTOTYPE_DEQUE_SET(int32_t, i32);
+VT_PROTOTYPE_DEQUE_SET(uint32_t, u32);
+VT_PROTOTYPE_DEQUE_SET(int64_t, i64);
+VT_PROTOTYPE_DEQUE_SET(uint64_t, u64);
+VT_PROTOTYPE_DEQUE_SET(float, f);
+VT_PROTOTYPE_DEQUE_SET(double, d);
+VT_PROTOTYPE_DEQUE_SET(real, r);
+#undef VT_PROTOTYPE_DEQUE_SET
+
+/** Returns value at index
+    @param d vt_deque_t instance
+    @param at index from the front
+
+    @returns void*
+*/
+extern void *vt_deque_get(const vt_deque_t *const d, const size_t at);
+
+/** Returns value at index
+    @param d vt_deque_t instance
+    @param at index from the front
+
+    @returns value
+*/
+#define VT_PROTOTYPE_DEQUE_GET(T, t) extern T vt_deque_get##t(const vt_deque_t *const d, const size_t at)
+VT_PROTOTYPE_DEQUE_GET(int8_t, i8);
+VT_PROTOTYPE_DEQUE_GET(uint8_t, u8);
+VT_PROTOTYPE_DEQUE_GET(int16_t, i16);
+VT_PROTOTYPE_DEQUE_GET(uint16_t, u16);
+VT_PROTOTYPE_DEQUE_GET(int32_t, i32);
+VT_PROTOTYPE_DEQUE_GET(uint32_t, u32);
+VT_PROTOTYPE_DEQUE_GET(int64_t, i64);
+VT_PROTOTYPE_DEQUE_GET(uint64_t, u64);
+VT_PROTOTYPE_DEQUE_GET(float, f);
+VT_PROTOTYPE_DEQUE_GET(double, d);
+VT_PROTOTYPE_DEQUE_GET(real, r);
+#undef VT_PROTOTYPE_DEQUE_GET
+
+/** Returns the contents as two contiguous segments, in order
+    @param d vt_deque_t instance
+    @param first elements from the front up to the end of the buffer
+    @param second wrapped around elements from the start of the buffer, if any
+
+    @note a segment is empty if its length is 0
+*/
+extern void vt_deque_spans(const vt_deque_t *const d, vt_span_t *const first, vt_span_t *const second);
+
+/** Calls the specified function on each element from the front
+    @param d vt_deque_t instance
+    @param func function to execute action on each element: func(pointer, index)
+*/
+extern void vt_deque_apply(const vt_deque_t *const d, void (*func)(void*, size_t));
+
+#endif // VITA_CONTAINER_DEQUE_H
@@ -0,0 +1,282 @@
+#ifndef VITA_CONTAINER_HEAP_H
+#define VITA_CONTAINER_HEAP_H
+
+/** HEAP MODULE (binary heap, priority queue)
+ * A priority queue of fixed-size elements stored in heap order in a vt_vec_t. The order is defined by a
+ * comparator, or heaps of numbers are created with vt_heap_createT, which compares values directly instead of
+ * calling a function. Push and pop are O(log n), peek is O(1), and vt_heap_heapify builds a heap from a vector
+ * in O(n). If handles are enabled, every element gets a handle upon insertion, with which it can be read, given a
+ * new priority (decrease-key) or removed in O(log n).
+
+ * Functions
+    - vt_heap_create
+    - vt_heap_createT (T = i8, u8, i16, u16, i32, u32, i64, u64, f, d, r)
+    - vt_heap_destroy
+    - vt_heap_len
+    - vt_heap_is_empty
+    - vt_heap_clear
+    - vt_heap_reserve
+    - vt_heap_enable_handles
+    - vt_heap_push
+    - vt_heap_pushT (T = i8, u8, i16, u16, i32, u32, i64, u64, f, d, r)
+    - vt_heap_peek
+    - vt_heap_peekT (T = i8, u8, i16, u16, i32, u32, i64, u64, f, d, r)
+    - vt_heap_pop
+    - vt_heap_pop_get
+    - vt_heap_pop_getT (T = i8, u8, i16, u16, i32, u32, i64, u64, f, d, r)
+    - vt_heap_replace
+    - vt_heap_heapify
+    - vt_heap_get
+    - vt_heap_update
+    - vt_heap_remove
+
+ * Usage
+    // top 10 values: keep the 10 largest seen so far, the smallest of them on top
+    vt_heap_t *top = vt_heap_created(10, VT_HEAP_ORDER_MIN, NULL);
+    for (size_t i = 0; i < n; i++) {
+        if (vt_heap_len(top) < 10) {
+            vt_heap_pushd(top, values[i]);
+        } else if (values[i] > vt_heap_peekd(top)) {
+            vt_heap_replace(top, &values[i]);
+        }
+    }
+    vt_heap_destroy(top);
+
+    // timers: reschedule with a handle
+    vt_heap_t *timers = vt_heap_create(64, sizeof(struct Timer), timer_cmp, NULL);
+    vt_heap_enable_handles(timers);
+    const size_t handle = vt_heap_push(timers, &timer);
+    vt_heap_update(timers, handle, &timer_rescheduled);
+*/
+
+#include "vita/container/common.h"
+#include "vita/container/vec.h"
+
+// constants
+#define VT_HEAP_NO_HANDLE SIZE_MAX          // handles are disabled or the element is not in the heap
+
+// order of numeric heaps
+enum VitaHeapOrder {
+    VT_HEAP_ORDER_MIN,                      // the smallest value is on top
+    VT_HEAP_ORDER_MAX,                      // the largest value is on top
+    VT_HEAP_ORDER_COUNT
+};
+
+// element type of numeric heaps
+enum VitaHeapKind {
+    VT_HEAP_KIND_CUSTOM,                    // compared with the comparator
+    VT_HEAP_KIND_I8,
+    VT_HEAP_KIND_U8,
+    VT_HEAP_KIND_I16,
+    VT_HEAP_KIND_U16,
+    VT_HEAP_KIND_I32,
+    VT_HEAP_KIND_U32,
+    VT_HEAP_KIND_I64,
+    VT_HEAP_KIND_U64,
+    VT_HEAP_KIND_F,
+    VT_HEAP_KIND_D,
+    VT_HEAP_KIND_R,
+    VT_HEAP_KIND_COUNT
+};
+
+// heap
+typedef struct VitaHeap {
+    vt_vec_t *data;                                 // elements in heap order
+    void *tmp;                                      // element being sifted
+    int32_t (*cmp)(const void *a, const void *b);   // negative if `a` goes before `b` (is closer to the top)
+    enum VitaHeapKind kind;                         // numeric element type, VT_HEAP_KIND_CUSTOM otherwise
+    enum VitaHeapOrder order;                       // order of numeric heaps
+
+    // handles (`NULL` if disabled)
+    vt_vec_t *handles;                              // handle of each element in heap order
+    vt_vec_t *positions;                            // heap position of each handle, VT_HEAP_NO_HANDLE if released
+    vt_vec_t *free_handles;                         // released handles
+} vt_heap_t;
+
+/** Allocates and creates an empty heap
+    @param n number of elements to make room for
+    @param elsize element size
+    @param cmp comparator: negative if `a` is to be popped before `b`, positive if after, 0 if either
+    @param alloctr allocator instance
+
+    @returns `vt_heap_t*`
+
+    @note a qsort-like comparator gives a min-heap
+    @note if `alloctr = NULL` is specified, then vt_calloc/realloc/free is used
+*/
+extern vt_heap_t *vt_heap_create(const size_t n, const size_t elsize, int32_t (*cmp)(const void *a, const void *b), struct VitaBaseAllocatorType *const alloctr);
+
+/** Allocates and creates an empty heap of numbers, compared without a comparator
+    @param n number of elements to make room for
+    @param order VT_HEAP_ORDER_MIN or VT_HEAP_ORDER_MAX
+    @param alloctr allocator instance
+
+    @returns `vt_heap_t*`
+*/
+#define VT_PROTOTYPE_HEAP_CREATE(T, t) extern vt_heap_t *vt_heap_create##t(const size_t n, const enum VitaHeapOrder order, struct VitaBaseAllocatorType *const alloctr)
+VT_PROTOTYPE_HEAP_CREATE(int8_t, i8);
+VT_PROTOTYPE_HEAP_CREATE(uint8_t, u8);
+VT_PROTOTYPE_HEAP_CREATE(int16_t, i16);
+VT_PROTOTYPE_HEAP_CREATE(uint16_t, u16);
+VT_PROTOTYPE_HEAP_CREATE(int32_t, i32);
+VT_PROTOTYPE_HEAP_CREATE(uint32_t, u32);
+VT_PROTOTYPE_HEAP_CREATE(int64_t, i64);
+VT_PROTOTYPE_HEAP_CREATE(uint64_t, u64);
+VT_PROTOTYPE_HEAP_CREATE(float, f);
+VT_PROTOTYPE_HEAP_CREATE(double, d);
+VT_PROTOTYPE_HEAP_CREATE(real, r);
+#undef VT_PROTOTYPE_HEAP_CREATE
+
+/** Destroys the heap
+    @param heap vt_heap_t instance
+*/
+extern void vt_heap_destroy(vt_heap_t *heap);
+
+/** Returns the number of elements
+    @param heap vt_heap_t instance
+    @returns size_t
+*/
+extern size_t vt_heap_len(const vt_heap_t *const heap);
+
+/** Checks if the heap is empty
+    @param heap vt_heap_t instance
+    @returns `true` if there are no elements
+*/
+extern bool vt_heap_is_empty(const vt_heap_t *const heap);
+
+/** Removes all elements, the capacity is kept
+    @param heap vt_heap_t instance
+    @note all handles are released
+*/
+extern void vt_heap_clear(vt_heap_t *const heap);
+
+/** Reserves memory for additional n elements
+    @param heap vt_heap_t instance
+    @param n number of elements
+*/
+extern void vt_heap_reserve(vt_heap_t *const heap, const size_t n);
+
+/** Enables handles: elements get a handle upon insertion, see vt_heap_update and vt_heap_remove
+    @param heap vt_heap_t instance, must be empty
+
+    @note keeping handles up to date makes sifting slower, so they are disabled by default
+*/
+extern void vt_heap_enable_handles(vt_heap_t *const heap);
+
+/** Inserts an element
+    @param heap vt_heap_t instance
+    @param val value
+    @returns handle of the element, VT_HEAP_NO_HANDLE if handles are disabled
+*/
+extern size_t vt_heap_push(vt_heap_t *const heap, const void *const val);
+
+/** Inserts an element
+    @param heap vt_heap_t instance
+    @param val value
+    @returns handle of the element, VT_HEAP_NO_HANDLE if handles are disabled
+*/
+#define VT_PROTOTYPE_HEAP_PUSH(T, t) extern size_t vt_heap_push##t(vt_heap_t *const heap, const T val)
+VT_PROTOTYPE_HEAP_PUSH(int8_t, i8);
+VT_PROTOTYPE_HEAP_PUSH(uint8_t, u8);
+VT_PROTOTYPE_HEAP_PUSH(int16_t, i16);
+VT_PROTOTYPE_HEAP_PUSH(uint16_t, u16);
+VT_PROTOTYPE_HEAP_PUSH(int32_t, i32);
+VT_PROTOTYPE_HEAP_PUSH(uint32_t, u32);
+VT_PROTOTYPE_HEAP_PUSH(int64_t, i64);
+VT_PROTOTYPE_HEAP_PUSH(uint64_t, u64);
+VT_PROTOTYPE_HEAP_PUSH(float, f);
+VT_PROTOTYPE_HEAP_PUSH(double, d);
+VT_PROTOTYPE_HEAP_PUSH(real, r);
+#undef VT_PROTOTYPE_HEAP_PUSH
+
+/** Returns the top element
+    @param heap vt_heap_t instance
+    @returns void* if len > 0 else NULL
+*/
+extern void *vt_heap_peek(const vt_heap_t *const heap);
+
+/** Returns the top element
+    @param heap vt_heap_t instance
+    @returns element of type T if len > 0 else 0
+*/
+#define VT_PROTOTYPE_HEAP_PEEK(T, t) extern T vt_heap_peek##t(const vt_heap_t *const heap)
+VT_PROTOTYPE_HEAP_PEEK(int8_t, i8);
+VT_PROTOTYPE_HEAP_PEEK(uint8_t, u8);
+VT_PROTOTYPE_HEAP_PEEK(int16_t, i16);
+VT_PROTOTYPE_HEAP_PEEK(uint16_t, u16);
+VT_PROTOTYPE_HEAP_PEEK(int32_t, i32);
+VT_PROTOTYPE_HEAP_PEEK(uint32_t, u32);
+VT_PROTOTYPE_HEAP_PEEK(int64_t, i64);
+VT_PROTOTYPE_HEAP_PEEK(uint64_t, u64);
+VT_PROTOTYPE_HEAP_PEEK(float, f);
+VT_PROTOTYPE_HEAP_PEEK(double, d);
+VT_PROTOTYPE_HEAP_PEEK(real, r);
+#undef VT_PROTOTYPE_HEAP_PEEK
+
+/** Removes the top element
+    @param heap vt_heap_t instance
+*/
+extern void vt_heap_pop(vt_heap_t *const heap);
+
+/** Removes the top element and returns it
+    @param heap vt_heap_t instance
+    @returns void* if len > 0 else NULL
+
+    @note the pointer is valid until the next insertion
+*/
+extern void *vt_heap_pop_get(vt_heap_t *const heap);
+
+/** Removes the top element and returns it
+    @param heap vt_heap_t instance
+    @returns element of type T if len > 0 else 0
+*/
+#define VT_PROTOTYPE_HEAP_POP_GET(T, t) extern T vt_heap_pop_get##t(vt_heap_t *const heap)
+VT_PROTOTYPE_HEAP_POP_GET(int8_t, i8);
+VT_PROTOTYPE_HEAP_POP_GET(uint8_t, u8);
+VT_PROTOTYPE_HEAP_POP_GET(int16_t, i16);
+VT_PROTOTYPE_HEAP_POP_GET(uint16_t, u16);
+VT_PROTOTYPE_HEAP_POP_GET(int32_t, i32);
+VT_PROTOTYPE_HEAP_POP_GET(uint32_t, u32);
+VT_PROTOTYPE_HEAP_POP_GET(int64_t, i64);
+VT_PROTOTYPE_HEAP_POP_GET(uint64_t, u64);
+VT_PROTOTYPE_HEAP_POP_GET(float, f);
+VT_PROTOTYPE_HEAP_POP_GET(double, d);
+VT_PROTOTYPE_HEAP_POP_GET(real, r);
+#undef VT_PROTOTYPE_HEAP_POP_GET
+
+/** Replaces the top element with a new one, faster than pop followed by push
+    @param heap vt_heap_t instance, must not be empty
+    @param val value
+    @returns handle of the new element, VT_HEAP_NO_HANDLE if handles are disabled
+*/
+extern size_t vt_heap_replace(vt_heap_t *const heap, const void *const val);
+
+/** Replaces the contents with the elements of a vector and restores the heap order in O(n)
+    @param heap vt_heap_t instance
+    @param v vt_vec_t instance with the same element size
+
+    @note if handles are enabled, the handle of an element is its index in the vector
+*/
+extern void vt_heap_heapify(vt_heap_t *const heap, const vt_vec_t *const v);
+
+/** Returns the element of a handle
+    @param heap vt_heap_t instance with handles enabled
+    @param handle element handle
+    @returns pointer to the element, valid until the heap is modified
+*/
+extern void *vt_heap_get(const vt_heap_t *const heap, const size_t handle);
+
+/** Assigns a new value to an element and moves it to its place (decrease-key or increase-key)
+    @param heap vt_heap_t instance with handles enabled
+    @param handle element handle
+    @param val value
+*/
+extern void vt_heap_update(vt_heap_t *const heap, const size_t handle, const void *const val);
+
+/** Removes an element
+    @param heap vt_heap_t instance with handles enabled
+    @param handle element handle
+*/
+extern void vt_heap_remove(vt_heap_t *const heap, const size_t handle);
+
+#endif // VITA_CONTAINER_HEAP_H
@@ -0,0 +1,160 @@
+#ifndef VITA_CONTAINER_INTERN_H
+#define VITA_CONTAINER_INTERN_H
+
+/** INTERN MODULE (string interning pool)
+ * Maps string contents to a single canonical, immutable vt_str_t. Interning the same contents twice returns
+ * the same pointer, so interned strings are compared by pointer and stored once, however many times they occur.
+ * Canonical strings are copied into an arena owned by the pool (header and characters in one allocation) and
+ * live until the pool is cleared or destroyed. Lookups go through an open-addressing hash table.
+
+ * Functions
+    - vt_intern_create
+    - vt_intern_destroy
+    - vt_intern_clear
+    - vt_intern_len
+    - vt_intern
+    - vt_intern_n
+    - vt_intern_str
+    - vt_intern_view
+    - vt_intern_find_n
+    - vt_intern_split
+    - vt_intern_hit_rate
+
+ * Usage
+    vt_intern_t *in = vt_intern_create(NULL);
+    const vt_str_t *a = vt_intern(in, "user_id");
+    const vt_str_t *b = vt_intern_n(in, "user_id,name", 7);
+    assert(a == b);
+
+    // tokens of each line are canonical strings, no allocation per token
+    vt_plist_t *fields = vt_intern_split(in, NULL, line, ",");
+    // ...
+    vt_plist_destroy(fields);
+    vt_intern_destroy(in);
+*/
+
+#include "vita/container/common.h"
+#include "vita/container/str.h"
+#include "vita/container/strview.h"
+#include "vita/container/plist.h"
+#include "vita/allocator/arena.h"
+#include "vita/algorithm/hash.h"
+
+// constants
+#define VT_INTERN_INIT_CAPACITY 64
+#define VT_INTERN_CHUNK_SIZE VT_ARENA_DEFAULT_CHUNK_SIZE
+
+// table slot, empty if str is `NULL`
+struct VitaInternSlot {
+    uint64_t hash;
+    const vt_str_t *str;
+};
+
+// interning statistics
+struct VitaInternStats {
+    size_t count_lookups;   // number of strings interned
+    size_t count_hits;      // how many of them were already in the pool
+    size_t bytes_stored;    // characters copied into the pool
+    size_t bytes_saved;     // characters not copied thanks to hits
+};
+
+// string interning pool
+typedef struct VitaIntern {
+    struct VitaBaseAllocatorType *alloctr;  // allocator for the pool, its table and arena chunks, `NULL` for the default one
+    vt_arena_t *arena;                      // canonical strings
+    struct VitaInternSlot *slots;           // hash table
+    size_t capacity;                        // number of slots, power of 2
+    size_t len;                             // number of canonical strings
+    struct VitaInternStats stats;           // statistics since the last clear
+} vt_intern_t;
+
+/** Allocates and creates an empty interning pool
+    @param alloctr allocator instance
+    @returns `vt_intern_t*`
+
+    @note if `NULL` is specified, then vita calloc/realloc/free is used
+*/
+extern vt_intern_t *vt_intern_create(struct VitaBaseAllocatorType *const alloctr);
+
+/** Frees all canonical strings and destroys the pool
+    @param in vt_intern_t instance
+*/
+extern void vt_intern_destroy(vt_intern_t *in);
+
+/** Frees all canonical strings and resets statistics, the pool stays usable
+    @param in vt_intern_t instance
+
+    @note pointers returned before are invalidated
+*/
+extern void vt_intern_clear(vt_intern_t *const in);
+
+/** Returns the number of canonical strings
+    @param in vt_intern_t instance
+    @returns size_t
+*/
+extern size_t vt_intern_len(const vt_intern_t *const in);
+
+/** Interns a string
+    @param in vt_intern_t instance
+    @param z zero-terminated string
+    @returns canonical `vt_str_t*`, the same for the same contents
+*/
+extern const vt_str_t *vt_intern(vt_intern_t *const in, const char *const z);
+
+/** Interns n characters
+    @param in vt_intern_t instance
+    @param z string
+    @param n number of characters
+
+    @returns canonical `vt_str_t*`, the same for the same contents
+
+    @note canonical strings are views: zero-terminated, owned by the pool; do not modify, nor destroy them
+*/
+extern const vt_str_t *vt_intern_n(vt_intern_t *const in, const char *const z, const size_t n);
+
+/** Interns the contents of a vt_str_t
+    @param in vt_intern_t instance
+    @param s vt_str_t instance
+    @returns canonical `vt_str_t*`, the same for the same contents
+
+    @note `s` is not referenced after the call, e.g., the results of vt_str_split can be destroyed
+*/
+extern const vt_str_t *vt_intern_str(vt_intern_t *const in, const vt_str_t *const s);
+
+/** Interns the contents of a vt_strview_t
+    @param in vt_intern_t instance
+    @param sv vt_strview_t instance
+    @returns canonical `vt_str_t*`, the same for the same contents
+*/
+extern const vt_str_t *vt_intern_view(vt_intern_t *const in, const vt_strview_t sv);
+
+/** Looks up n characters without interning them
+    @param in vt_intern_t instance
+    @param z string
+    @param n number of characters
+
+    @returns canonical `vt_str_t*`, or `NULL` if not found
+
+    @note statistics are not updated
+*/
+extern const vt_str_t *vt_intern_find_n(const vt_intern_t *const in, const char *const z, const size_t n);
+
+/** Splits a string given a separator and interns the substrings
+    @param in vt_intern_t instance
+    @param ps vt_plist_t instance, if `NULL` allocates; it is cleared
+    @param s vt_str_t instance
+    @param sep seperator string
+
+    @returns `vt_plist_t` of canonical `vt_str_t*`
+
+    @note tokens are the same as of vt_strview_split, no string is allocated per token; do not destroy them
+*/
+extern vt_plist_t *vt_intern_split(vt_intern_t *const in, vt_plist_t *ps, const vt_str_t *const s, const char *const sep);
+
+/** Returns the share of lookups that found the string already in the pool
+    @param in vt_intern_t instance
+    @returns hit rate in [0, 1], 0 if nothing was interned
+*/
+extern double vt_intern_hit_rate(const vt_intern_t *const in);
+
+#endif // VITA_CONTAINER_INTERN_H
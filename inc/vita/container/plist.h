@@ -8,6 +8,7 @@
     - vt_plist_capacity
     - vt_plist_has_space
     - vt_plist_is_empty
+    - vt_plist_set_growth_policy
     - vt_plist_reserve
     - vt_plist_shrink
     - vt_plist_clear
@@ -84,6 +85,12 @@ extern size_t vt_plist_has_space(const vt_plist_t *const p);
 */
 extern bool vt_plist_is_empty(const vt_plist_t *const p);
 
+/** Sets the growth policy used when vt_plist_t runs out of space
+    @param p vt_plist_t instance
+    @param policy growth policy (VT_GROWTH_POLICY_DEFAULT by default)
+*/
+extern void vt_plist_set_growth_policy(vt_plist_t *const p, const enum VitaGrowthPolicy policy);
+
 /** Reserves additional memory of n elements
     @param p vt_plist_t pointer
     @param n number of elements
@@ -14,6 +14,8 @@
     - vt_str_capacity
     - vt_str_has_space
     - vt_str_is_empty
+    - vt_str_is_sso
+    - vt_str_set_growth_policy
     - vt_str_validate_len
     - vt_str_shrink
     - vt_str_clear
@@ -26,6 +28,10 @@
     - vt_str_append
     - vt_str_appendf
     - vt_str_append_n
+    - vt_str_append_i64
+    - vt_str_append_u64
+    - vt_str_append_hex
+    - vt_str_append_f64
     - vt_str_insert
     - vt_str_insertf
     - vt_str_insert_n
@@ -63,13 +69,26 @@
 */
 
 #include <ctype.h>
+#include <float.h>
 #include <stdarg.h>
 #include "vita/container/common.h"
 #include "vita/container/plist.h"
+#include "vita/algorithm/search.h"
+#include "vita/algorithm/ascii.h"
 
 // temporary buffer size
 #define VT_STR_TMP_BUFFER_SIZE 1024
 
+// typed appends: buffer size for the text of a single number and the highest precision formatted without printf
+#define VT_STR_TYPED_BUFFER_SIZE 48
+#define VT_STR_F64_MAX_PRECISION 15
+
+// character sets are applied to strings shorter than this one byte at a time, without building a vt_ascii_set_t or dispatching to SIMD
+#define VT_STR_SHORT_LEN 32
+
+// strings with capacity up to VT_STR_SSO_CAPACITY are stored inline, right after the vt_str_t header (small-string optimization)
+#define VT_STR_SSO_CAPACITY 23
+
 // see core/core.h for definition
 typedef struct VitaBaseArrayType vt_str_t;
 
@@ -164,6 +183,18 @@ extern size_t vt_str_has_space(const vt_str_t *const s);
 */
 extern bool vt_str_is_empty(const vt_str_t *const s);
 
+/** Checks if string data is stored inline (small-string optimization)
+    @param s vt_str_t instance
+    @returns `true` if capacity <= VT_STR_SSO_CAPACITY and the data lives in the same allocation as the header
+*/
+extern bool vt_str_is_sso(const vt_str_t *const s);
+
+/** Sets the growth policy used when vt_str_t runs out of space
+    @param s vt_str_t instance
+    @param policy growth policy (VT_GROWTH_POLICY_EXACT by default)
+*/
+extern void vt_str_set_growth_policy(vt_str_t *const s, const enum VitaGrowthPolicy policy);
+
 /** Validates string length
     @param s vt_str_t instance
     @returns valid string length
@@ -251,6 +282,34 @@ extern enum VitaStatus vt_str_appendf(vt_str_t *const s, const char *const fmt,
 */
 extern void vt_str_append_n(vt_str_t *const s, const char *z, const size_t n);
 
+/** Appends a signed integer in decimal, same as "%" PRId64, without parsing a format
+    @param s vt_str_t instance
+    @param v value
+*/
+extern void vt_str_append_i64(vt_str_t *const s, const int64_t v);
+
+/** Appends an unsigned integer in decimal, same as "%" PRIu64, without parsing a format
+    @param s vt_str_t instance
+    @param v value
+*/
+extern void vt_str_append_u64(vt_str_t *const s, const uint64_t v);
+
+/** Appends an unsigned integer in lowercase hex without a prefix, same as "%" PRIx64, without parsing a format
+    @param s vt_str_t instance
+    @param v value
+*/
+extern void vt_str_append_hex(vt_str_t *const s, uint64_t v);
+
+/** Appends a double with a fixed number of decimals, same as "%.*f"
+    @param s vt_str_t instance
+    @param v value
+    @param precision number of digits after the decimal point
+
+    @note values below 1e15 (after scaling) with precision up to VT_STR_F64_MAX_PRECISION do not go through printf;
+          halfway cases, larger values, inf and nan fall back to it, so the output is always identical
+*/
+extern void vt_str_append_f64(vt_str_t *const s, const double v, const size_t precision);
+
 /** Inserts a raw C string into vt_str_t starting at the specified index
     @param s vt_str_t instance
     @param z raw C string
@@ -399,6 +458,8 @@ extern size_t vt_str_can_find(const vt_str_t *const s, const char *sub);
     @param sep seperator string
 
     @returns `vt_plist_t` of `vt_str_t*`, `NULL` upon failure
+
+    @note see vt_strview_split for a version that does not allocate strings
 */
 extern vt_plist_t *vt_str_split(vt_plist_t *ps, const vt_str_t *const s, const char *const sep);
 
@@ -509,12 +570,12 @@ extern bool vt_str_is_numeric(const vt_str_t *const s);
 */
 extern bool vt_str_is_numeric_z(const char *const z, const size_t len);
 
-/** Converts characters to uppercase
+/** Converts ASCII characters to uppercase
     @param s vt_str_t
 */
 extern void vt_str_to_uppercase(vt_str_t *const s);
 
-/** Converts characters to lowercase
+/** Converts ASCII characters to lowercase
     @param s vt_str_t
 */
 extern void vt_str_to_lowercase(vt_str_t *const s);
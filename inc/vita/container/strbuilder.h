@@ -0,0 +1,163 @@
+#ifndef VITA_CONTAINER_STRBUILDER_H
+#define VITA_CONTAINER_STRBUILDER_H
+
+/** STRBUILDER MODULE (rope)
+ * A string builder for assembling large strings piece by piece. Text is kept in chunks that are never
+ * copied once written: appends fill the last chunk, insertions in the middle split a chunk and link a
+ * new one in. Chunks are ordered by a treap keyed by position, so locating an index takes O(log n).
+ * The result is copied once, when flattened with vt_strbuilder_to_str, or written out chunk by chunk.
+
+ * Functions
+    - vt_strbuilder_create
+    - vt_strbuilder_destroy
+    - vt_strbuilder_len
+    - vt_strbuilder_count_chunks
+    - vt_strbuilder_clear
+    - vt_strbuilder_append
+    - vt_strbuilder_append_n
+    - vt_strbuilder_appendf
+    - vt_strbuilder_insert
+    - vt_strbuilder_insert_n
+    - vt_strbuilder_get
+    - vt_strbuilder_apply
+    - vt_strbuilder_write
+    - vt_strbuilder_to_str
+
+ * Usage
+    vt_strbuilder_t *sb = vt_strbuilder_create(NULL);
+    VT_FOREACH(i, 0, 100000) {
+        vt_strbuilder_appendf(sb, "%zu,", i);
+    }
+    vt_strbuilder_insert(sb, "[", 0);
+    vt_str_t *s = vt_strbuilder_to_str(sb, NULL);
+    vt_strbuilder_destroy(sb);
+*/
+
+#include <stdio.h>
+#include <stdarg.h>
+#include "vita/container/common.h"
+#include "vita/container/str.h"
+
+// constants
+#define VT_STRBUILDER_CHUNK_SIZE 4096
+
+// chunk of text, also a treap node
+struct VitaStrBuilderChunk {
+    struct VitaStrBuilderChunk *left;   // chunks before this one
+    struct VitaStrBuilderChunk *right;  // chunks after this one
+    size_t size;                        // total length of the subtree
+    size_t len;                         // bytes used
+    size_t capacity;                    // bytes available
+    uint32_t priority;                  // treap priority, not less than the children's
+    char data[];                        // chunk text, not zero-terminated
+};
+
+// string builder
+typedef struct VitaStrBuilder {
+    struct VitaBaseAllocatorType *alloctr;  // allocator, `NULL` for the default one
+    struct VitaStrBuilderChunk *root;       // chunks in text order, except the tail
+    struct VitaStrBuilderChunk *tail;       // last chunk, appends go here until it is full
+    size_t count_chunks;                    // number of chunks
+    uint32_t seed;                          // priority generator state
+} vt_strbuilder_t;
+
+/** Allocates and creates an empty vt_strbuilder_t
+    @param alloctr allocator instance
+    @returns `vt_strbuilder_t*`
+
+    @note if `NULL` is specified, then vita calloc/realloc/free is used
+*/
+extern vt_strbuilder_t *vt_strbuilder_create(struct VitaBaseAllocatorType *const alloctr);
+
+/** Frees all chunks and destroys the vt_strbuilder_t
+    @param sb vt_strbuilder_t instance
+*/
+extern void vt_strbuilder_destroy(vt_strbuilder_t *sb);
+
+/** Returns the total length
+    @param sb vt_strbuilder_t instance
+    @returns size_t
+*/
+extern size_t vt_strbuilder_len(const vt_strbuilder_t *const sb);
+
+/** Returns the number of chunks
+    @param sb vt_strbuilder_t instance
+    @returns size_t
+*/
+extern size_t vt_strbuilder_count_chunks(const vt_strbuilder_t *const sb);
+
+/** Frees all chunks, the builder stays usable
+    @param sb vt_strbuilder_t instance
+*/
+extern void vt_strbuilder_clear(vt_strbuilder_t *const sb);
+
+/** Appends a string at the end
+    @param sb vt_strbuilder_t instance
+    @param z zero-terminated string
+*/
+extern void vt_strbuilder_append(vt_strbuilder_t *const sb, const char *const z);
+
+/** Appends n characters at the end
+    @param sb vt_strbuilder_t instance
+    @param z string
+    @param n number of characters
+*/
+extern void vt_strbuilder_append_n(vt_strbuilder_t *const sb, const char *const z, const size_t n);
+
+/** Appends a formatted string at the end
+    @param sb vt_strbuilder_t instance
+    @param fmt format string
+    @param ... arguments
+
+    @returns `VT_STATUS_OPERATION_SUCCESS` upon success
+*/
+extern enum VitaStatus vt_strbuilder_appendf(vt_strbuilder_t *const sb, const char *const fmt, ...);
+
+/** Inserts a string at an index
+    @param sb vt_strbuilder_t instance
+    @param z zero-terminated string
+    @param at index, not greater than length
+*/
+extern void vt_strbuilder_insert(vt_strbuilder_t *const sb, const char *const z, const size_t at);
+
+/** Inserts n characters at an index
+    @param sb vt_strbuilder_t instance
+    @param z string
+    @param at index, not greater than length
+    @param n number of characters
+
+    @note O(log n) expected to locate the chunk, the characters are copied once
+*/
+extern void vt_strbuilder_insert_n(vt_strbuilder_t *const sb, const char *const z, const size_t at, const size_t n);
+
+/** Returns character at index
+    @param sb vt_strbuilder_t instance
+    @param at index
+    @returns char
+*/
+extern char vt_strbuilder_get(const vt_strbuilder_t *const sb, const size_t at);
+
+/** Calls a function on every chunk in text order
+    @param sb vt_strbuilder_t instance
+    @param func function to call with chunk data, chunk length and `user`
+    @param user user data
+*/
+extern void vt_strbuilder_apply(const vt_strbuilder_t *const sb, void (*func)(const char*, size_t, void*), void *const user);
+
+/** Writes the text to a file chunk by chunk, without flattening it
+    @param sb vt_strbuilder_t instance
+    @param fp file stream
+    @returns `true` upon success
+*/
+extern bool vt_strbuilder_write(const vt_strbuilder_t *const sb, FILE *const fp);
+
+/** Copies the text into a vt_str_t
+    @param sb vt_strbuilder_t instance
+    @param alloctr allocator instance for the string
+    @returns `vt_str_t*`
+
+    @note the builder is left unchanged
+*/
+extern vt_str_t *vt_strbuilder_to_str(const vt_strbuilder_t *const sb, struct VitaBaseAllocatorType *const alloctr);
+
+#endif // VITA_CONTAINER_STRBUILDER_H
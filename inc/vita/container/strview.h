@@ -0,0 +1,214 @@
+#ifndef VITA_CONTAINER_STRVIEW_H
+#define VITA_CONTAINER_STRVIEW_H
+
+/** STRVIEW MODULE (view)
+    - vt_strview_from
+    - vt_strview_from_z
+    - vt_strview_from_str
+    - vt_strview_len
+    - vt_strview_is_empty
+    - vt_strview_get
+    - vt_strview_slice
+    - vt_strview_strip
+    - vt_strview_find
+    - vt_strview_find_last
+    - vt_strview_can_find
+    - vt_strview_index_of
+    - vt_strview_index_find
+    - vt_strview_equals
+    - vt_strview_equals_z
+    - vt_strview_starts_with
+    - vt_strview_ends_with
+    - vt_strview_is_numeric
+    - vt_strview_split
+    - vt_strview_split_iter
+    - vt_strview_split_next
+
+ * Usage
+    char buf[1024];
+    const int32_t n = vt_socket_receive(sock, buf, sizeof(buf));
+    vt_strview_t request = vt_strview_from(buf, n);
+    if (vt_strview_starts_with(request, "GET ")) {
+        // ...
+    }
+*/
+
+#include "vita/container/common.h"
+#include "vita/container/vec.h"
+#include "vita/container/str.h"
+
+// A read-only reference to a sequence of chars: pointer and length, not zero-terminated.
+// It never allocates, nor deallocates anything; the referenced data must outlive the view.
+typedef struct VitaStrView {
+    const char *ptr;
+    size_t len;
+} vt_strview_t;
+
+// lazy split state, see vt_strview_split_iter
+typedef struct VitaStrViewSplitIter {
+    vt_strview_t rest;  // part of the string not yet split
+    const char *sep;    // separator
+    size_t sepLen;      // separator length
+    bool done;          // no more tokens
+} vt_strview_split_iter_t;
+
+/** Creates a view from raw data
+    @param ptr data
+    @param len data length
+    @returns vt_strview_t
+*/
+extern vt_strview_t vt_strview_from(const char *const ptr, const size_t len);
+
+/** Creates a view from a zero-terminated string
+    @param z zero-terminated string
+    @returns vt_strview_t
+*/
+extern vt_strview_t vt_strview_from_z(const char *const z);
+
+/** Creates a view of vt_str_t contents
+    @param s vt_str_t instance
+    @returns vt_strview_t
+
+    @note the view is invalidated once `s` is modified
+*/
+extern vt_strview_t vt_strview_from_str(const vt_str_t *const s);
+
+/** Returns vt_strview_t length
+    @param sv vt_strview_t instance
+    @returns size_t
+*/
+extern size_t vt_strview_len(const vt_strview_t sv);
+
+/** Checks if vt_strview_t is empty
+    @param sv vt_strview_t instance
+    @returns `true` if length is 0
+*/
+extern bool vt_strview_is_empty(const vt_strview_t sv);
+
+/** Returns char at index
+    @param sv vt_strview_t instance
+    @param at index
+    @returns char
+*/
+extern char vt_strview_get(const vt_strview_t sv, const size_t at);
+
+/** Creates a view of the range [from; to)
+    @param sv vt_strview_t instance
+    @param from start index
+    @param to end index, not included
+    @returns vt_strview_t
+*/
+extern vt_strview_t vt_strview_slice(const vt_strview_t sv, const size_t from, const size_t to);
+
+/** Creates a view without leading and trailing whitespace
+    @param sv vt_strview_t instance
+    @returns vt_strview_t
+*/
+extern vt_strview_t vt_strview_strip(const vt_strview_t sv);
+
+/** Finds the first occurrence of a substring
+    @param sv vt_strview_t haystack
+    @param sub substring needle
+    @returns pointer to the substring in the viewed data, `NULL` if not found
+*/
+extern const char *vt_strview_find(const vt_strview_t sv, const char *const sub);
+
+/** Finds the last occurrence of a substring
+    @param sv vt_strview_t haystack
+    @param sub substring needle
+    @returns pointer to the substring in the viewed data, `NULL` if not found
+*/
+extern const char *vt_strview_find_last(const vt_strview_t sv, const char *const sub);
+
+/** Counts non-overlapping occurrences of a substring
+    @param sv vt_strview_t haystack
+    @param sub substring needle
+    @returns number of substring instances (needles) in haystack
+*/
+extern size_t vt_strview_can_find(const vt_strview_t sv, const char *const sub);
+
+/** Returns index of the first occurrence of a character
+    @param sv vt_strview_t instance
+    @param c character
+    @returns index, -1 if not found
+*/
+extern int64_t vt_strview_index_of(const vt_strview_t sv, const char c);
+
+/** Returns index of the first occurrence of a substring
+    @param sv vt_strview_t instance
+    @param sub substring
+    @returns index, -1 if not found
+*/
+extern int64_t vt_strview_index_find(const vt_strview_t sv, const char *const sub);
+
+/** Checks if two views are equal
+    @param sv1 vt_strview_t instance
+    @param sv2 vt_strview_t instance
+    @returns `true` if the contents are equal
+*/
+extern bool vt_strview_equals(const vt_strview_t sv1, const vt_strview_t sv2);
+
+/** Checks if a view is equal to a zero-terminated string
+    @param sv vt_strview_t instance
+    @param z zero-terminated string
+    @returns `true` if the contents are equal
+*/
+extern bool vt_strview_equals_z(const vt_strview_t sv, const char *const z);
+
+/** Checks if a view starts with a substring
+    @param sv vt_strview_t instance
+    @param sub substring
+    @returns `true` if it does
+*/
+extern bool vt_strview_starts_with(const vt_strview_t sv, const char *const sub);
+
+/** Checks if a view ends with a substring
+    @param sv vt_strview_t instance
+    @param sub substring
+    @returns `true` if it does
+*/
+extern bool vt_strview_ends_with(const vt_strview_t sv, const char *const sub);
+
+/** Checks if a view contains a numeric value (digits and '.')
+    @param sv vt_strview_t instance
+    @returns `true` if it does, `false` if not or empty
+*/
+extern bool vt_strview_is_numeric(const vt_strview_t sv);
+
+/** Splits a view given a separator into views of the original data, no strings are allocated
+    @param vs vt_vec_t of vt_strview_t, if `NULL` allocates
+    @param sv vt_strview_t instance
+    @param sep separator string
+
+    @returns `vt_vec_t` of `vt_strview_t`, `NULL` upon failure
+
+    @note empty tokens are skipped, like in vt_str_split
+*/
+extern vt_vec_t *vt_strview_split(vt_vec_t *vs, const vt_strview_t sv, const char *const sep);
+
+/** Creates a lazy split iterator, tokens are produced one by one with vt_strview_split_next
+    @param sv vt_strview_t instance
+    @param sep separator string, must outlive the iterator
+
+    @returns vt_strview_split_iter_t
+
+    @note usage:
+        vt_strview_t token;
+        vt_strview_split_iter_t it = vt_strview_split_iter(vt_strview_from_z("a,b,,c"), ",");
+        while (vt_strview_split_next(&it, &token)) {
+            // "a", "b", "c"
+        }
+*/
+extern vt_strview_split_iter_t vt_strview_split_iter(const vt_strview_t sv, const char *const sep);
+
+/** Produces the next token
+    @param it vt_strview_split_iter_t instance
+    @param token next token
+
+    @returns `false` if there are no more tokens
+
+    @note empty tokens are skipped, like in vt_str_split
+*/
+extern bool vt_strview_split_next(vt_strview_split_iter_t *const it, vt_strview_t *const token);
+
+#endif // VITA_CONTAINER_STRVIEW_H
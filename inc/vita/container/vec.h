@@ -3,11 +3,13 @@
 
 /** VEC MODULE (dynamic array)
     - vt_vec_create
+    - vt_vec_create_aligned
     - vt_vec_destroy
     - vt_vec_len
     - vt_vec_capacity
     - vt_vec_has_space
     - vt_vec_is_empty
+    - vt_vec_set_growth_policy
     - vt_vec_shrink
     - vt_vec_clear
     - vt_vec_reserve
@@ -47,6 +49,18 @@ typedef struct VitaBaseArrayType vt_vec_t;
 */
 extern vt_vec_t *vt_vec_create(const size_t n, const size_t elsize, struct VitaBaseAllocatorType *const alloctr);
 
+/** Allocates and constructs vt_vec_t with an aligned buffer (e.g., for SIMD)
+    @param n number of elements
+    @param elsize element size
+    @param alignment buffer alignment (power of 2)
+    @param alloctr allocator instance
+
+    @returns `vt_vec_t*` upon success, `NULL` otherwise
+
+    @note alloctr must not be `NULL`: the allocator keeps the buffer aligned when the vector grows
+*/
+extern vt_vec_t *vt_vec_create_aligned(const size_t n, const size_t elsize, const size_t alignment, struct VitaBaseAllocatorType *const alloctr);
+
 /** Deallocates and destroys vt_vec_t
     @param v vt_vec_t pointer
 */
@@ -86,6 +100,12 @@ extern size_t vt_vec_has_space(const vt_vec_t *const v);
 */
 extern bool vt_vec_is_empty(const vt_vec_t *const v);
 
+/** Sets the growth policy used when vt_vec_t runs out of space
+    @param v vt_vec_t instance
+    @param policy growth policy (VT_GROWTH_POLICY_DEFAULT by default)
+*/
+extern void vt_vec_set_growth_policy(vt_vec_t *const v, const enum VitaGrowthPolicy policy);
+
 /** Shrinks vt_vec_t capacity to its length
     @param v vt_vec_t instance
 */
@@ -9,6 +9,8 @@
     - VT_CALLOC
     - VT_REALLOC
     - VT_FREE
+    - VT_CALLOC_ALIGNED
+    - VT_FREE_ALIGNED
     - VT_PCAT
     - VT_STRING_OF
     - VT_AS
@@ -18,8 +20,11 @@
     - vt_calloc
     - vt_realloc
     - vt_free
+    - vt_calloc_aligned
+    - vt_free_aligned
     - vt_gswap
     - vt_status_to_str
+    - vt_cpu_simd_level
 */
 
 #include <stdio.h>
@@ -47,10 +52,14 @@
 #define VT_CALLOC(bytes) vt_calloc(bytes, __SOURCE_FILENAME__, __func__, __LINE__)
 #define VT_REALLOC(ptr, bytes) vt_realloc(ptr, bytes, __SOURCE_FILENAME__, __func__, __LINE__)
 #define VT_FREE(ptr) vt_free(ptr)
+#define VT_CALLOC_ALIGNED(bytes, alignment) vt_calloc_aligned(bytes, alignment, __SOURCE_FILENAME__, __func__, __LINE__)
+#define VT_FREE_ALIGNED(ptr) vt_free_aligned(ptr)
 
 // constants
 #define VT_ARRAY_DEFAULT_INIT_ELEMENTS 16
 #define VT_ARRAY_DEFAULT_GROWTH_RATE 2
+#define VT_ARRAY_GROWTH_CHUNK_BYTES (1024 * 1024)
+#define VT_ARRAY_GROWTH_CAP_BYTES (64 * 1024 * 1024)
 
 // this is needed in order to properly expand macros if one macro is inserted into another
 #define VT_i_PCAT_NX(x, y) x ## y           // preprocessor concatenation
@@ -185,6 +194,25 @@ extern void *vt_realloc(void *ptr, const size_t bytes, const char *const file, c
 */
 extern void vt_free(void *ptr);
 
+/** Allocates aligned memory and initiazes to zero
+    @param bytes amount to allocate
+    @param alignment power of 2
+    @param file `__SOURCE_FILENAME__`
+    @param func `__func__`
+    @param line `__LINE__`
+
+    @returns ptr to allocated memory
+
+    @note exits upon failure
+    @note memory must be freed with vt_free_aligned
+*/
+extern void *vt_calloc_aligned(const size_t bytes, const size_t alignment, const char *const file, const char *const func, const size_t line);
+
+/** Frees memory allocated with vt_calloc_aligned
+    @param ptr pointer to memory
+*/
+extern void vt_free_aligned(void *ptr);
+
 /** Copies data from source to destination memory buffer
     @param dest pointer to destination memory address
     @param src pointer to source memory address
@@ -247,4 +275,9 @@ extern void vt_pswap(void **a, void **b);
 */
 extern const char *vt_status_to_str(const enum VitaStatus e);
 
+/** Checks which SIMD extensions the CPU supports (the result is cached)
+    @returns 2 if AVX-512BW is available, 1 if AVX2 is available, 0 otherwise (or not on x86 with GCC/Clang)
+*/
+extern int8_t vt_cpu_simd_level(void);
+
 #endif // VITA_CORE_H
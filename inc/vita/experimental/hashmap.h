@@ -1,13 +1,213 @@
 #ifndef VITA_CONTAINER_HASHMAP_H
 #define VITA_CONTAINER_HASHMAP_H
 
-/** HASHMAP MODULE
-    - 
+/** HASHMAP MODULE (Robin Hood hashing)
+ * An open-addressing hash map with keys and values stored in place, in one flat array of slots. Keys and values
+ * are fixed-size byte blobs (compared with memcmp), set up like vt_vec_create elements, or keys are strings.
+ * Collisions are resolved by linear probing with Robin Hood ordering: an entry farther from its home slot takes
+ * the place of a closer one, and the rest of the cluster shifts, which keeps probe sequences short even at high
+ * load. Removal shifts the following entries back instead of leaving tombstones. Each slot has 32 bits of
+ * metadata (probe distance and part of the hash), so most mismatching slots are skipped without touching keys.
+
+ * Functions
+    - vt_hashmap_create
+    - vt_hashmap_destroy
+    - vt_hashmap_len
+    - vt_hashmap_capacity
+    - vt_hashmap_is_empty
+    - vt_hashmap_clear
+    - vt_hashmap_reserve
+    - vt_hashmap_set_max_load
+    - vt_hashmap_insert
+    - vt_hashmap_get
+    - vt_hashmap_has
+    - vt_hashmap_remove
+    - vt_hashmap_insert_z
+    - vt_hashmap_get_z
+    - vt_hashmap_remove_z
+    - vt_hashmap_iter
+    - vt_hashmap_next
+
+ * Usage
+    // word count
+    vt_hashmap_t *counts = vt_hashmap_create(1024, VT_HASHMAP_KEY_STR, sizeof(size_t), NULL);
+    const size_t one = 1;
+    while (...) {
+        size_t *count = vt_hashmap_get_z(counts, word);
+        if (count) {
+            (*count)++;
+        } else {
+            vt_hashmap_insert_z(counts, word, &one);
+        }
+    }
+
+    // print
+    const vt_str_t *key;
+    size_t *count;
+    vt_hashmap_iter_t it = vt_hashmap_iter(counts);
+    while (vt_hashmap_next(&it, (const void**)&key, (void**)&count)) {
+        printf("%s: %zu\n", vt_str_z(key), *count);
+    }
+    vt_hashmap_destroy(counts);
 */
 
 #include "vita/container/common.h"
+#include "vita/container/str.h"
+#include "vita/algorithm/hash.h"
 
-//
+// constants
+#define VT_HASHMAP_KEY_STR 0                // key size of maps with vt_str_t keys
+#define VT_HASHMAP_MIN_CAPACITY 8
+#define VT_HASHMAP_DEFAULT_MAX_LOAD 0.875
+#define VT_HASHMAP_MAX_DISTANCE 255         // probe distance limit (up to 255), the map grows when it is reached
 
-#endif // VITA_CONTAINER_HASHMAP_H
+// hash map
+typedef struct VitaHashMap {
+    struct VitaBaseAllocatorType *alloctr;  // allocator, `NULL` for the default one
+    uint32_t *meta;                         // per slot: hash bits above the low 8, probe distance + 1 in the low 8; 0 if empty
+    uint8_t *slots;                         // key and value per slot, followed by a scratch slot
+    size_t len;                             // number of entries
+    size_t capacity;                        // number of slots, power of 2
+    size_t max_len;                         // number of entries that triggers growth
+    double max_load;                        // maximum load factor
+    size_t key_size;                        // key size in bytes, VT_HASHMAP_KEY_STR for vt_str_t keys
+    size_t val_size;                        // value size in bytes
+    size_t val_offset;                      // value offset in a slot
+    size_t slot_size;                       // slot size in bytes
+    uint64_t seed;                          // hash seed
+} vt_hashmap_t;
+
+// iterator over entries
+typedef struct VitaHashMapIter {
+    const vt_hashmap_t *map;
+    size_t idx;
+} vt_hashmap_iter_t;
+
+/** Allocates and creates an empty hash map
+    @param n number of entries to make room for
+    @param key_size key size in bytes, VT_HASHMAP_KEY_STR for vt_str_t keys
+    @param val_size value size in bytes, 0 for a set of keys
+    @param alloctr allocator instance
+
+    @returns `vt_hashmap_t*`
+
+    @note string keys are copied into the map and compared by contents
+    @note if `NULL` is specified, then vita calloc/realloc/free is used
+*/
+extern vt_hashmap_t *vt_hashmap_create(const size_t n, const size_t key_size, const size_t val_size, struct VitaBaseAllocatorType *const alloctr);
+
+/** Frees the entries and destroys the hash map
+    @param map vt_hashmap_t instance
+*/
+extern void vt_hashmap_destroy(vt_hashmap_t *map);
+
+/** Returns the number of entries
+    @param map vt_hashmap_t instance
+    @returns size_t
+*/
+extern size_t vt_hashmap_len(const vt_hashmap_t *const map);
+
+/** Returns the number of slots
+    @param map vt_hashmap_t instance
+    @returns size_t
+*/
+extern size_t vt_hashmap_capacity(const vt_hashmap_t *const map);
+
+/** Checks if the hash map is empty
+    @param map vt_hashmap_t instance
+    @returns `true` if there are no entries
+*/
+extern bool vt_hashmap_is_empty(const vt_hashmap_t *const map);
+
+/** Removes all entries, the capacity is kept
+    @param map vt_hashmap_t instance
+*/
+extern void vt_hashmap_clear(vt_hashmap_t *const map);
+
+/** Makes room for n entries in total, so that inserting them does not rehash
+    @param map vt_hashmap_t instance
+    @param n number of entries
+*/
+extern void vt_hashmap_reserve(vt_hashmap_t *const map, const size_t n);
+
+/** Sets the maximum load factor, the map grows when it is exceeded
+    @param map vt_hashmap_t instance
+    @param max_load load factor in [0.25, 0.95], VT_HASHMAP_DEFAULT_MAX_LOAD by default
+
+    @note the capacity is not reduced
+*/
+extern void vt_hashmap_set_max_load(vt_hashmap_t *const map, const double max_load);
 
+/** Inserts an entry or overwrites the value of an existing key
+    @param map vt_hashmap_t instance
+    @param key key (`vt_str_t*` for string keys)
+    @param val value, if `NULL` the value of a new entry is zeroed and of an existing one is kept
+
+    @returns pointer to the value in the map
+
+    @note pointers to values are invalidated by the next insertion or removal
+*/
+extern void *vt_hashmap_insert(vt_hashmap_t *const map, const void *const key, const void *const val);
+
+/** Returns the value of a key
+    @param map vt_hashmap_t instance
+    @param key key (`vt_str_t*` for string keys)
+    @returns pointer to the value in the map, `NULL` if not found
+*/
+extern void *vt_hashmap_get(const vt_hashmap_t *const map, const void *const key);
+
+/** Checks if a key is in the map
+    @param map vt_hashmap_t instance
+    @param key key (`vt_str_t*` for string keys)
+    @returns `true` if found
+*/
+extern bool vt_hashmap_has(const vt_hashmap_t *const map, const void *const key);
+
+/** Removes an entry
+    @param map vt_hashmap_t instance
+    @param key key (`vt_str_t*` for string keys)
+    @returns `true` if the key was found and removed
+*/
+extern bool vt_hashmap_remove(vt_hashmap_t *const map, const void *const key);
+
+/** Inserts an entry or overwrites the value of an existing key, string keys only
+    @param map vt_hashmap_t instance
+    @param z zero-terminated string
+    @param val value, if `NULL` the value of a new entry is zeroed and of an existing one is kept
+
+    @returns pointer to the value in the map
+*/
+extern void *vt_hashmap_insert_z(vt_hashmap_t *const map, const char *const z, const void *const val);
+
+/** Returns the value of a key, string keys only
+    @param map vt_hashmap_t instance
+    @param z zero-terminated string
+    @returns pointer to the value in the map, `NULL` if not found
+*/
+extern void *vt_hashmap_get_z(const vt_hashmap_t *const map, const char *const z);
+
+/** Removes an entry, string keys only
+    @param map vt_hashmap_t instance
+    @param z zero-terminated string
+    @returns `true` if the key was found and removed
+*/
+extern bool vt_hashmap_remove_z(vt_hashmap_t *const map, const char *const z);
+
+/** Starts iterating over the entries
+    @param map vt_hashmap_t instance
+    @returns vt_hashmap_iter_t
+
+    @note the order is unspecified; the map must not be modified while iterating, but values can be
+*/
+extern vt_hashmap_iter_t vt_hashmap_iter(const vt_hashmap_t *const map);
+
+/** Returns the next entry
+    @param it vt_hashmap_iter_t instance
+    @param key pointer to the key (`vt_str_t*` for string keys), if not `NULL`
+    @param val pointer to the value, if not `NULL`
+
+    @returns `false` if there are no more entries
+*/
+extern bool vt_hashmap_next(vt_hashmap_iter_t *const it, const void **const key, void **const val);
+
+#endif // VITA_CONTAINER_HASHMAP_H
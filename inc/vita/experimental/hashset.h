@@ -0,0 +1,205 @@
+#ifndef VITA_CONTAINER_HASHSET_H
+#define VITA_CONTAINER_HASHSET_H
+
+/** HASHSET MODULE
+ * A set of fixed-size elements (compared as bytes) or strings, on the same flat Robin Hood table as vt_hashmap_t,
+ * with keys only: a slot is the element itself plus 4 bytes of metadata. Lookups, insertions and removals are
+ * O(1) expected, so deduplicating n elements is O(n), unlike vt_vec_can_find which scans the whole array.
+
+ * Functions
+    - vt_hashset_create
+    - vt_hashset_destroy
+    - vt_hashset_len
+    - vt_hashset_is_empty
+    - vt_hashset_clear
+    - vt_hashset_reserve
+    - vt_hashset_set_max_load
+    - vt_hashset_insert
+    - vt_hashset_has
+    - vt_hashset_remove
+    - vt_hashset_insert_z
+    - vt_hashset_has_z
+    - vt_hashset_remove_z
+    - vt_hashset_insert_vec
+    - vt_hashset_insert_plist
+    - vt_hashset_union
+    - vt_hashset_intersect
+    - vt_hashset_iter
+    - vt_hashset_next
+    - vt_hashset_memory
+    - vt_hashset_bytes_per_element
+
+ * Usage
+    // unique ids
+    vt_hashset_t *seen = vt_hashset_create(vt_vec_len(ids), sizeof(uint64_t), NULL);
+    const size_t count_unique = vt_hashset_insert_vec(seen, ids);
+    vt_hashset_destroy(seen);
+*/
+
+#include "vita/container/common.h"
+#include "vita/container/vec.h"
+#include "vita/container/plist.h"
+#include "vita/container/str.h"
+#include "vita/experimental/hashmap.h"
+
+// element size of sets of vt_str_t
+#define VT_HASHSET_STR VT_HASHMAP_KEY_STR
+
+// hash set
+typedef struct VitaHashSet {
+    vt_hashmap_t *map;  // table with zero-size values
+} vt_hashset_t;
+
+// iterator over elements
+typedef vt_hashmap_iter_t vt_hashset_iter_t;
+
+/** Allocates and creates an empty hash set
+    @param n number of elements to make room for
+    @param elsize element size in bytes, VT_HASHSET_STR for vt_str_t elements
+    @param alloctr allocator instance
+
+    @returns `vt_hashset_t*`
+
+    @note strings are copied into the set and compared by contents
+    @note if `NULL` is specified, then vita calloc/realloc/free is used
+*/
+extern vt_hashset_t *vt_hashset_create(const size_t n, const size_t elsize, struct VitaBaseAllocatorType *const alloctr);
+
+/** Frees the elements and destroys the hash set
+    @param set vt_hashset_t instance
+*/
+extern void vt_hashset_destroy(vt_hashset_t *set);
+
+/** Returns the number of elements
+    @param set vt_hashset_t instance
+    @returns size_t
+*/
+extern size_t vt_hashset_len(const vt_hashset_t *const set);
+
+/** Checks if the hash set is empty
+    @param set vt_hashset_t instance
+    @returns `true` if there are no elements
+*/
+extern bool vt_hashset_is_empty(const vt_hashset_t *const set);
+
+/** Removes all elements, the capacity is kept
+    @param set vt_hashset_t instance
+*/
+extern void vt_hashset_clear(vt_hashset_t *const set);
+
+/** Makes room for n elements in total, so that inserting them does not rehash
+    @param set vt_hashset_t instance
+    @param n number of elements
+*/
+extern void vt_hashset_reserve(vt_hashset_t *const set, const size_t n);
+
+/** Sets the maximum load factor, see vt_hashmap_set_max_load
+    @param set vt_hashset_t instance
+    @param max_load load factor in [0.25, 0.95]
+
+    @note a higher load factor takes less memory per element, see vt_hashset_bytes_per_element
+*/
+extern void vt_hashset_set_max_load(vt_hashset_t *const set, const double max_load);
+
+/** Inserts an element
+    @param set vt_hashset_t instance
+    @param el element (`vt_str_t*` for string sets)
+    @returns `true` if it was not in the set
+*/
+extern bool vt_hashset_insert(vt_hashset_t *const set, const void *const el);
+
+/** Checks if an element is in the set
+    @param set vt_hashset_t instance
+    @param el element (`vt_str_t*` for string sets)
+    @returns `true` if found
+*/
+extern bool vt_hashset_has(const vt_hashset_t *const set, const void *const el);
+
+/** Removes an element
+    @param set vt_hashset_t instance
+    @param el element (`vt_str_t*` for string sets)
+    @returns `true` if it was found and removed
+*/
+extern bool vt_hashset_remove(vt_hashset_t *const set, const void *const el);
+
+/** Inserts a string, string sets only
+    @param set vt_hashset_t instance
+    @param z zero-terminated string
+    @returns `true` if it was not in the set
+*/
+extern bool vt_hashset_insert_z(vt_hashset_t *const set, const char *const z);
+
+/** Checks if a string is in the set, string sets only
+    @param set vt_hashset_t instance
+    @param z zero-terminated string
+    @returns `true` if found
+*/
+extern bool vt_hashset_has_z(const vt_hashset_t *const set, const char *const z);
+
+/** Removes a string, string sets only
+    @param set vt_hashset_t instance
+    @param z zero-terminated string
+    @returns `true` if it was found and removed
+*/
+extern bool vt_hashset_remove_z(vt_hashset_t *const set, const char *const z);
+
+/** Inserts all elements of a vector
+    @param set vt_hashset_t instance
+    @param v vt_vec_t instance with the same element size
+    @returns number of elements that were not in the set
+
+    @note no room is reserved upfront, call vt_hashset_reserve if most elements are known to be unique
+*/
+extern size_t vt_hashset_insert_vec(vt_hashset_t *const set, const vt_vec_t *const v);
+
+/** Inserts all strings of a pointer list, string sets only
+    @param set vt_hashset_t instance
+    @param p vt_plist_t of `vt_str_t*`, e.g., the result of vt_str_split
+    @returns number of strings that were not in the set
+*/
+extern size_t vt_hashset_insert_plist(vt_hashset_t *const set, const vt_plist_t *const p);
+
+/** Adds the elements of another set: dst = dst | src
+    @param dst vt_hashset_t instance
+    @param src vt_hashset_t instance with the same element size
+*/
+extern void vt_hashset_union(vt_hashset_t *const dst, const vt_hashset_t *const src);
+
+/** Removes the elements not found in another set: dst = dst & src
+    @param dst vt_hashset_t instance
+    @param src vt_hashset_t instance with the same element size
+*/
+extern void vt_hashset_intersect(vt_hashset_t *const dst, const vt_hashset_t *const src);
+
+/** Starts iterating over the elements
+    @param set vt_hashset_t instance
+    @returns vt_hashset_iter_t
+
+    @note the order is unspecified; the set must not be modified while iterating
+*/
+extern vt_hashset_iter_t vt_hashset_iter(const vt_hashset_t *const set);
+
+/** Returns the next element
+    @param it vt_hashset_iter_t instance
+    @param el pointer to the element (`vt_str_t*` for string sets)
+    @returns `false` if there are no more elements
+*/
+extern bool vt_hashset_next(vt_hashset_iter_t *const it, const void **const el);
+
+/** Returns the memory used by the set: the table and the copies of strings
+    @param set vt_hashset_t instance
+    @returns number of bytes
+
+    @note O(n) for string sets, the strings are summed up
+*/
+extern size_t vt_hashset_memory(const vt_hashset_t *const set);
+
+/** Returns the memory used by the set per element
+    @param set vt_hashset_t instance
+    @returns number of bytes, 0 if empty
+
+    @note between (elsize + 4) / max_load and twice that, depending on how full the table is
+*/
+extern double vt_hashset_bytes_per_element(const vt_hashset_t *const set);
+
+#endif // VITA_CONTAINER_HASHSET_H
@@ -1,34 +1,261 @@
 #ifndef VITA_CONTAINER_SLLIST_H
 #define VITA_CONTAINER_SLLIST_H
 
-/** SINGLE LINKED LIST MODULE
+/** LINKED LIST MODULE (pooled nodes)
+ * A linked list of fixed-size elements, set up like vt_vec_create elements. Nodes are not allocated one by one:
+ * they are carved from a few contiguous blocks (each twice as big as the previous one, allocated through the
+ * allocator interface) and removed nodes are recycled through a free list, so pushing, popping and removing an
+ * element is O(1) without touching the heap. Links are 32-bit node indices instead of pointers: a node is the
+ * element plus 8 bytes, and a node index (handle) stays valid until the node is removed, however much the list
+ * grows. Each node is linked both ways, so the back of the list and any node can be removed in O(1).
+
+ * Functions
     - vt_sllist_create
     - vt_sllist_destroy
     - vt_sllist_len
+    - vt_sllist_capacity
     - vt_sllist_is_empty
     - vt_sllist_clear
+    - vt_sllist_reserve
+    - vt_sllist_head
+    - vt_sllist_tail
+    - vt_sllist_next
+    - vt_sllist_prev
+    - vt_sllist_at
     - vt_sllist_set
     - vt_sllist_get
     - vt_sllist_push_front
     - vt_sllist_push_back
+    - vt_sllist_insert_before
+    - vt_sllist_insert_after
     - vt_sllist_pop_front
     - vt_sllist_pop_back
     - vt_sllist_pop_get_front
     - vt_sllist_pop_get_back
     - vt_sllist_remove
     - vt_sllist_remove_element
+    - vt_sllist_find
     - vt_sllist_apply
+
+ * Usage
+    // FIFO queue
+    vt_sllist_t *queue = vt_sllist_create(0, sizeof(int32_t), NULL);
+    const int32_t x = 42;
+    vt_sllist_push_back(queue, &x);
+    while (!vt_sllist_is_empty(queue)) {
+        const int32_t *y = vt_sllist_pop_get_front(queue);
+        ...
+    }
+
+    // iterate
+    for (size_t node = vt_sllist_head(queue); node != VT_SLLIST_NIL; node = vt_sllist_next(queue, node)) {
+        int32_t *y = vt_sllist_get(queue, node);
+        ...
+    }
+    vt_sllist_destroy(queue);
 */
 
 #include "vita/container/common.h"
 
-/// single linked list structure
+// constants
+#define VT_SLLIST_NIL UINT32_MAX            // no node: end of the list
+#define VT_SLLIST_MIN_BLOCK_SHIFT 4         // the first block holds at least 16 nodes
+#define VT_SLLIST_MAX_BLOCKS 32             // number of blocks that covers 32-bit node indices
+
+/// linked list structure
 typedef struct VitaSingleLinkedList {
-    size_t len;
-    struct VitaNode *head;
+    struct VitaBaseAllocatorType *alloctr;  // allocator, `NULL` for the default one
+    uint8_t *blocks[VT_SLLIST_MAX_BLOCKS];  // node blocks, block `b` holds `1 << (block_shift + b)` nodes
+    size_t count_blocks;                    // number of allocated blocks
+    size_t count_nodes;                     // number of nodes carved from the blocks, removed ones included
+    size_t block_shift;                     // log2 of the number of nodes in the first block
+    size_t len;                             // number of elements
+    size_t elsize;                          // element size in bytes
+    size_t node_size;                       // node size in bytes: links and the element
+    uint32_t head;                          // first node
+    uint32_t tail;                          // last node
+    uint32_t free_list;                     // removed nodes, linked with `next`
 } vt_sllist_t;
 
+/** Allocates and creates an empty list
+    @param n number of elements to make room for
+    @param elsize element size in bytes
+    @param alloctr allocator instance
 
+    @returns `vt_sllist_t*`
 
-#endif // VITA_CONTAINER_SLLIST_H
+    @note if `NULL` is specified, then vita calloc/realloc/free is used
+*/
+extern vt_sllist_t *vt_sllist_create(const size_t n, const size_t elsize, struct VitaBaseAllocatorType *const alloctr);
+
+/** Frees the node blocks and destroys the list
+    @param list vt_sllist_t instance
+*/
+extern void vt_sllist_destroy(vt_sllist_t *list);
+
+/** Returns the number of elements
+    @param list vt_sllist_t instance
+    @returns size_t
+*/
+extern size_t vt_sllist_len(const vt_sllist_t *const list);
+
+/** Returns the number of nodes in the allocated blocks
+    @param list vt_sllist_t instance
+    @returns size_t
+*/
+extern size_t vt_sllist_capacity(const vt_sllist_t *const list);
+
+/** Checks if the list is empty
+    @param list vt_sllist_t instance
+    @returns `true` if there are no elements
+*/
+extern bool vt_sllist_is_empty(const vt_sllist_t *const list);
+
+/** Removes all elements, the node blocks are kept
+    @param list vt_sllist_t instance
+    @note all node handles are invalidated
+*/
+extern void vt_sllist_clear(vt_sllist_t *const list);
+
+/** Allocates node blocks for n elements in total
+    @param list vt_sllist_t instance
+    @param n number of elements
+*/
+extern void vt_sllist_reserve(vt_sllist_t *const list, const size_t n);
+
+/** Returns the first node
+    @param list vt_sllist_t instance
+    @returns node handle, VT_SLLIST_NIL if the list is empty
+*/
+extern size_t vt_sllist_head(const vt_sllist_t *const list);
+
+/** Returns the last node
+    @param list vt_sllist_t instance
+    @returns node handle, VT_SLLIST_NIL if the list is empty
+*/
+extern size_t vt_sllist_tail(const vt_sllist_t *const list);
+
+/** Returns the node after a node
+    @param list vt_sllist_t instance
+    @param node node handle
+    @returns node handle, VT_SLLIST_NIL at the end of the list
+*/
+extern size_t vt_sllist_next(const vt_sllist_t *const list, const size_t node);
+
+/** Returns the node before a node
+    @param list vt_sllist_t instance
+    @param node node handle
+    @returns node handle, VT_SLLIST_NIL at the start of the list
+*/
+extern size_t vt_sllist_prev(const vt_sllist_t *const list, const size_t node);
+
+/** Returns the node at a position, walking from the nearest end
+    @param list vt_sllist_t instance
+    @param at position in the list
+    @returns node handle
+
+    @note O(n)
+*/
+extern size_t vt_sllist_at(const vt_sllist_t *const list, const size_t at);
+
+/** Assigns a new value to an element
+    @param list vt_sllist_t instance
+    @param val value
+    @param node node handle
+*/
+extern void vt_sllist_set(vt_sllist_t *const list, const void *const val, const size_t node);
 
+/** Returns the element of a node
+    @param list vt_sllist_t instance
+    @param node node handle
+    @returns pointer to the element, valid until the node is removed
+*/
+extern void *vt_sllist_get(const vt_sllist_t *const list, const size_t node);
+
+/** Inserts an element at the front
+    @param list vt_sllist_t instance
+    @param val value
+    @returns node handle
+*/
+extern size_t vt_sllist_push_front(vt_sllist_t *const list, const void *const val);
+
+/** Inserts an element at the back
+    @param list vt_sllist_t instance
+    @param val value
+    @returns node handle
+*/
+extern size_t vt_sllist_push_back(vt_sllist_t *const list, const void *const val);
+
+/** Inserts an element before a node
+    @param list vt_sllist_t instance
+    @param val value
+    @param node node handle
+    @returns node handle of the new element
+*/
+extern size_t vt_sllist_insert_before(vt_sllist_t *const list, const void *const val, const size_t node);
+
+/** Inserts an element after a node
+    @param list vt_sllist_t instance
+    @param val value
+    @param node node handle
+    @returns node handle of the new element
+*/
+extern size_t vt_sllist_insert_after(vt_sllist_t *const list, const void *const val, const size_t node);
+
+/** Removes the first element
+    @param list vt_sllist_t instance
+*/
+extern void vt_sllist_pop_front(vt_sllist_t *const list);
+
+/** Removes the last element
+    @param list vt_sllist_t instance
+*/
+extern void vt_sllist_pop_back(vt_sllist_t *const list);
+
+/** Removes the first element and returns it
+    @param list vt_sllist_t instance
+    @returns pointer to the element, `NULL` if the list is empty
+
+    @note the pointer is valid until the next insertion
+*/
+extern void *vt_sllist_pop_get_front(vt_sllist_t *const list);
+
+/** Removes the last element and returns it
+    @param list vt_sllist_t instance
+    @returns pointer to the element, `NULL` if the list is empty
+
+    @note the pointer is valid until the next insertion
+*/
+extern void *vt_sllist_pop_get_back(vt_sllist_t *const list);
+
+/** Removes the element of a node
+    @param list vt_sllist_t instance
+    @param node node handle
+*/
+extern void vt_sllist_remove(vt_sllist_t *const list, const size_t node);
+
+/** Removes the first element equal to a value
+    @param list vt_sllist_t instance
+    @param val value
+    @returns `true` if it was found and removed
+
+    @note O(n)
+*/
+extern bool vt_sllist_remove_element(vt_sllist_t *const list, const void *const val);
+
+/** Finds the first element equal to a value
+    @param list vt_sllist_t instance
+    @param val value
+    @returns node handle, VT_SLLIST_NIL if not found
+
+    @note O(n)
+*/
+extern size_t vt_sllist_find(const vt_sllist_t *const list, const void *const val);
+
+/** Calls the specified function on each element from the front
+    @param list vt_sllist_t instance
+    @param func function to execute action on each element: func(pointer, position)
+*/
+extern void vt_sllist_apply(const vt_sllist_t *const list, void (*func)(void*, size_t));
+
+#endif // VITA_CONTAINER_SLLIST_H
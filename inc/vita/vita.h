@@ -12,13 +12,30 @@
 #include "time/datetime.h"
 
 #include "allocator/mallocator.h"
+#include "allocator/arena.h"
+#include "allocator/pool.h"
+#include "allocator/tcallocator.h"
+#include "allocator/hpallocator.h"
+#include "allocator/stackallocator.h"
 
 #include "container/vec.h"
 #include "container/str.h"
 #include "container/plist.h"
 #include "container/span.h"
+#include "container/strview.h"
+#include "container/strbuilder.h"
+#include "container/intern.h"
+#include "container/deque.h"
+#include "container/heap.h"
+
+#include "experimental/hashmap.h"
+#include "experimental/hashset.h"
+#include "experimental/sllist.h"
 
 #include "algorithm/search.h"
+#include "algorithm/ascii.h"
+#include "algorithm/matcher.h"
+#include "algorithm/hash.h"
 #include "algorithm/comparison.h"
 
 #include "network/sockets.h"
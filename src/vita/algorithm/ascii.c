@@ -0,0 +1,644 @@
+#include "vita/algorithm/ascii.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define VT_ASCII_SSE2
+    #include <emmintrin.h>
+#endif
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    // compiled for AVX2 regardless of the target flags, used only if the CPU supports it
+    #define VT_ASCII_AVX2
+    #include <immintrin.h>
+#endif
+
+static void vt_ascii_to_case(char *const z, const size_t len, const char from);
+static void vt_ascii_to_case_scalar(char *const z, const size_t len, const char from);
+static size_t vt_ascii_span_scalar(const char *const z, const size_t len, const vt_ascii_set_t *const set);
+static size_t vt_ascii_span_last_scalar(const char *const z, const size_t len, const vt_ascii_set_t *const set);
+static size_t vt_ascii_remove_scalar(char *const dst, const char *const src, const size_t len, const vt_ascii_set_t *const set);
+static void vt_ascii_replace_scalar(char *const z, const size_t len, const vt_ascii_set_t *const set, const char *const map);
+static void vt_ascii_replace_table(char *const table, const vt_ascii_set_t *const set, const char *const map);
+#ifdef VT_ASCII_SSE2
+    static void vt_ascii_ranges_sse2(const vt_ascii_set_t *const set, __m128i *const lo, __m128i *const width);
+    static uint32_t vt_ascii_member_sse2(const __m128i v, const __m128i *const lo, const __m128i *const width, const size_t count);
+    static void vt_ascii_to_case_sse2(char *const z, const size_t len, const char from);
+    static size_t vt_ascii_span_sse2(const char *const z, const size_t len, const vt_ascii_set_t *const set);
+    static size_t vt_ascii_span_last_sse2(const char *const z, const size_t len, const vt_ascii_set_t *const set);
+    static size_t vt_ascii_remove_sse2(char *const z, const size_t len, const vt_ascii_set_t *const set);
+    static void vt_ascii_replace_sse2(char *const z, const size_t len, const vt_ascii_set_t *const set, const char *const map);
+#endif
+#ifdef VT_ASCII_AVX2
+    static void vt_ascii_ranges_avx2(const vt_ascii_set_t *const set, __m256i *const lo, __m256i *const width);
+    static uint32_t vt_ascii_member_avx2(const __m256i v, const __m256i *const lo, const __m256i *const width, const size_t count);
+    static void vt_ascii_to_case_avx2(char *const z, const size_t len, const char from);
+    static size_t vt_ascii_span_avx2(const char *const z, const size_t len, const vt_ascii_set_t *const set);
+    static size_t vt_ascii_span_last_avx2(const char *const z, const size_t len, const vt_ascii_set_t *const set);
+    static size_t vt_ascii_remove_avx2(char *const z, const size_t len, const vt_ascii_set_t *const set);
+    static void vt_ascii_replace_avx2(char *const z, const size_t len, const vt_ascii_set_t *const set, const char *const map);
+#endif
+
+// SIMD kernels need a whole block of data and a set made of few ranges
+#define VT_ASCII_USE_AVX2(len, set) ((len) >= 32 && (set)->count_ranges <= VT_ASCII_SET_MAX_RANGES && vt_cpu_simd_level() >= 1)
+#define VT_ASCII_USE_SSE2(len, set) ((len) >= 16 && (set)->count_ranges <= VT_ASCII_SET_MAX_RANGES)
+
+// spans check this many bytes one at a time first
+#define VT_ASCII_SPAN_PROBE 8
+
+void vt_ascii_to_upper(char *const z, const size_t len) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(z != NULL || !len, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    vt_ascii_to_case(z, len, 'a');
+}
+
+void vt_ascii_to_lower(char *const z, const size_t len) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(z != NULL || !len, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    vt_ascii_to_case(z, len, 'A');
+}
+
+void vt_ascii_set_init(vt_ascii_set_t *const set, const char *const chars) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(set != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    VT_DEBUG_ASSERT(chars != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    // mark members
+    vt_memset(set, 0, sizeof(*set));
+    for (const char *p = chars; *p; p++) {
+        const uint8_t c = (uint8_t)*p;
+        set->bits[c >> 6] |= 1ULL << (c & 63);
+    }
+
+#if defined(VT_ASCII_SSE2) || defined(VT_ASCII_AVX2)
+    // merge consecutive members into ranges for the SIMD kernels: walk from each member that does not follow another one
+    uint64_t seen[4] = {0};
+    for (const char *p = chars; *p; p++) {
+        const uint8_t c = (uint8_t)*p;
+        if ((c > 0 && vt_ascii_set_has(set, (char)(c - 1))) || ((seen[c >> 6] >> (c & 63)) & 1)) {
+            continue;
+        }
+        seen[c >> 6] |= 1ULL << (c & 63);
+
+        // find the end of the range
+        size_t last = c;
+        while (last + 1 < 256 && vt_ascii_set_has(set, (char)(last + 1))) {
+            last++;
+        }
+
+        // save it in ascending order, if there is space
+        if (set->count_ranges < VT_ASCII_SET_MAX_RANGES) {
+            size_t r = set->count_ranges;
+            for (; r > 0 && set->lo[r - 1] > c; r--) {
+                set->lo[r] = set->lo[r - 1];
+                set->width[r] = set->width[r - 1];
+            }
+            set->lo[r] = c;
+            set->width[r] = (uint8_t)(last - c);
+        }
+        set->count_ranges++;
+    }
+#else
+    // no SIMD kernels, the set is checked bytewise
+    set->count_ranges = VT_ASCII_SET_MAX_RANGES + 1;
+#endif
+}
+
+const vt_ascii_set_t *vt_ascii_set_space(void) {
+    // \t \n \v \f \r, ' '
+    static const vt_ascii_set_t set = {
+        .bits = { 0x0000000100003E00ULL, 0, 0, 0 },
+        .lo = { '\t', ' ' },
+        .width = { 4, 0 },
+        .count_ranges = 2,
+    };
+
+    return &set;
+}
+
+const vt_ascii_set_t *vt_ascii_set_space_punct(void) {
+    // \t \n \v \f \r, ' ' to '/', ':' to '@', '[' to '`', '{' to '~'
+    static const vt_ascii_set_t set = {
+        .bits = { 0xFC00FFFF00003E00ULL, 0x78000001F8000001ULL, 0, 0 },
+        .lo = { '\t', ' ', ':', '[', '{' },
+        .width = { 4, 15, 6, 5, 3 },
+        .count_ranges = 5,
+    };
+
+    return &set;
+}
+
+bool vt_ascii_set_has(const vt_ascii_set_t *const set, const char c) {
+    const uint8_t u = (uint8_t)c;
+    return (set->bits[u >> 6] >> (u & 63)) & 1;
+}
+
+size_t vt_ascii_span(const char *const z, const size_t len, const vt_ascii_set_t *const set) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(z != NULL || !len, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    VT_DEBUG_ASSERT(set != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    // spans are mostly short: check a few bytes one at a time before setting up SIMD
+    const size_t probe = len < VT_ASCII_SPAN_PROBE ? len : VT_ASCII_SPAN_PROBE;
+    const size_t n = vt_ascii_span_scalar(z, probe, set);
+    if (n < probe || n == len) {
+        return n;
+    }
+
+#ifdef VT_ASCII_AVX2
+    if (VT_ASCII_USE_AVX2(len - n, set)) {
+        return n + vt_ascii_span_avx2(z + n, len - n, set);
+    }
+#endif
+#ifdef VT_ASCII_SSE2
+    if (VT_ASCII_USE_SSE2(len - n, set)) {
+        return n + vt_ascii_span_sse2(z + n, len - n, set);
+    }
+#endif
+    return n + vt_ascii_span_scalar(z + n, len - n, set);
+}
+
+size_t vt_ascii_span_last(const char *const z, const size_t len, const vt_ascii_set_t *const set) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(z != NULL || !len, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    VT_DEBUG_ASSERT(set != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    // spans are mostly short: check a few bytes one at a time before setting up SIMD
+    const size_t probe = len < VT_ASCII_SPAN_PROBE ? len : VT_ASCII_SPAN_PROBE;
+    const size_t n = vt_ascii_span_last_scalar(z + len - probe, probe, set);
+    if (n < probe || n == len) {
+        return n;
+    }
+
+#ifdef VT_ASCII_AVX2
+    if (VT_ASCII_USE_AVX2(len - n, set)) {
+        return n + vt_ascii_span_last_avx2(z, len - n, set);
+    }
+#endif
+#ifdef VT_ASCII_SSE2
+    if (VT_ASCII_USE_SSE2(len - n, set)) {
+        return n + vt_ascii_span_last_sse2(z, len - n, set);
+    }
+#endif
+    return n + vt_ascii_span_last_scalar(z, len - n, set);
+}
+
+size_t vt_ascii_remove(char *const z, const size_t len, const vt_ascii_set_t *const set) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(z != NULL || !len, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    VT_DEBUG_ASSERT(set != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+#ifdef VT_ASCII_AVX2
+    if (VT_ASCII_USE_AVX2(len, set)) {
+        return vt_ascii_remove_avx2(z, len, set);
+    }
+#endif
+#ifdef VT_ASCII_SSE2
+    if (VT_ASCII_USE_SSE2(len, set)) {
+        return vt_ascii_remove_sse2(z, len, set);
+    }
+#endif
+    return vt_ascii_remove_scalar(z, z, len, set);
+}
+
+void vt_ascii_replace(char *const z, const size_t len, const vt_ascii_set_t *const set, const char *const map) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(z != NULL || !len, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    VT_DEBUG_ASSERT(set != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    VT_DEBUG_ASSERT(map != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+#ifdef VT_ASCII_AVX2
+    if (VT_ASCII_USE_AVX2(len, set)) {
+        vt_ascii_replace_avx2(z, len, set, map);
+        return;
+    }
+#endif
+#ifdef VT_ASCII_SSE2
+    if (VT_ASCII_USE_SSE2(len, set)) {
+        vt_ascii_replace_sse2(z, len, set, map);
+        return;
+    }
+#endif
+    vt_ascii_replace_scalar(z, len, set, map);
+}
+
+/* ---------------------- PRIVATE FUNCTIONS ---------------------- */
+
+/** Flips the case of letters in [from; from + 25]
+    @param z data
+    @param len data length
+    @param from 'a' to convert to uppercase, 'A' to convert to lowercase
+*/
+static void vt_ascii_to_case(char *const z, const size_t len, const char from) {
+#ifdef VT_ASCII_AVX2
+    if (len >= 32 && vt_cpu_simd_level() >= 1) {
+        vt_ascii_to_case_avx2(z, len, from);
+        return;
+    }
+#endif
+#ifdef VT_ASCII_SSE2
+    if (len >= 16) {
+        vt_ascii_to_case_sse2(z, len, from);
+        return;
+    }
+#endif
+    vt_ascii_to_case_scalar(z, len, from);
+}
+
+/** Flips the case of letters in [from; from + 25] one byte at a time
+    @param z data
+    @param len data length
+    @param from 'a' to convert to uppercase, 'A' to convert to lowercase
+*/
+static void vt_ascii_to_case_scalar(char *const z, const size_t len, const char from) {
+    for (size_t i = 0; i < len; i++) {
+        if ((uint8_t)(z[i] - from) < 26) {
+            z[i] ^= 0x20;
+        }
+    }
+}
+
+/** Counts leading set members one byte at a time
+    @param z data
+    @param len data length
+    @param set vt_ascii_set_t instance
+    @returns number of characters
+*/
+static size_t vt_ascii_span_scalar(const char *const z, const size_t len, const vt_ascii_set_t *const set) {
+    size_t i = 0;
+    while (i < len && vt_ascii_set_has(set, z[i])) {
+        i++;
+    }
+
+    return i;
+}
+
+/** Counts trailing set members one byte at a time
+    @param z data
+    @param len data length
+    @param set vt_ascii_set_t instance
+    @returns number of characters
+*/
+static size_t vt_ascii_span_last_scalar(const char *const z, const size_t len, const vt_ascii_set_t *const set) {
+    size_t i = len;
+    while (i > 0 && vt_ascii_set_has(set, z[i - 1])) {
+        i--;
+    }
+
+    return len - i;
+}
+
+/** Copies characters that do not belong to a set one byte at a time
+    @param dst destination, not after `src`
+    @param src source
+    @param len source length
+    @param set vt_ascii_set_t instance
+    @returns number of characters copied
+*/
+static size_t vt_ascii_remove_scalar(char *const dst, const char *const src, const size_t len, const vt_ascii_set_t *const set) {
+    size_t n = 0;
+    for (size_t i = 0; i < len; i++) {
+        dst[n] = src[i];
+        n += !vt_ascii_set_has(set, src[i]);
+    }
+
+    return n;
+}
+
+/** Replaces set members one byte at a time
+    @param z data
+    @param len data length
+    @param set vt_ascii_set_t instance
+    @param map replacement for each byte value
+*/
+static void vt_ascii_replace_scalar(char *const z, const size_t len, const vt_ascii_set_t *const set, const char *const map) {
+    for (size_t i = 0; i < len; i++) {
+        if (vt_ascii_set_has(set, z[i])) {
+            z[i] = map[(uint8_t)z[i]];
+        }
+    }
+}
+
+/** Makes a lookup table that maps set members like `map` and other bytes to themselves
+    @param table 256 chars
+    @param set vt_ascii_set_t instance
+    @param map replacement for each byte value
+*/
+static void vt_ascii_replace_table(char *const table, const vt_ascii_set_t *const set, const char *const map) {
+    for (size_t c = 0; c < 256; c++) {
+        table[c] = vt_ascii_set_has(set, (char)c) ? map[c] : (char)c;
+    }
+}
+
+#ifdef VT_ASCII_SSE2
+/** Broadcasts set ranges into 16-byte vectors
+    @param set vt_ascii_set_t instance, with no more than VT_ASCII_SET_MAX_RANGES ranges
+    @param lo first bytes of ranges
+    @param width widths of ranges
+*/
+static void vt_ascii_ranges_sse2(const vt_ascii_set_t *const set, __m128i *const lo, __m128i *const width) {
+    for (size_t r = 0; r < set->count_ranges; r++) {
+        lo[r] = _mm_set1_epi8((char)set->lo[r]);
+        width[r] = _mm_set1_epi8((char)set->width[r]);
+    }
+}
+
+/** Checks which bytes of a 16-byte block belong to a set
+    @param v block
+    @param lo first bytes of ranges
+    @param width widths of ranges
+    @param count number of ranges
+    @returns bit mask, bit `i` is set if byte `i` is a member
+
+    @note a byte is within a range if (byte - lo) <= width in unsigned arithmetic
+*/
+static uint32_t vt_ascii_member_sse2(const __m128i v, const __m128i *const lo, const __m128i *const width, const size_t count) {
+    __m128i m = _mm_setzero_si128();
+    for (size_t r = 0; r < count; r++) {
+        const __m128i t = _mm_sub_epi8(v, lo[r]);
+        m = _mm_or_si128(m, _mm_cmpeq_epi8(_mm_min_epu8(t, width[r]), t));
+    }
+
+    return (uint32_t)_mm_movemask_epi8(m);
+}
+
+/** Flips the case of letters in [from; from + 25], 16 bytes at a time
+    @param z data
+    @param len data length, at least 16
+    @param from 'a' to convert to uppercase, 'A' to convert to lowercase
+*/
+static void vt_ascii_to_case_sse2(char *const z, const size_t len, const char from) {
+    const __m128i vfrom = _mm_set1_epi8(from);
+    const __m128i vwidth = _mm_set1_epi8(25);
+    const __m128i vflip = _mm_set1_epi8(0x20);
+
+    // the last block overlaps the previous one: converted letters are out of range, so they are not flipped back
+    for (size_t i = 0; i < len; i += 16) {
+        char *const p = z + ((i + 16 <= len) ? i : len - 16);
+        const __m128i v = _mm_loadu_si128((const __m128i*)p);
+        const __m128i t = _mm_sub_epi8(v, vfrom);
+        const __m128i letters = _mm_cmpeq_epi8(_mm_min_epu8(t, vwidth), t);
+        _mm_storeu_si128((__m128i*)p, _mm_xor_si128(v, _mm_and_si128(letters, vflip)));
+    }
+}
+
+/** Counts leading set members, 16 bytes at a time
+    @param z data
+    @param len data length
+    @param set vt_ascii_set_t instance, with no more than VT_ASCII_SET_MAX_RANGES ranges
+    @returns number of characters
+*/
+static size_t vt_ascii_span_sse2(const char *const z, const size_t len, const vt_ascii_set_t *const set) {
+    __m128i lo[VT_ASCII_SET_MAX_RANGES], width[VT_ASCII_SET_MAX_RANGES];
+    vt_ascii_ranges_sse2(set, lo, width);
+
+    // skip whole blocks of members, the first block with a non-member is finished bytewise
+    size_t i = 0;
+    while (i + 16 <= len && vt_ascii_member_sse2(_mm_loadu_si128((const __m128i*)(z + i)), lo, width, set->count_ranges) == 0xffffu) {
+        i += 16;
+    }
+
+    return i + vt_ascii_span_scalar(z + i, len - i, set);
+}
+
+/** Counts trailing set members, 16 bytes at a time
+    @param z data
+    @param len data length
+    @param set vt_ascii_set_t instance, with no more than VT_ASCII_SET_MAX_RANGES ranges
+    @returns number of characters
+*/
+static size_t vt_ascii_span_last_sse2(const char *const z, const size_t len, const vt_ascii_set_t *const set) {
+    __m128i lo[VT_ASCII_SET_MAX_RANGES], width[VT_ASCII_SET_MAX_RANGES];
+    vt_ascii_ranges_sse2(set, lo, width);
+
+    // skip whole blocks of members from the end, the first block with a non-member is finished bytewise
+    size_t i = len;
+    while (i >= 16 && vt_ascii_member_sse2(_mm_loadu_si128((const __m128i*)(z + i - 16)), lo, width, set->count_ranges) == 0xffffu) {
+        i -= 16;
+    }
+
+    return (len - i) + vt_ascii_span_last_scalar(z, i, set);
+}
+
+/** Removes set members, 16 bytes at a time
+    @param z data
+    @param len data length
+    @param set vt_ascii_set_t instance, with no more than VT_ASCII_SET_MAX_RANGES ranges
+    @returns new length
+*/
+static size_t vt_ascii_remove_sse2(char *const z, const size_t len, const vt_ascii_set_t *const set) {
+    __m128i lo[VT_ASCII_SET_MAX_RANGES], width[VT_ASCII_SET_MAX_RANGES];
+    vt_ascii_ranges_sse2(set, lo, width);
+
+    // the destination never gets ahead of the source, so a block is loaded before it can be overwritten
+    char *dst = z;
+    size_t i = 0;
+    for (; i + 16 <= len; i += 16) {
+        const __m128i v = _mm_loadu_si128((const __m128i*)(z + i));
+        const uint32_t mask = vt_ascii_member_sse2(v, lo, width, set->count_ranges);
+        if (!mask) {
+            // no members: move the whole block
+            _mm_storeu_si128((__m128i*)dst, v);
+            dst += 16;
+        } else if (mask != 0xffffu) {
+            // keep non-members only: every byte is written, but only non-members advance
+            for (size_t j = 0; j < 16; j++) {
+                *dst = z[i + j];
+                dst += !((mask >> j) & 1);
+            }
+        }
+    }
+    dst += vt_ascii_remove_scalar(dst, z + i, len - i, set);
+
+    return (size_t)(dst - z);
+}
+
+/** Replaces set members, 16 bytes at a time
+    @param z data
+    @param len data length
+    @param set vt_ascii_set_t instance, with no more than VT_ASCII_SET_MAX_RANGES ranges
+    @param map replacement for each byte value
+*/
+static void vt_ascii_replace_sse2(char *const z, const size_t len, const vt_ascii_set_t *const set, const char *const map) {
+    __m128i lo[VT_ASCII_SET_MAX_RANGES], width[VT_ASCII_SET_MAX_RANGES];
+    vt_ascii_ranges_sse2(set, lo, width);
+
+    // blocks without members are skipped, the others go through a full table made on first use
+    char table[256];
+    bool has_table = false;
+    size_t i = 0;
+    for (; i + 16 <= len; i += 16) {
+        if (!vt_ascii_member_sse2(_mm_loadu_si128((const __m128i*)(z + i)), lo, width, set->count_ranges)) {
+            continue;
+        } else if (!has_table) {
+            vt_ascii_replace_table(table, set, map);
+            has_table = true;
+        }
+
+        for (size_t j = i; j < i + 16; j++) {
+            z[j] = table[(uint8_t)z[j]];
+        }
+    }
+    vt_ascii_replace_scalar(z + i, len - i, set, map);
+}
+#endif
+
+#ifdef VT_ASCII_AVX2
+/** Broadcasts set ranges into 32-byte vectors
+    @param set vt_ascii_set_t instance, with no more than VT_ASCII_SET_MAX_RANGES ranges
+    @param lo first bytes of ranges
+    @param width widths of ranges
+*/
+__attribute__((target("avx2")))
+static void vt_ascii_ranges_avx2(const vt_ascii_set_t *const set, __m256i *const lo, __m256i *const width) {
+    for (size_t r = 0; r < set->count_ranges; r++) {
+        lo[r] = _mm256_set1_epi8((char)set->lo[r]);
+        width[r] = _mm256_set1_epi8((char)set->width[r]);
+    }
+}
+
+/** Checks which bytes of a 32-byte block belong to a set
+    @param v block
+    @param lo first bytes of ranges
+    @param width widths of ranges
+    @param count number of ranges
+    @returns bit mask, bit `i` is set if byte `i` is a member
+
+    @note a byte is within a range if (byte - lo) <= width in unsigned arithmetic
+*/
+__attribute__((target("avx2")))
+static uint32_t vt_ascii_member_avx2(const __m256i v, const __m256i *const lo, const __m256i *const width, const size_t count) {
+    __m256i m = _mm256_setzero_si256();
+    for (size_t r = 0; r < count; r++) {
+        const __m256i t = _mm256_sub_epi8(v, lo[r]);
+        m = _mm256_or_si256(m, _mm256_cmpeq_epi8(_mm256_min_epu8(t, width[r]), t));
+    }
+
+    return (uint32_t)_mm256_movemask_epi8(m);
+}
+
+/** Flips the case of letters in [from; from + 25], 32 bytes at a time
+    @param z data
+    @param len data length, at least 32
+    @param from 'a' to convert to uppercase, 'A' to convert to lowercase
+*/
+__attribute__((target("avx2")))
+static void vt_ascii_to_case_avx2(char *const z, const size_t len, const char from) {
+    const __m256i vfrom = _mm256_set1_epi8(from);
+    const __m256i vwidth = _mm256_set1_epi8(25);
+    const __m256i vflip = _mm256_set1_epi8(0x20);
+
+    // the last block overlaps the previous one: converted letters are out of range, so they are not flipped back
+    for (size_t i = 0; i < len; i += 32) {
+        char *const p = z + ((i + 32 <= len) ? i : len - 32);
+        const __m256i v = _mm256_loadu_si256((const __m256i*)p);
+        const __m256i t = _mm256_sub_epi8(v, vfrom);
+        const __m256i letters = _mm256_cmpeq_epi8(_mm256_min_epu8(t, vwidth), t);
+        _mm256_storeu_si256((__m256i*)p, _mm256_xor_si256(v, _mm256_and_si256(letters, vflip)));
+    }
+}
+
+/** Counts leading set members, 32 bytes at a time
+    @param z data
+    @param len data length
+    @param set vt_ascii_set_t instance, with no more than VT_ASCII_SET_MAX_RANGES ranges
+    @returns number of characters
+*/
+__attribute__((target("avx2")))
+static size_t vt_ascii_span_avx2(const char *const z, const size_t len, const vt_ascii_set_t *const set) {
+    __m256i lo[VT_ASCII_SET_MAX_RANGES], width[VT_ASCII_SET_MAX_RANGES];
+    vt_ascii_ranges_avx2(set, lo, width);
+
+    // skip whole blocks of members, the first block with a non-member is finished bytewise
+    size_t i = 0;
+    while (i + 32 <= len && vt_ascii_member_avx2(_mm256_loadu_si256((const __m256i*)(z + i)), lo, width, set->count_ranges) == 0xffffffffu) {
+        i += 32;
+    }
+
+    return i + vt_ascii_span_scalar(z + i, len - i, set);
+}
+
+/** Counts trailing set members, 32 bytes at a time
+    @param z data
+    @param len data length
+    @param set vt_ascii_set_t instance, with no more than VT_ASCII_SET_MAX_RANGES ranges
+    @returns number of characters
+*/
+__attribute__((target("avx2")))
+static size_t vt_ascii_span_last_avx2(const char *const z, const size_t len, const vt_ascii_set_t *const set) {
+    __m256i lo[VT_ASCII_SET_MAX_RANGES], width[VT_ASCII_SET_MAX_RANGES];
+    vt_ascii_ranges_avx2(set, lo, width);
+
+    // skip whole blocks of members from the end, the first block with a non-member is finished bytewise
+    size_t i = len;
+    while (i >= 32 && vt_ascii_member_avx2(_mm256_loadu_si256((const __m256i*)(z + i - 32)), lo, width, set->count_ranges) == 0xffffffffu) {
+        i -= 32;
+    }
+
+    return (len - i) + vt_ascii_span_last_scalar(z, i, set);
+}
+
+/** Removes set members, 32 bytes at a time
+    @param z data
+    @param len data length
+    @param set vt_ascii_set_t instance, with no more than VT_ASCII_SET_MAX_RANGES ranges
+    @returns new length
+*/
+__attribute__((target("avx2")))
+static size_t vt_ascii_remove_avx2(char *const z, const size_t len, const vt_ascii_set_t *const set) {
+    __m256i lo[VT_ASCII_SET_MAX_RANGES], width[VT_ASCII_SET_MAX_RANGES];
+    vt_ascii_ranges_avx2(set, lo, width);
+
+    // the destination never gets ahead of the source, so a block is loaded before it can be overwritten
+    char *dst = z;
+    size_t i = 0;
+    for (; i + 32 <= len; i += 32) {
+        const __m256i v = _mm256_loadu_si256((const __m256i*)(z + i));
+        const uint32_t mask = vt_ascii_member_avx2(v, lo, width, set->count_ranges);
+        if (!mask) {
+            // no members: move the whole block
+            _mm256_storeu_si256((__m256i*)dst, v);
+            dst += 32;
+        } else if (mask != 0xffffffffu) {
+            // keep non-members only: every byte is written, but only non-members advance
+            for (size_t j = 0; j < 32; j++) {
+                *dst = z[i + j];
+                dst += !((mask >> j) & 1);
+            }
+        }
+    }
+    dst += vt_ascii_remove_scalar(dst, z + i, len - i, set);
+
+    return (size_t)(dst - z);
+}
+
+/** Replaces set members, 32 bytes at a time
+    @param z data
+    @param len data length
+    @param set vt_ascii_set_t instance, with no more than VT_ASCII_SET_MAX_RANGES ranges
+    @param map replacement for each byte value
+*/
+__attribute__((target("avx2")))
+static void vt_ascii_replace_avx2(char *const z, const size_t len, const vt_ascii_set_t *const set, const char *const map) {
+    __m256i lo[VT_ASCII_SET_MAX_RANGES], width[VT_ASCII_SET_MAX_RANGES];
+    vt_ascii_ranges_avx2(set, lo, width);
+
+    // blocks without members are skipped, the others go through a full table made on first use
+    char table[256];
+    bool has_table = false;
+    size_t i = 0;
+    for (; i + 32 <= len; i += 32) {
+        if (!vt_ascii_member_avx2(_mm256_loadu_si256((const __m256i*)(z + i)), lo, width, set->count_ranges)) {
+            continue;
+        } else if (!has_table) {
+            vt_ascii_replace_table(table, set, map);
+            has_table = true;
+        }
+
+        for (size_t j = i; j < i + 32; j++) {
+            z[j] = table[(uint8_t)z[j]];
+        }
+    }
+    vt_ascii_replace_scalar(z + i, len - i, set, map);
+}
+#endif
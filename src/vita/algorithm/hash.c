@@ -0,0 +1,247 @@
+#include "vita/algorithm/hash.h"
+
+// XXH64 primes
+#define VT_HASH_P1 0x9e3779b185ebca87ULL
+#define VT_HASH_P2 0xc2b2ae3d27d4eb4fULL
+#define VT_HASH_P3 0x165667b19e3779f9ULL
+#define VT_HASH_P4 0x85ebca77c2b2ae63ULL
+#define VT_HASH_P5 0x27d4eb2f165667c5ULL
+
+static uint64_t vt_hash_rotl(const uint64_t x, const int r);
+static uint64_t vt_hash_read64(const uint8_t *const p);
+static uint32_t vt_hash_read32(const uint8_t *const p);
+static uint64_t vt_hash_round(uint64_t acc, const uint64_t input);
+static uint64_t vt_hash_merge(uint64_t h, const uint64_t acc);
+static const uint8_t *vt_hash_stripes(uint64_t *const acc, const uint8_t *p, const uint8_t *const limit);
+static uint64_t vt_hash_finalize(uint64_t h, const uint8_t *p, size_t len);
+
+uint64_t vt_hash(const void *const data, const size_t len, const uint64_t seed) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(data != NULL || len == 0, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    const uint8_t *p = data;
+    uint64_t h;
+    if (len >= VT_HASH_STRIPE_SIZE) {
+        // process 32-byte stripes with 4 independent accumulators
+        uint64_t acc[4] = { seed + VT_HASH_P1 + VT_HASH_P2, seed + VT_HASH_P2, seed, seed - VT_HASH_P1 };
+        p = vt_hash_stripes(acc, p, p + len - VT_HASH_STRIPE_SIZE);
+
+        h = vt_hash_rotl(acc[0], 1) + vt_hash_rotl(acc[1], 7) + vt_hash_rotl(acc[2], 12) + vt_hash_rotl(acc[3], 18);
+        VT_FOREACH(i, 0, 4) {
+            h = vt_hash_merge(h, acc[i]);
+        }
+    } else {
+        h = seed + VT_HASH_P5;
+    }
+    h += (uint64_t)len;
+
+    return vt_hash_finalize(h, p, len & (VT_HASH_STRIPE_SIZE - 1));
+}
+
+uint64_t vt_hash_z(const char *const z, const uint64_t seed) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(z != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    return vt_hash(z, strlen(z), seed);
+}
+
+uint64_t vt_hash_str(const vt_str_t *const s, const uint64_t seed) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(vt_array_is_valid_object(s), "%s\n", vt_status_to_str(VT_STATUS_ERROR_IS_INVALID_OBJECT));
+    return vt_hash(vt_str_z(s), vt_str_len(s), seed);
+}
+
+uint64_t vt_hash_u32(const uint32_t v, const uint64_t seed) {
+    return vt_hash_u64((uint64_t)v, seed);
+}
+
+uint64_t vt_hash_u64(const uint64_t v, const uint64_t seed) {
+    // two multiply-xorshift rounds, every input bit affects every output bit
+    uint64_t h = (v ^ seed) + VT_HASH_P5;
+    h ^= h >> 32;
+    h *= VT_HASH_P2;
+    h ^= h >> 29;
+    h *= VT_HASH_P3;
+    h ^= h >> 32;
+
+    return h;
+}
+
+void vt_hash_init(vt_hash_state_t *const state, const uint64_t seed) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(state != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    *state = (vt_hash_state_t) {
+        .acc = { seed + VT_HASH_P1 + VT_HASH_P2, seed + VT_HASH_P2, seed, seed - VT_HASH_P1 },
+        .seed = seed,
+    };
+}
+
+void vt_hash_update(vt_hash_state_t *const state, const void *const data, const size_t len) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(state != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    VT_DEBUG_ASSERT(data != NULL || len == 0, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    const uint8_t *p = data;
+    const uint8_t *const end = p + len;
+    state->total_len += len;
+
+    // not enough for a stripe yet
+    if (state->buf_len + len < VT_HASH_STRIPE_SIZE) {
+        if (len) {
+            memcpy(state->buf + state->buf_len, p, len);
+        }
+        state->buf_len += len;
+        return;
+    }
+
+    // complete the buffered stripe
+    if (state->buf_len) {
+        const size_t fill = VT_HASH_STRIPE_SIZE - state->buf_len;
+        memcpy(state->buf + state->buf_len, p, fill);
+        vt_hash_stripes(state->acc, state->buf, state->buf);
+        p += fill;
+        state->buf_len = 0;
+    }
+
+    // whole stripes straight from the input
+    if ((size_t)(end - p) >= VT_HASH_STRIPE_SIZE) {
+        p = vt_hash_stripes(state->acc, p, end - VT_HASH_STRIPE_SIZE);
+    }
+
+    // keep the rest
+    if (p < end) {
+        state->buf_len = (size_t)(end - p);
+        memcpy(state->buf, p, state->buf_len);
+    }
+}
+
+uint64_t vt_hash_digest(const vt_hash_state_t *const state) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(state != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    uint64_t h;
+    if (state->total_len >= VT_HASH_STRIPE_SIZE) {
+        const uint64_t *const acc = state->acc;
+        h = vt_hash_rotl(acc[0], 1) + vt_hash_rotl(acc[1], 7) + vt_hash_rotl(acc[2], 12) + vt_hash_rotl(acc[3], 18);
+        VT_FOREACH(i, 0, 4) {
+            h = vt_hash_merge(h, acc[i]);
+        }
+    } else {
+        h = state->seed + VT_HASH_P5;
+    }
+    h += state->total_len;
+
+    return vt_hash_finalize(h, state->buf, state->buf_len);
+}
+
+/* ---------------------- PRIVATE FUNCTIONS ---------------------- */
+
+/** Rotates bits left
+    @param x value
+    @param r number of bits, 0 < r < 64
+    @returns rotated value
+*/
+static uint64_t vt_hash_rotl(const uint64_t x, const int r) {
+    return (x << r) | (x >> (64 - r));
+}
+
+/** Reads a little-endian 64-bit value, the pointer may be unaligned
+    @param p pointer to data
+    @returns value
+*/
+static uint64_t vt_hash_read64(const uint8_t *const p) {
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    return (uint64_t)p[0] | (uint64_t)p[1] << 8 | (uint64_t)p[2] << 16 | (uint64_t)p[3] << 24
+        | (uint64_t)p[4] << 32 | (uint64_t)p[5] << 40 | (uint64_t)p[6] << 48 | (uint64_t)p[7] << 56;
+#else
+    uint64_t v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+#endif
+}
+
+/** Reads a little-endian 32-bit value, the pointer may be unaligned
+    @param p pointer to data
+    @returns value
+*/
+static uint32_t vt_hash_read32(const uint8_t *const p) {
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    return (uint32_t)p[0] | (uint32_t)p[1] << 8 | (uint32_t)p[2] << 16 | (uint32_t)p[3] << 24;
+#else
+    uint32_t v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+#endif
+}
+
+/** Mixes 8 bytes of input into an accumulator
+    @param acc accumulator
+    @param input input
+    @returns new accumulator value
+*/
+static uint64_t vt_hash_round(uint64_t acc, const uint64_t input) {
+    acc += input * VT_HASH_P2;
+    acc = vt_hash_rotl(acc, 31);
+    return acc * VT_HASH_P1;
+}
+
+/** Merges an accumulator into the hash
+    @param h hash
+    @param acc accumulator
+    @returns new hash
+*/
+static uint64_t vt_hash_merge(uint64_t h, const uint64_t acc) {
+    h ^= vt_hash_round(0, acc);
+    return h * VT_HASH_P1 + VT_HASH_P4;
+}
+
+/** Processes 32-byte stripes
+    @param acc 4 accumulators
+    @param p data
+    @param limit the last stripe starts at or before it
+    @returns pointer past the last stripe processed
+*/
+static const uint8_t *vt_hash_stripes(uint64_t *const acc, const uint8_t *p, const uint8_t *const limit) {
+    uint64_t a0 = acc[0], a1 = acc[1], a2 = acc[2], a3 = acc[3];
+    do {
+        a0 = vt_hash_round(a0, vt_hash_read64(p));
+        a1 = vt_hash_round(a1, vt_hash_read64(p + 8));
+        a2 = vt_hash_round(a2, vt_hash_read64(p + 16));
+        a3 = vt_hash_round(a3, vt_hash_read64(p + 24));
+        p += VT_HASH_STRIPE_SIZE;
+    } while (p <= limit);
+    acc[0] = a0, acc[1] = a1, acc[2] = a2, acc[3] = a3;
+
+    return p;
+}
+
+/** Mixes in the remaining bytes (less than a stripe) and avalanches
+    @param h hash
+    @param p remaining bytes
+    @param len number of remaining bytes
+    @returns final hash
+*/
+static uint64_t vt_hash_finalize(uint64_t h, const uint8_t *p, size_t len) {
+    for (; len >= 8; len -= 8, p += 8) {
+        h ^= vt_hash_round(0, vt_hash_read64(p));
+        h = vt_hash_rotl(h, 27) * VT_HASH_P1 + VT_HASH_P4;
+    }
+    if (len >= 4) {
+        h ^= (uint64_t)vt_hash_read32(p) * VT_HASH_P1;
+        h = vt_hash_rotl(h, 23) * VT_HASH_P2 + VT_HASH_P3;
+        len -= 4, p += 4;
+    }
+    for (; len > 0; len--, p++) {
+        h ^= (uint64_t)*p * VT_HASH_P5;
+        h = vt_hash_rotl(h, 11) * VT_HASH_P1;
+    }
+
+    // avalanche
+    h ^= h >> 33;
+    h *= VT_HASH_P2;
+    h ^= h >> 29;
+    h *= VT_HASH_P3;
+    h ^= h >> 32;
+
+    return h;
+}
@@ -0,0 +1,290 @@
+#include "vita/algorithm/matcher.h"
+
+static void vt_matcher_build(vt_matcher_t *const m, const vt_plist_t *const needles);
+static void vt_matcher_report(const vt_matcher_t *const m, vt_vec_t *const v, const uint32_t t, const size_t end);
+
+vt_matcher_t *vt_matcher_create(const vt_plist_t *const needles, struct VitaBaseAllocatorType *const alloctr) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(needles != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    // assign a class to every byte found in the needles and count the trie size upper bound
+    vt_matcher_t *m = VT_ALLOCATOR_ALLOC_OR_DEFAULT(alloctr, sizeof(vt_matcher_t));
+    *m = (vt_matcher_t) {
+        .alloctr = alloctr,
+        .count_classes = 1,
+        .count_states = 1,
+        .count_patterns = vt_plist_len(needles),
+    };
+    VT_FOREACH(i, 0, m->count_patterns) {
+        const uint8_t *z = vt_plist_get(needles, i);
+        VT_DEBUG_ASSERT(z != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+        for (; *z; z++) {
+            if (!m->classes[*z]) {
+                m->classes[*z] = (uint8_t)m->count_classes++;
+            }
+            m->count_states++;
+        }
+    }
+
+    // transitions are stored premultiplied by the number of classes
+    VT_ENFORCE(
+        m->count_states * m->count_classes < VT_MATCHER_NONE && m->count_patterns < VT_MATCHER_NONE,
+        "%s: Needles are too long to compile (%zu states, %zu classes)!\n",
+        vt_status_to_str(VT_STATUS_ERROR_OUT_OF_MEMORY),
+        m->count_states,
+        m->count_classes
+    );
+
+    // allocate
+    m->next = VT_ALLOCATOR_ALLOC_OR_DEFAULT(alloctr, m->count_states * m->count_classes * sizeof(uint32_t));
+    m->out = VT_ALLOCATOR_ALLOC_OR_DEFAULT(alloctr, m->count_states * sizeof(uint32_t));
+    m->out_link = VT_ALLOCATOR_ALLOC_OR_DEFAULT(alloctr, m->count_states * sizeof(uint32_t));
+    m->pattern_len = VT_ALLOCATOR_ALLOC_OR_DEFAULT(alloctr, (m->count_patterns + 1) * sizeof(uint32_t));
+    m->pattern_next = VT_ALLOCATOR_ALLOC_OR_DEFAULT(alloctr, (m->count_patterns + 1) * sizeof(uint32_t));
+
+    // build the automaton
+    vt_matcher_build(m, needles);
+
+    return m;
+}
+
+void vt_matcher_destroy(vt_matcher_t *m) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(m != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    // free tables
+    VT_ALLOCATOR_FREE_OR_DEFAULT(m->alloctr, m->next);
+    VT_ALLOCATOR_FREE_OR_DEFAULT(m->alloctr, m->out);
+    VT_ALLOCATOR_FREE_OR_DEFAULT(m->alloctr, m->out_link);
+    VT_ALLOCATOR_FREE_OR_DEFAULT(m->alloctr, m->pattern_len);
+    VT_ALLOCATOR_FREE_OR_DEFAULT(m->alloctr, m->pattern_next);
+
+    // free vt_matcher_t instance itself
+    VT_ALLOCATOR_FREE_OR_DEFAULT(m->alloctr, m);
+    m = NULL;
+}
+
+size_t vt_matcher_count_patterns(const vt_matcher_t *const m) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(m != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    return m->count_patterns;
+}
+
+void vt_matcher_reset(vt_matcher_t *const m) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(m != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    m->state = 0;
+    m->offset = 0;
+}
+
+vt_vec_t *vt_matcher_feed(vt_matcher_t *const m, vt_vec_t *vm, const char *const z, const size_t len) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(m != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    VT_DEBUG_ASSERT(z != NULL || !len, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    VT_DEBUG_ASSERT(vm == NULL || vm->elsize == sizeof(vt_matcher_match_t), "%s\n", vt_status_to_str(VT_STATUS_ERROR_INCOMPATIBLE_DATATYPE));
+
+    // create a vt_vec_t instance
+    vt_vec_t *v = (vm == NULL)
+        ? vt_vec_create(VT_ARRAY_DEFAULT_INIT_ELEMENTS, sizeof(vt_matcher_match_t), NULL)
+        : vm;
+    if (v == NULL) {
+        VT_DEBUG_PRINTF("%s\n", vt_status_to_str(VT_STATUS_ERROR_ALLOCATION));
+        return NULL;
+    }
+
+    // one lookup per byte, states with output are numbered last
+    const uint32_t *const next = m->next;
+    const uint8_t *const classes = m->classes;
+    const uint8_t *const data = (const uint8_t*)z;
+    const uint32_t output_from = m->output_from;
+    uint32_t t = m->state;
+    for (size_t i = 0; i < len; i++) {
+        t = next[t + classes[data[i]]];
+        if (t >= output_from) {
+            vt_matcher_report(m, v, t, m->offset + i + 1);
+        }
+    }
+
+    // update
+    m->state = t;
+    m->offset += len;
+
+    return v;
+}
+
+vt_vec_t *vt_matcher_find_all(vt_matcher_t *const m, vt_vec_t *vm, const char *const z, const size_t len) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(m != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    // clear
+    if (vm != NULL) {
+        vt_vec_clear(vm);
+    }
+
+    vt_matcher_reset(m);
+    return vt_matcher_feed(m, vm, z, len);
+}
+
+vt_vec_t *vt_matcher_find_all_str(vt_matcher_t *const m, vt_vec_t *vm, const vt_str_t *const s) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(vt_array_is_valid_object(s), "%s\n", vt_status_to_str(VT_STATUS_ERROR_IS_INVALID_OBJECT));
+
+    return vt_matcher_find_all(m, vm, vt_str_z(s), vt_str_len(s));
+}
+
+bool vt_matcher_find_first(const vt_matcher_t *const m, const char *const z, const size_t len, vt_matcher_match_t *const match) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(m != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    VT_DEBUG_ASSERT(z != NULL || !len, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    // scan until the first state with output
+    const uint8_t *const data = (const uint8_t*)z;
+    uint32_t t = 0;
+    for (size_t i = 0; i < len; i++) {
+        t = m->next[t + m->classes[data[i]]];
+        if (t >= m->output_from) {
+            if (match != NULL) {
+                // the longest needle ending here, it is either in the state itself or along the failure chain
+                const size_t state = t / m->count_classes;
+                const uint32_t id = m->out[state] != VT_MATCHER_NONE ? m->out[state] : m->out[m->out_link[state]];
+                *match = (vt_matcher_match_t) {
+                    .id = id,
+                    .offset = i + 1 - m->pattern_len[id],
+                };
+            }
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/* ---------------------- PRIVATE FUNCTIONS ---------------------- */
+
+/** Builds the trie, turns it into a full transition table breadth-first and renumbers the states
+    @param m vt_matcher_t instance with allocated tables
+    @param needles vt_plist_t of zero-terminated strings
+
+    @note the tables are reallocated to the final number of states
+*/
+static void vt_matcher_build(vt_matcher_t *const m, const vt_plist_t *const needles) {
+    const size_t C = m->count_classes;
+    uint32_t *const next = m->next;
+
+    // the trie: missing transitions are VT_MATCHER_NONE
+    VT_FOREACH(i, 0, m->count_states * C) {
+        next[i] = VT_MATCHER_NONE;
+    }
+    VT_FOREACH(i, 0, m->count_states) {
+        m->out[i] = VT_MATCHER_NONE;
+        m->out_link[i] = 0;
+    }
+
+    // insert the needles, duplicates end in the same state
+    size_t count_states = 1;
+    VT_FOREACH(id, 0, m->count_patterns) {
+        const uint8_t *const z = vt_plist_get(needles, id);
+        size_t state = 0, len = 0;
+        for (; z[len]; len++) {
+            uint32_t *const t = &next[state * C + m->classes[z[len]]];
+            if (*t == VT_MATCHER_NONE) {
+                *t = (uint32_t)count_states++;
+            }
+            state = *t;
+        }
+
+        // link the needle into the state output list, empty needles never match
+        m->pattern_len[id] = (uint32_t)len;
+        m->pattern_next[id] = VT_MATCHER_NONE;
+        if (len) {
+            uint32_t *tail = &m->out[state];
+            while (*tail != VT_MATCHER_NONE) {
+                tail = &m->pattern_next[*tail];
+            }
+            *tail = (uint32_t)id;
+        }
+    }
+    m->count_states = count_states;
+
+    // breadth-first: every state is finished after its failure state, which is shallower
+    uint32_t *const fail = VT_ALLOCATOR_ALLOC_OR_DEFAULT(m->alloctr, count_states * sizeof(uint32_t));
+    uint32_t *const queue = VT_ALLOCATOR_ALLOC_OR_DEFAULT(m->alloctr, count_states * sizeof(uint32_t));
+    size_t head = 0, tail = 0;
+    VT_FOREACH(c, 0, C) {
+        uint32_t *const t = &next[c];
+        if (*t == VT_MATCHER_NONE) {
+            *t = 0;
+        } else {
+            fail[*t] = 0;
+            queue[tail++] = *t;
+        }
+    }
+    while (head < tail) {
+        const uint32_t u = queue[head++];
+        VT_FOREACH(c, 0, C) {
+            uint32_t *const t = &next[u * C + c];
+            const uint32_t f = next[fail[u] * C + c];
+            if (*t == VT_MATCHER_NONE) {
+                *t = f;
+            } else {
+                fail[*t] = f;
+                m->out_link[*t] = m->out[f] != VT_MATCHER_NONE ? f : m->out_link[f];
+                queue[tail++] = *t;
+            }
+        }
+    }
+    VT_ALLOCATOR_FREE_OR_DEFAULT(m->alloctr, fail);
+
+    // renumber: states without output first, so the scan checks for output with a single comparison
+    uint32_t *const order = queue;
+    size_t count_silent = 0;
+    VT_FOREACH(state, 0, count_states) {
+        count_silent += m->out[state] == VT_MATCHER_NONE && !m->out_link[state];
+    }
+    m->output_from = (uint32_t)(count_silent * C);
+    size_t silent = 0, loud = count_silent;
+    VT_FOREACH(state, 0, count_states) {
+        order[state] = (uint32_t)((m->out[state] == VT_MATCHER_NONE && !m->out_link[state]) ? silent++ : loud++);
+    }
+
+    // move the tables into the new order, transitions are premultiplied
+    uint32_t *const next_new = VT_ALLOCATOR_ALLOC_OR_DEFAULT(m->alloctr, count_states * C * sizeof(uint32_t));
+    uint32_t *const out_new = VT_ALLOCATOR_ALLOC_OR_DEFAULT(m->alloctr, count_states * sizeof(uint32_t));
+    uint32_t *const out_link_new = VT_ALLOCATOR_ALLOC_OR_DEFAULT(m->alloctr, count_states * sizeof(uint32_t));
+    VT_FOREACH(state, 0, count_states) {
+        const size_t to = order[state];
+        VT_FOREACH(c, 0, C) {
+            next_new[to * C + c] = (uint32_t)(order[next[state * C + c]] * C);
+        }
+        out_new[to] = m->out[state];
+        out_link_new[to] = order[m->out_link[state]];
+    }
+    VT_ALLOCATOR_FREE_OR_DEFAULT(m->alloctr, order);
+    VT_ALLOCATOR_FREE_OR_DEFAULT(m->alloctr, m->next);
+    VT_ALLOCATOR_FREE_OR_DEFAULT(m->alloctr, m->out);
+    VT_ALLOCATOR_FREE_OR_DEFAULT(m->alloctr, m->out_link);
+    m->next = next_new;
+    m->out = out_new;
+    m->out_link = out_link_new;
+}
+
+/** Appends all needles that end in a state
+    @param m vt_matcher_t instance
+    @param v vt_vec_t of vt_matcher_match_t
+    @param t transition value
+    @param end offset past the last matched byte
+*/
+static void vt_matcher_report(const vt_matcher_t *const m, vt_vec_t *const v, const uint32_t t, const size_t end) {
+    // the state itself, then shorter suffixes along the failure chain
+    for (size_t state = t / m->count_classes; state; state = m->out_link[state]) {
+        for (uint32_t id = m->out[state]; id != VT_MATCHER_NONE; id = m->pattern_next[id]) {
+            const vt_matcher_match_t match = {
+                .id = id,
+                .offset = end - m->pattern_len[id],
+            };
+            vt_vec_push_back(v, &match);
+        }
+    }
+}
@@ -1,5 +1,84 @@
 #include "vita/algorithm/search.h"
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define VT_SEARCH_SSE2
+    #include <emmintrin.h>
+#endif
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    // compiled for AVX2 and AVX-512 regardless of the target flags, used only if the CPU supports them
+    #define VT_SEARCH_AVX2
+    #include <immintrin.h>
+#endif
+
+#if defined(_MSC_VER)
+    #include <intrin.h>
+#endif
+
+// the filter gives up after this many false candidates at position `pos`, Two-Way continues from there
+#define VT_SEARCH_FILTER_BUDGET(pos) (64 + ((pos) >> 3))
+
+static const char *vt_search_substr_filter(const char *const z, const size_t zLen, const char *const sub, const size_t subLen, size_t *const resume);
+static const char *vt_search_substr_scalar(const char *const z, const size_t zLen, const char *const sub, const size_t subLen);
+static const char *vt_search_substr_two_way(const char *const z, const size_t zLen, const char *const sub, const size_t subLen);
+#ifdef VT_SEARCH_SSE2
+    static const char *vt_search_substr_sse2(const char *const z, const size_t zLen, const char *const sub, const size_t subLen, const size_t k, size_t *const resume);
+#endif
+#ifdef VT_SEARCH_AVX2
+    static const char *vt_search_substr_avx2(const char *const z, const size_t zLen, const char *const sub, const size_t subLen, const size_t k, size_t *const resume);
+    static const char *vt_search_substr_avx512(const char *const z, const size_t zLen, const char *const sub, const size_t subLen, const size_t k, size_t *const resume);
+#endif
+static uint32_t vt_search_ctz(const uint64_t x);
+
+const char *vt_search_substr(const char *const z, const size_t zLen, const char *const sub, const size_t subLen) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(z != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    VT_DEBUG_ASSERT(sub != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    // trivial cases
+    if (subLen == 0) {
+        return z;
+    } else if (subLen > zLen) {
+        return NULL;
+    } else if (subLen == 1) {
+        return memchr(z, sub[0], zLen);
+    }
+
+    // filter candidates by two needle bytes
+    size_t resume = SIZE_MAX;
+    const char *const p = vt_search_substr_filter(z, zLen, sub, subLen, &resume);
+    if (p != NULL || resume == SIZE_MAX) {
+        return p;
+    }
+
+    // too many false candidates, switch to Two-Way
+    return vt_search_substr_two_way(z + resume, zLen - resume, sub, subLen);
+}
+
+const char *vt_search_substr_last(const char *const z, const size_t zLen, const char *const sub, const size_t subLen) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(z != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    VT_DEBUG_ASSERT(sub != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    // trivial cases
+    if (subLen == 0) {
+        return z + zLen;
+    } else if (subLen > zLen) {
+        return NULL;
+    }
+
+    // scan backwards, checking the first and last bytes before comparing the rest
+    const char first = sub[0];
+    const char last = sub[subLen - 1];
+    for (size_t i = zLen - subLen + 1; i-- > 0;) {
+        if (z[i] == first && z[i + subLen - 1] == last && !memcmp(z + i, sub, subLen)) {
+            return z + i;
+        }
+    }
+
+    return NULL;
+}
+
 // int64_t search_linear(const char *const arr, const size_t len, const size_t elsize, const void *val, int8_t (*compare)(const void *a, const void *b)) {
 //     if (arr == NULL || val == NULL) {
 //         return -1;
@@ -48,3 +127,362 @@
 // }
 
 void search_test(void) {}
+
+/* ---------------------- PRIVATE FUNCTIONS ---------------------- */
+
+/** Finds a needle (2 bytes or longer) with the widest SIMD byte filter available
+    @param z haystack
+    @param zLen haystack length, not less than `subLen`
+    @param sub needle
+    @param subLen needle length
+    @param resume set to the offset to continue from with Two-Way if the filter gave up
+
+    @returns pointer to the first occurrence in `z`, `NULL` if not found
+*/
+static const char *vt_search_substr_filter(const char *const z, const size_t zLen, const char *const sub, const size_t subLen, size_t *const resume) {
+#if defined(VT_SEARCH_AVX2) || defined(VT_SEARCH_SSE2)
+    // compare the first byte and the last byte that differs from it, so runs like "aaab" are not matched everywhere
+    size_t k = subLen - 1;
+    while (k > 1 && sub[k] == sub[0]) {
+        k--;
+    }
+#endif
+
+#ifdef VT_SEARCH_AVX2
+    const int8_t cpu_level = vt_cpu_simd_level();
+    if (zLen - subLen + 1 >= 64 && cpu_level >= 2) {
+        return vt_search_substr_avx512(z, zLen, sub, subLen, k, resume);
+    } else if (zLen - subLen + 1 >= 32 && cpu_level >= 1) {
+        return vt_search_substr_avx2(z, zLen, sub, subLen, k, resume);
+    }
+#endif
+#ifdef VT_SEARCH_SSE2
+    if (zLen - subLen + 1 >= 16) {
+        return vt_search_substr_sse2(z, zLen, sub, subLen, k, resume);
+    }
+#endif
+    (void)resume;
+    return vt_search_substr_scalar(z, zLen, sub, subLen);
+}
+
+/** Finds a needle (2 bytes or longer) by locating its first byte with memchr and checking the last byte before comparing
+    @param z haystack
+    @param zLen haystack length, not less than `subLen`
+    @param sub needle
+    @param subLen needle length
+
+    @returns pointer to the first occurrence in `z`, `NULL` if not found
+*/
+static const char *vt_search_substr_scalar(const char *const z, const size_t zLen, const char *const sub, const size_t subLen) {
+    const char *const end = z + zLen - subLen + 1;
+    for (const char *p = z; p < end && (p = memchr(p, sub[0], (size_t)(end - p))) != NULL; p++) {
+        if (p[subLen - 1] == sub[subLen - 1] && !memcmp(p + 1, sub + 1, subLen - 2)) {
+            return p;
+        }
+    }
+
+    return NULL;
+}
+
+#ifdef VT_SEARCH_SSE2
+/** Finds a needle (2 bytes or longer) comparing two of its bytes at 16 positions at once
+    @param z haystack
+    @param zLen haystack length, at least `subLen + 15`
+    @param sub needle
+    @param subLen needle length
+    @param k index of the second byte to compare, the first one is `sub[0]`
+    @param resume set to the offset to continue from with Two-Way if the filter gave up
+
+    @returns pointer to the first occurrence in `z`, `NULL` if not found
+*/
+static const char *vt_search_substr_sse2(const char *const z, const size_t zLen, const char *const sub, const size_t subLen, const size_t k, size_t *const resume) {
+    const __m128i first = _mm_set1_epi8(sub[0]);
+    const __m128i last = _mm_set1_epi8(sub[k]);
+    const size_t count = zLen - subLen + 1; // candidate positions
+    size_t misses = 0;
+
+    // positions i..i+15 are checked at once, both loads stay within the haystack
+    size_t i = 0;
+    while (i < count) {
+        // skip blocks without candidates two at a time
+        while (i + 2 * 16 <= count) {
+            const __m128i m0 = _mm_and_si128(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)(z + i)), first), _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)(z + i + k)), last));
+            const __m128i m1 = _mm_and_si128(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)(z + i + 16)), first), _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)(z + i + 16 + k)), last));
+            if (_mm_movemask_epi8(_mm_or_si128(m0, m1))) {
+                break;
+            }
+            i += 2 * 16;
+        }
+        if (i >= count) {
+            break;
+        }
+
+        // overlap the last block with the previous one and drop the positions already checked
+        const size_t base = (i + 16 <= count) ? i : count - 16;
+        const __m128i block_first = _mm_loadu_si128((const __m128i*)(z + base));
+        const __m128i block_last = _mm_loadu_si128((const __m128i*)(z + base + k));
+        uint32_t mask = (uint32_t)_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(block_first, first), _mm_cmpeq_epi8(block_last, last)));
+        mask &= 0xffffu << (i - base);
+
+        while (mask) {
+            const size_t pos = base + vt_search_ctz(mask);
+            if (!memcmp(z + pos + 1, sub + 1, subLen - 1)) {
+                return z + pos;
+            } else if (++misses > VT_SEARCH_FILTER_BUDGET(pos)) {
+                *resume = pos + 1;
+                return NULL;
+            }
+            mask &= mask - 1;
+        }
+        i = base + 16;
+    }
+
+    return NULL;
+}
+#endif
+
+#ifdef VT_SEARCH_AVX2
+/** Finds a needle (2 bytes or longer) comparing two of its bytes at 32 positions at once
+    @param z haystack
+    @param zLen haystack length, at least `subLen + 31`
+    @param sub needle
+    @param subLen needle length
+    @param k index of the second byte to compare, the first one is `sub[0]`
+    @param resume set to the offset to continue from with Two-Way if the filter gave up
+
+    @returns pointer to the first occurrence in `z`, `NULL` if not found
+*/
+__attribute__((target("avx2")))
+static const char *vt_search_substr_avx2(const char *const z, const size_t zLen, const char *const sub, const size_t subLen, const size_t k, size_t *const resume) {
+    const __m256i first = _mm256_set1_epi8(sub[0]);
+    const __m256i last = _mm256_set1_epi8(sub[k]);
+    const size_t count = zLen - subLen + 1; // candidate positions
+    size_t misses = 0;
+
+    // positions i..i+31 are checked at once, both loads stay within the haystack
+    size_t i = 0;
+    while (i < count) {
+        // skip blocks without candidates two at a time
+        while (i + 2 * 32 <= count) {
+            const __m256i m0 = _mm256_and_si256(_mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i*)(z + i)), first), _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i*)(z + i + k)), last));
+            const __m256i m1 = _mm256_and_si256(_mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i*)(z + i + 32)), first), _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i*)(z + i + 32 + k)), last));
+            if (_mm256_movemask_epi8(_mm256_or_si256(m0, m1))) {
+                break;
+            }
+            i += 2 * 32;
+        }
+        if (i >= count) {
+            break;
+        }
+
+        // overlap the last block with the previous one and drop the positions already checked
+        const size_t base = (i + 32 <= count) ? i : count - 32;
+        const __m256i block_first = _mm256_loadu_si256((const __m256i*)(z + base));
+        const __m256i block_last = _mm256_loadu_si256((const __m256i*)(z + base + k));
+        uint32_t mask = (uint32_t)_mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(block_first, first), _mm256_cmpeq_epi8(block_last, last)));
+        mask &= 0xffffffffu << (i - base);
+
+        while (mask) {
+            const size_t pos = base + vt_search_ctz(mask);
+            if (!memcmp(z + pos + 1, sub + 1, subLen - 1)) {
+                return z + pos;
+            } else if (++misses > VT_SEARCH_FILTER_BUDGET(pos)) {
+                *resume = pos + 1;
+                return NULL;
+            }
+            mask &= mask - 1;
+        }
+        i = base + 32;
+    }
+
+    return NULL;
+}
+
+/** Finds a needle (2 bytes or longer) comparing two of its bytes at 64 positions at once
+    @param z haystack
+    @param zLen haystack length, at least `subLen + 63`
+    @param sub needle
+    @param subLen needle length
+    @param k index of the second byte to compare, the first one is `sub[0]`
+    @param resume set to the offset to continue from with Two-Way if the filter gave up
+
+    @returns pointer to the first occurrence in `z`, `NULL` if not found
+*/
+__attribute__((target("avx512f,avx512bw")))
+static const char *vt_search_substr_avx512(const char *const z, const size_t zLen, const char *const sub, const size_t subLen, const size_t k, size_t *const resume) {
+    const __m512i first = _mm512_set1_epi8(sub[0]);
+    const __m512i last = _mm512_set1_epi8(sub[k]);
+    const size_t count = zLen - subLen + 1; // candidate positions
+    size_t misses = 0;
+
+    // positions i..i+63 are checked at once, both loads stay within the haystack
+    size_t i = 0;
+    while (i < count) {
+        // skip blocks without candidates two at a time
+        while (i + 2 * 64 <= count) {
+            const __mmask64 m0 = _mm512_mask_cmpeq_epi8_mask(_mm512_cmpeq_epi8_mask(_mm512_loadu_si512((const void*)(z + i)), first), _mm512_loadu_si512((const void*)(z + i + k)), last);
+            const __mmask64 m1 = _mm512_mask_cmpeq_epi8_mask(_mm512_cmpeq_epi8_mask(_mm512_loadu_si512((const void*)(z + i + 64)), first), _mm512_loadu_si512((const void*)(z + i + 64 + k)), last);
+            if (m0 | m1) {
+                break;
+            }
+            i += 2 * 64;
+        }
+        if (i >= count) {
+            break;
+        }
+
+        // overlap the last block with the previous one and drop the positions already checked
+        const size_t base = (i + 64 <= count) ? i : count - 64;
+        const __mmask64 first_mask = _mm512_cmpeq_epi8_mask(_mm512_loadu_si512((const void*)(z + base)), first);
+        uint64_t mask = _mm512_mask_cmpeq_epi8_mask(first_mask, _mm512_loadu_si512((const void*)(z + base + k)), last);
+        mask &= ~(uint64_t)0 << (i - base);
+
+        while (mask) {
+            const size_t pos = base + vt_search_ctz(mask);
+            if (!memcmp(z + pos + 1, sub + 1, subLen - 1)) {
+                return z + pos;
+            } else if (++misses > VT_SEARCH_FILTER_BUDGET(pos)) {
+                *resume = pos + 1;
+                return NULL;
+            }
+            mask &= mask - 1;
+        }
+        i = base + 64;
+    }
+
+    return NULL;
+}
+#endif
+
+/** Finds a needle with the Two-Way algorithm (Crochemore-Perrin): linear time and constant space
+    @param z haystack
+    @param zLen haystack length
+    @param sub needle
+    @param subLen needle length
+
+    @returns pointer to the first occurrence in `z`, `NULL` if not found
+*/
+static const char *vt_search_substr_two_way(const char *const z, const size_t zLen, const char *const sub, const size_t subLen) {
+    const unsigned char *h = (const unsigned char*)z;
+    const unsigned char *const hend = h + zLen;
+    const unsigned char *const n = (const unsigned char*)sub;
+    const size_t l = subLen;
+
+    // bad character shift: distance from the last occurrence of a byte to the end of the needle
+    bool byteset[256] = {0};
+    size_t shift[256];
+    for (size_t i = 0; i < l; i++) {
+        byteset[n[i]] = true;
+        shift[n[i]] = i + 1;
+    }
+
+    // critical factorization: maximal suffix for `<` (ip wraps around on purpose to start at -1)
+    size_t ip = (size_t)-1, jp = 0, k = 1, p = 1;
+    while (jp + k < l) {
+        if (n[ip + k] == n[jp + k]) {
+            if (k == p) {
+                jp += p;
+                k = 1;
+            } else {
+                k++;
+            }
+        } else if (n[ip + k] > n[jp + k]) {
+            jp += k;
+            k = 1;
+            p = jp - ip;
+        } else {
+            ip = jp++;
+            k = p = 1;
+        }
+    }
+    size_t ms = ip;
+    const size_t p0 = p;
+
+    // maximal suffix for `>`
+    ip = (size_t)-1, jp = 0, k = p = 1;
+    while (jp + k < l) {
+        if (n[ip + k] == n[jp + k]) {
+            if (k == p) {
+                jp += p;
+                k = 1;
+            } else {
+                k++;
+            }
+        } else if (n[ip + k] < n[jp + k]) {
+            jp += k;
+            k = 1;
+            p = jp - ip;
+        } else {
+            ip = jp++;
+            k = p = 1;
+        }
+    }
+
+    // pick the longer suffix
+    if (ip + 1 > ms + 1) {
+        ms = ip;
+    } else {
+        p = p0;
+    }
+
+    // periodic needles remember how much of the needle already matched
+    size_t mem0 = 0;
+    if (memcmp(n, n + p, ms + 1)) {
+        p = ((ms > l - ms - 1) ? ms : l - ms - 1) + 1;
+    } else {
+        mem0 = l - p;
+    }
+
+    // search
+    size_t mem = 0;
+    while ((size_t)(hend - h) >= l) {
+        // check the last byte first and skip ahead on a mismatch
+        const unsigned char c = h[l - 1];
+        if (!byteset[c]) {
+            h += l;
+            mem = 0;
+            continue;
+        }
+        k = l - shift[c];
+        if (k) {
+            h += (k < mem) ? mem : k;
+            mem = 0;
+            continue;
+        }
+
+        // compare the right half
+        for (k = (ms + 1 > mem) ? ms + 1 : mem; k < l && n[k] == h[k]; k++);
+        if (k < l) {
+            h += k - ms;
+            mem = 0;
+            continue;
+        }
+
+        // compare the left half
+        for (k = ms + 1; k > mem && n[k - 1] == h[k - 1]; k--);
+        if (k <= mem) {
+            return (const char*)h;
+        }
+        h += p;
+        mem = mem0;
+    }
+
+    return NULL;
+}
+
+/** Counts trailing zero bits
+    @param x non-zero value
+    @returns number of trailing zeros
+*/
+static uint32_t vt_search_ctz(const uint64_t x) {
+#if defined(_MSC_VER)
+    unsigned long idx = 0;
+    if (!_BitScanForward(&idx, (unsigned long)x)) {
+        _BitScanForward(&idx, (unsigned long)(x >> 32));
+        idx += 32;
+    }
+    return (uint32_t)idx;
+#else
+    return (uint32_t)__builtin_ctzll(x);
+#endif
+}
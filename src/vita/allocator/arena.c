@@ -0,0 +1,260 @@
+#include "vita/allocator/arena.h"
+
+// header stored in front of every block
+struct VitaArenaBlockHeader {
+    size_t bytes;               // block size
+    size_t alignment;           // block alignment, kept when the block is moved
+};
+
+static void *vt_arena_carve(vt_arena_t *const arena, const size_t bytes, const size_t alignment);
+static struct VitaArenaChunk *vt_arena_chunk_create(const vt_arena_t *const arena, const size_t capacity, struct VitaArenaChunk *const next);
+static void vt_arena_chunks_free(vt_arena_t *const arena);
+static void *vt_arena_chunk_carve(struct VitaArenaChunk *const chunk, const size_t bytes, const size_t alignment);
+static char *vt_arena_chunk_data(const struct VitaArenaChunk *const chunk);
+static struct VitaArenaBlockHeader *vt_arena_block_header(const void *const ptr);
+
+vt_arena_t *vt_arena_create(const size_t chunk_size, struct VitaBaseAllocatorType *const alloctr) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(chunk_size > 0, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    // create an arena instance
+    vt_arena_t *arena = VT_ALLOCATOR_ALLOC_OR_DEFAULT(alloctr, sizeof(vt_arena_t));
+    *arena = (vt_arena_t) {
+        .alloctr = alloctr,
+        .chunk_size = chunk_size,
+    };
+    arena->chunk = vt_arena_chunk_create(arena, chunk_size, NULL);
+
+    // set up functions
+    arena->base.alloc = vt_arena_alloc;
+    arena->base.realloc = vt_arena_realloc;
+    arena->base.free = vt_arena_free;
+    arena->base.alloc_aligned = vt_arena_alloc_aligned;
+
+    return arena;
+}
+
+void vt_arena_destroy(vt_arena_t *arena) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(arena != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    // free all chunks
+    vt_arena_chunks_free(arena);
+
+    // free arena itself
+    VT_ALLOCATOR_FREE_OR_DEFAULT(arena->alloctr, arena);
+    arena = NULL;
+}
+
+void vt_arena_reset(vt_arena_t *const arena) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(arena != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    VT_DEBUG_ASSERT(arena->chunk != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_IS_NULL));
+
+    // merge chunks into one, so the next cycle of the same size needs no new chunks
+    if (arena->chunk->next != NULL) {
+        const size_t capacity = vt_arena_capacity(arena);
+
+        // free all chunks
+        vt_arena_chunks_free(arena);
+        arena->chunk = vt_arena_chunk_create(arena, capacity, NULL);
+    }
+
+    // reset
+    arena->chunk->offset = 0;
+    arena->last_ptr = NULL;
+
+    // update stats
+    arena->base.stats.count_bytes_freed += arena->base.stats.count_bytes_allocated;
+    arena->base.stats.count_bytes_allocated = 0;
+    arena->base.stats.count_objects_live = 0;
+}
+
+void *vt_arena_alloc(struct VitaBaseAllocatorType *const alloctr, const size_t bytes, const char *const file, const char *const func, const size_t line) {
+    return vt_arena_alloc_aligned(alloctr, bytes, VT_ARENA_ALIGNMENT, file, func, line);
+}
+
+void *vt_arena_alloc_aligned(struct VitaBaseAllocatorType *const alloctr, const size_t bytes, const size_t alignment, const char *const file, const char *const func, const size_t line) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(alloctr != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    VT_DEBUG_ASSERT(bytes > 0, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    VT_DEBUG_ASSERT(alignment > 0 && (alignment & (alignment - 1)) == 0, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    // allocate memory
+    void *const ptr = vt_arena_carve((vt_arena_t*)alloctr, bytes, alignment < VT_ARENA_ALIGNMENT ? VT_ARENA_ALIGNMENT : alignment);
+
+    // update stats
+    vt_allocator_stats_on_alloc(&alloctr->stats, bytes);
+
+    // debug info
+    VT_DEBUG_PRINTF("%s:%s:%zu: %zu bytes allocated\n", file, func, line, bytes);
+    (void)file;
+    (void)func;
+    (void)line;
+
+    return ptr;
+}
+
+void *vt_arena_realloc(struct VitaBaseAllocatorType *const alloctr, void *ptr, const size_t bytes, const char *const file, const char *const func, const size_t line) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(alloctr != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    VT_DEBUG_ASSERT(ptr != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    VT_DEBUG_ASSERT(bytes > 0, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    vt_arena_t *const arena = (vt_arena_t*)alloctr;
+    struct VitaArenaBlockHeader *const header = vt_arena_block_header(ptr);
+    const size_t bytes_old = header->bytes;
+
+    // resize in place: the last allocation can grow up to the end of the chunk, any block can shrink
+    void *ptr_new = ptr;
+    const size_t ptr_offset = (ptr == arena->last_ptr) ? (size_t)((char*)ptr - vt_arena_chunk_data(arena->chunk)) : 0;
+    if (ptr == arena->last_ptr && ptr_offset + bytes <= arena->chunk->capacity) {
+        if (bytes > bytes_old) {
+            memset((char*)ptr + bytes_old, 0, bytes - bytes_old);
+        }
+        arena->chunk->offset = ptr_offset + bytes;
+        header->bytes = bytes;
+    } else if (bytes <= bytes_old) {
+        header->bytes = bytes;
+    } else {
+        // allocate a new block with the same alignment and copy the data
+        ptr_new = vt_arena_carve(arena, bytes, header->alignment);
+        memcpy(ptr_new, ptr, bytes_old);
+    }
+
+    // update stats
+    vt_allocator_stats_on_realloc(&alloctr->stats, bytes_old, bytes);
+
+    // debug info
+    VT_DEBUG_PRINTF("%s:%s:%zu: %zu bytes reallocated (old size: %zu)\n", file, func, line, bytes, bytes_old);
+    (void)file;
+    (void)func;
+    (void)line;
+
+    return ptr_new;
+}
+
+void vt_arena_free(struct VitaBaseAllocatorType *const alloctr, void *ptr, const char *const file, const char *const func, const size_t line) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(alloctr != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    VT_DEBUG_ASSERT(ptr != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    // memory is released upon reset, so the block stays live until then and only the call is counted
+    alloctr->stats.count_frees++;
+
+    (void)ptr;
+    (void)file;
+    (void)func;
+    (void)line;
+}
+
+size_t vt_arena_capacity(const vt_arena_t *const arena) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(arena != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    size_t capacity = 0;
+    for (const struct VitaArenaChunk *chunk = arena->chunk; chunk != NULL; chunk = chunk->next) {
+        capacity += chunk->capacity;
+    }
+
+    return capacity;
+}
+
+/* ---------------------- PRIVATE FUNCTIONS ---------------------- */
+
+/** Carves a block from the current chunk or from a new chunk if there is not enough space
+    @param arena vt_arena_t instance
+    @param bytes block size
+    @param alignment block alignment (power of 2)
+
+    @returns pointer to zero-initialized block
+*/
+static void *vt_arena_carve(vt_arena_t *const arena, const size_t bytes, const size_t alignment) {
+    void *ptr = vt_arena_chunk_carve(arena->chunk, bytes, alignment);
+    if (ptr == NULL) {
+        const size_t required = bytes + sizeof(struct VitaArenaBlockHeader) + alignment;
+        arena->chunk = vt_arena_chunk_create(arena, required > arena->chunk_size ? required : arena->chunk_size, arena->chunk);
+        ptr = vt_arena_chunk_carve(arena->chunk, bytes, alignment);
+    }
+    arena->last_ptr = ptr;
+
+    return ptr;
+}
+
+/** Allocates a new chunk
+    @param arena vt_arena_t instance
+    @param capacity chunk data size
+    @param next next chunk in list
+
+    @returns chunk
+*/
+static struct VitaArenaChunk *vt_arena_chunk_create(const vt_arena_t *const arena, const size_t capacity, struct VitaArenaChunk *const next) {
+    // the default heap skips zeroing, since blocks are zeroed upon carving
+    const size_t bytes = sizeof(struct VitaArenaChunk) + capacity;
+    struct VitaArenaChunk *const chunk = arena->alloctr ? VT_ALLOCATOR_ALLOC(arena->alloctr, bytes) : VT_MALLOC(bytes);
+    *chunk = (struct VitaArenaChunk) {
+        .next = next,
+        .capacity = capacity,
+        .offset = 0,
+    };
+
+    return chunk;
+}
+
+/** Frees all chunks
+    @param arena vt_arena_t instance
+*/
+static void vt_arena_chunks_free(vt_arena_t *const arena) {
+    struct VitaArenaChunk *chunk = arena->chunk;
+    while (chunk != NULL) {
+        struct VitaArenaChunk *const next = chunk->next;
+        VT_ALLOCATOR_FREE_OR_DEFAULT(arena->alloctr, chunk);
+        chunk = next;
+    }
+    arena->chunk = NULL;
+}
+
+/** Carves an aligned zero-initialized block from chunk preceded by its header
+    @param chunk chunk instance
+    @param bytes block size
+    @param alignment block alignment (power of 2)
+
+    @returns pointer to block or `NULL` if chunk does not have enough space
+*/
+static void *vt_arena_chunk_carve(struct VitaArenaChunk *const chunk, const size_t bytes, const size_t alignment) {
+    // find an aligned address with enough room for the block header
+    char *const data = vt_arena_chunk_data(chunk);
+    const uintptr_t addr = (uintptr_t)(data + chunk->offset + sizeof(struct VitaArenaBlockHeader));
+    const size_t offset = (size_t)(((addr + alignment - 1) & ~(uintptr_t)(alignment - 1)) - (uintptr_t)data);
+
+    // check if we have enough space
+    if (offset + bytes > chunk->capacity) {
+        return NULL;
+    }
+
+    // save block info and move the offset
+    void *const ptr = data + offset;
+    *vt_arena_block_header(ptr) = (struct VitaArenaBlockHeader) {
+        .bytes = bytes,
+        .alignment = alignment,
+    };
+    chunk->offset = offset + bytes;
+
+    return memset(ptr, 0, bytes);
+}
+
+/** Returns chunk data start
+    @param chunk chunk instance
+    @returns pointer to chunk data
+*/
+static char *vt_arena_chunk_data(const struct VitaArenaChunk *const chunk) {
+    return (char*)(chunk + 1);
+}
+
+/** Returns header of an allocated block
+    @param ptr allocated block
+    @returns pointer to block header
+*/
+static struct VitaArenaBlockHeader *vt_arena_block_header(const void *const ptr) {
+    return (struct VitaArenaBlockHeader*)ptr - 1;
+}
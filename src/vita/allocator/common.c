@@ -0,0 +1,79 @@
+#include "vita/allocator/common.h"
+
+void *vt_allocator_alloc_aligned(struct VitaBaseAllocatorType *const alloctr, const size_t bytes, const size_t alignment, const char *const file, const char *const func, const size_t line) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(alloctr != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    VT_DEBUG_ASSERT(bytes > 0, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    VT_DEBUG_ASSERT(alignment > 0 && (alignment & (alignment - 1)) == 0, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    // the default alignment is guaranteed by every allocator
+    if (alignment <= VT_ALLOCATOR_DEFAULT_ALIGNMENT) {
+        return alloctr->alloc(alloctr, bytes, file, func, line);
+    }
+
+    VT_ENFORCE(alloctr->alloc_aligned != NULL, "%s: allocator does not support %zu-byte alignment\n", vt_status_to_str(VT_STATUS_OPERATION_FAILURE), alignment);
+    return alloctr->alloc_aligned(alloctr, bytes, alignment, file, func, line);
+}
+
+bool vt_allocator_expand(struct VitaBaseAllocatorType *const alloctr, void *const ptr, const size_t bytes, const char *const file, const char *const func, const size_t line) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(alloctr != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    VT_DEBUG_ASSERT(ptr != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    VT_DEBUG_ASSERT(bytes > 0, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    return alloctr->expand != NULL && alloctr->expand(alloctr, ptr, bytes, file, func, line);
+}
+
+struct VitaAllocatorStats vt_allocator_get_stats(const struct VitaBaseAllocatorType *const alloctr) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(alloctr != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    return alloctr->stats;
+}
+
+void vt_allocator_stats_on_alloc(struct VitaAllocatorStats *const stats, const size_t bytes) {
+    stats->count_allocs++;
+    stats->count_bytes_allocated += bytes;
+    stats->count_objects_live++;
+    stats->count_size_hist[vt_allocator_stats_hist_bin(bytes)]++;
+    vt_allocator_stats_update_peak(stats);
+}
+
+void vt_allocator_stats_on_realloc(struct VitaAllocatorStats *const stats, const size_t bytes_old, const size_t bytes) {
+    stats->count_reallocs++;
+    if (bytes > bytes_old) {
+        stats->count_reallocs_grow++;
+        stats->count_bytes_allocated += bytes - bytes_old;
+    } else if (bytes < bytes_old) {
+        stats->count_reallocs_shrink++;
+        stats->count_bytes_allocated -= bytes_old - bytes;
+        stats->count_bytes_freed += bytes_old - bytes;
+    }
+    stats->count_size_hist[vt_allocator_stats_hist_bin(bytes)]++;
+    vt_allocator_stats_update_peak(stats);
+}
+
+void vt_allocator_stats_on_free(struct VitaAllocatorStats *const stats, const size_t bytes) {
+    stats->count_frees++;
+    stats->count_bytes_allocated -= bytes;
+    stats->count_bytes_freed += bytes;
+    stats->count_objects_live--;
+}
+
+void vt_allocator_stats_update_peak(struct VitaAllocatorStats *const stats) {
+    if (stats->count_bytes_allocated > stats->count_bytes_peak) {
+        stats->count_bytes_peak = stats->count_bytes_allocated;
+    }
+    if (stats->count_objects_live > stats->count_objects_peak) {
+        stats->count_objects_peak = stats->count_objects_live;
+    }
+}
+
+size_t vt_allocator_stats_hist_bin(const size_t bytes) {
+    size_t bin = 0;
+    for (size_t b = bytes; b > 1 && bin < VT_ALLOCATOR_HIST_BINS - 1; b >>= 1) {
+        bin++;
+    }
+
+    return bin;
+}
@@ -0,0 +1,403 @@
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+    #define _GNU_SOURCE // mremap
+#endif
+
+#include "vita/allocator/hpallocator.h"
+
+#if defined(_WIN32) || defined(_WIN64)
+    #include <windows.h>
+#else
+    #include <sys/mman.h>
+#endif
+
+static struct VitaHugePageBlock *vt_hpallocator_block_alloc(vt_hpallocator_t *const hp, const size_t bytes);
+static void vt_hpallocator_block_free(vt_hpallocator_t *const hp, struct VitaHugePageBlock *const block);
+static void vt_hpallocator_block_relink(vt_hpallocator_t *const hp, struct VitaHugePageBlock *const block);
+static struct VitaHugePageBlock *vt_hpallocator_block_header(const void *const ptr);
+static char *vt_hpallocator_block_data(const struct VitaHugePageBlock *const block);
+static size_t vt_hpallocator_map_len(const size_t bytes);
+static void *vt_hpallocator_map(const size_t len);
+static void *vt_hpallocator_remap(void *const addr, const size_t len_old, const size_t len);
+static bool vt_hpallocator_remap_in_place(void *const addr, const size_t len_old, const size_t len);
+static void vt_hpallocator_unmap(void *const addr, const size_t len);
+
+vt_hpallocator_t *vt_hpallocator_create(const size_t threshold) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(threshold > 0, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    // create an allocator instance
+    vt_hpallocator_t *hp = VT_CALLOC(sizeof(vt_hpallocator_t));
+    hp->threshold = threshold;
+
+    // set up functions
+    hp->base.alloc = vt_hpallocator_alloc;
+    hp->base.realloc = vt_hpallocator_realloc;
+    hp->base.free = vt_hpallocator_free;
+    hp->base.alloc_aligned = vt_hpallocator_alloc_aligned;
+    hp->base.expand = vt_hpallocator_expand;
+
+    return hp;
+}
+
+void vt_hpallocator_destroy(vt_hpallocator_t *hp) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(hp != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    // free all blocks
+    while (hp->blocks != NULL) {
+        vt_hpallocator_block_free(hp, hp->blocks);
+    }
+
+    // free allocator itself
+    VT_FREE(hp);
+    hp = NULL;
+}
+
+void *vt_hpallocator_alloc(struct VitaBaseAllocatorType *const alloctr, const size_t bytes, const char *const file, const char *const func, const size_t line) {
+    return vt_hpallocator_alloc_aligned(alloctr, bytes, VT_HPALLOCATOR_ALIGNMENT, file, func, line);
+}
+
+void *vt_hpallocator_alloc_aligned(struct VitaBaseAllocatorType *const alloctr, const size_t bytes, const size_t alignment, const char *const file, const char *const func, const size_t line) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(alloctr != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    VT_DEBUG_ASSERT(bytes > 0, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    VT_DEBUG_ASSERT(alignment > 0 && (alignment & (alignment - 1)) == 0, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    VT_ENFORCE(alignment <= VT_HPALLOCATOR_ALIGNMENT, "%s: alignment %zu is bigger than %d\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS), alignment, VT_HPALLOCATOR_ALIGNMENT);
+
+    // allocate memory
+    void *const ptr = vt_hpallocator_block_data(vt_hpallocator_block_alloc((vt_hpallocator_t*)alloctr, bytes));
+
+    // update stats
+    vt_allocator_stats_on_alloc(&alloctr->stats, bytes);
+
+    // debug info
+    VT_DEBUG_PRINTF("%s:%s:%zu: %zu bytes allocated\n", file, func, line, bytes);
+    (void)file;
+    (void)func;
+    (void)line;
+
+    return ptr;
+}
+
+void *vt_hpallocator_realloc(struct VitaBaseAllocatorType *const alloctr, void *ptr, const size_t bytes, const char *const file, const char *const func, const size_t line) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(alloctr != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    VT_DEBUG_ASSERT(ptr != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    VT_DEBUG_ASSERT(bytes > 0, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    vt_hpallocator_t *const hp = (vt_hpallocator_t*)alloctr;
+    struct VitaHugePageBlock *block = vt_hpallocator_block_header(ptr);
+    const size_t bytes_old = block->bytes;
+
+    if (block->map_len && bytes >= hp->threshold) {
+        // resize the mapping
+        const size_t capacity_old = block->map_len - VT_HPALLOCATOR_ALIGNMENT;
+        const size_t len = vt_hpallocator_map_len(bytes);
+        if (len != block->map_len) {
+            block = vt_hpallocator_remap(block, block->map_len, len);
+            block->map_len = len;
+            vt_hpallocator_block_relink(hp, block);
+        }
+
+        // the old mapping may hold stale data after shrinking, new pages are zeroed by the OS
+        if (bytes > bytes_old) {
+            memset(vt_hpallocator_block_data(block) + bytes_old, 0, (bytes < capacity_old ? bytes : capacity_old) - bytes_old);
+        }
+        block->bytes = bytes;
+    } else if (!block->map_len && bytes < hp->threshold && bytes <= bytes_old) {
+        // shrink heap blocks in place
+        block->bytes = bytes;
+    } else {
+        // move to a new block
+        struct VitaHugePageBlock *const block_new = vt_hpallocator_block_alloc(hp, bytes);
+        memcpy(vt_hpallocator_block_data(block_new), ptr, bytes < bytes_old ? bytes : bytes_old);
+        vt_hpallocator_block_free(hp, block);
+        block = block_new;
+    }
+
+    // update stats
+    vt_allocator_stats_on_realloc(&alloctr->stats, bytes_old, bytes);
+
+    // debug info
+    VT_DEBUG_PRINTF("%s:%s:%zu: %zu bytes reallocated (old size: %zu)\n", file, func, line, bytes, bytes_old);
+    (void)file;
+    (void)func;
+    (void)line;
+
+    return vt_hpallocator_block_data(block);
+}
+
+bool vt_hpallocator_expand(struct VitaBaseAllocatorType *const alloctr, void *ptr, const size_t bytes, const char *const file, const char *const func, const size_t line) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(alloctr != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    VT_DEBUG_ASSERT(ptr != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    VT_DEBUG_ASSERT(bytes > 0, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    // only mapped blocks can grow in place
+    struct VitaHugePageBlock *const block = vt_hpallocator_block_header(ptr);
+    const size_t bytes_old = block->bytes;
+    if (!block->map_len || bytes < bytes_old) {
+        return false;
+    }
+
+    // extend the mapping at the same address if it is too small
+    const size_t capacity_old = block->map_len - VT_HPALLOCATOR_ALIGNMENT;
+    const size_t len = vt_hpallocator_map_len(bytes);
+    if (len > block->map_len) {
+        if (!vt_hpallocator_remap_in_place(block, block->map_len, len)) {
+            return false;
+        }
+        block->map_len = len;
+    }
+
+    // the mapping may hold stale data after shrinking, new pages are zeroed by the OS
+    memset((char*)ptr + bytes_old, 0, (bytes < capacity_old ? bytes : capacity_old) - bytes_old);
+    block->bytes = bytes;
+
+    // update stats
+    vt_allocator_stats_on_realloc(&alloctr->stats, bytes_old, bytes);
+
+    // debug info
+    VT_DEBUG_PRINTF("%s:%s:%zu: %zu bytes expanded in place (old size: %zu)\n", file, func, line, bytes, bytes_old);
+    (void)file;
+    (void)func;
+    (void)line;
+
+    return true;
+}
+
+void vt_hpallocator_free(struct VitaBaseAllocatorType *const alloctr, void *ptr, const char *const file, const char *const func, const size_t line) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(alloctr != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    VT_DEBUG_ASSERT(ptr != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    // free memory
+    struct VitaHugePageBlock *const block = vt_hpallocator_block_header(ptr);
+    const size_t bytes = block->bytes;
+    vt_hpallocator_block_free((vt_hpallocator_t*)alloctr, block);
+
+    // update stats
+    vt_allocator_stats_on_free(&alloctr->stats, bytes);
+
+    // debug info
+    VT_DEBUG_PRINTF("%s:%s:%zu: %zu bytes freed\n", file, func, line, bytes);
+    (void)file;
+    (void)func;
+    (void)line;
+}
+
+/* ---------------------- PRIVATE FUNCTIONS ---------------------- */
+
+/** Allocates a zero-initialized block from the heap or maps it from the OS, and links it
+    @param hp vt_hpallocator_t instance
+    @param bytes number of bytes
+
+    @returns block header
+*/
+static struct VitaHugePageBlock *vt_hpallocator_block_alloc(vt_hpallocator_t *const hp, const size_t bytes) {
+    struct VitaHugePageBlock *block = NULL;
+    if (bytes >= hp->threshold) {
+        const size_t len = vt_hpallocator_map_len(bytes);
+        block = vt_hpallocator_map(len);
+        block->map_len = len;
+    } else {
+        block = VT_CALLOC_ALIGNED(VT_HPALLOCATOR_ALIGNMENT + bytes, VT_HPALLOCATOR_ALIGNMENT);
+        block->map_len = 0;
+    }
+    block->bytes = bytes;
+
+    // link
+    block->prev = NULL;
+    block->next = hp->blocks;
+    vt_hpallocator_block_relink(hp, block);
+
+    return block;
+}
+
+/** Unlinks the block and releases its memory
+    @param hp vt_hpallocator_t instance
+    @param block block header
+*/
+static void vt_hpallocator_block_free(vt_hpallocator_t *const hp, struct VitaHugePageBlock *const block) {
+    // unlink
+    if (block->prev != NULL) {
+        block->prev->next = block->next;
+    } else {
+        hp->blocks = block->next;
+    }
+    if (block->next != NULL) {
+        block->next->prev = block->prev;
+    }
+
+    // release
+    if (block->map_len) {
+        vt_hpallocator_unmap(block, block->map_len);
+    } else {
+        VT_FREE_ALIGNED(block);
+    }
+}
+
+/** Points the block's neighbours to the block (after it was created or moved)
+    @param hp vt_hpallocator_t instance
+    @param block block header
+*/
+static void vt_hpallocator_block_relink(vt_hpallocator_t *const hp, struct VitaHugePageBlock *const block) {
+    if (block->prev != NULL) {
+        block->prev->next = block;
+    } else {
+        hp->blocks = block;
+    }
+    if (block->next != NULL) {
+        block->next->prev = block;
+    }
+}
+
+/** Returns block header of an allocated block
+    @param ptr allocated block
+    @returns block header
+*/
+static struct VitaHugePageBlock *vt_hpallocator_block_header(const void *const ptr) {
+    return (struct VitaHugePageBlock*)((char*)ptr - VT_HPALLOCATOR_ALIGNMENT);
+}
+
+/** Returns block data
+    @param block block header
+    @returns pointer to block data
+*/
+static char *vt_hpallocator_block_data(const struct VitaHugePageBlock *const block) {
+    return (char*)block + VT_HPALLOCATOR_ALIGNMENT;
+}
+
+/** Computes mapping length for a block (a multiple of the huge page size)
+    @param bytes number of bytes
+    @returns mapping length
+*/
+static size_t vt_hpallocator_map_len(const size_t bytes) {
+    const size_t len = VT_HPALLOCATOR_ALIGNMENT + bytes;
+    return (len + VT_HPALLOCATOR_HUGE_PAGE_SIZE - 1) / VT_HPALLOCATOR_HUGE_PAGE_SIZE * VT_HPALLOCATOR_HUGE_PAGE_SIZE;
+}
+
+/** Maps zero-initialized memory aligned to the huge page size and requests huge pages for it
+    @param len mapping length (multiple of the huge page size)
+    @returns pointer to mapping
+
+    @note exits upon failure
+*/
+static void *vt_hpallocator_map(const size_t len) {
+#if defined(_WIN32) || defined(_WIN64)
+    // large pages require special privileges on Windows, regular pages are used
+    void *const addr = VirtualAlloc(NULL, len, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+    if (addr == NULL) {
+        fprintf(stderr, "%s %s:%s:%d: %s\n", "MEMORY MAPPING FAILURE", __SOURCE_FILENAME__, __func__, __LINE__, "Aborting...");
+        exit(EXIT_FAILURE);
+    }
+
+    return addr;
+#else
+    // over-allocate to align the mapping to the huge page size, then trim the excess
+    const size_t len_mapped = len + VT_HPALLOCATOR_HUGE_PAGE_SIZE;
+    char *const addr = mmap(NULL, len_mapped, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (addr == MAP_FAILED) {
+        fprintf(stderr, "%s %s:%s:%d: %s\n", "MEMORY MAPPING FAILURE", __SOURCE_FILENAME__, __func__, __LINE__, "Aborting...");
+        exit(EXIT_FAILURE);
+    }
+
+    const uintptr_t aligned = ((uintptr_t)addr + VT_HPALLOCATOR_HUGE_PAGE_SIZE - 1) & ~(uintptr_t)(VT_HPALLOCATOR_HUGE_PAGE_SIZE - 1);
+    char *const start = (char*)aligned;
+    const size_t head = (size_t)(start - addr);
+    if (head > 0) {
+        munmap(addr, head);
+    }
+    if (len_mapped - head > len) {
+        munmap(start + len, len_mapped - head - len);
+    }
+
+    #ifdef MADV_HUGEPAGE
+        madvise(start, len, MADV_HUGEPAGE);
+    #endif
+
+    return start;
+#endif
+}
+
+/** Resizes mapping, moving it if needed
+    @param addr mapping start
+    @param len_old current mapping length
+    @param len new mapping length (multiple of the huge page size)
+
+    @returns pointer to mapping
+
+    @note exits upon failure
+*/
+static void *vt_hpallocator_remap(void *const addr, const size_t len_old, const size_t len) {
+#if defined(__linux__)
+    // the kernel moves page table entries instead of copying data
+    void *addr_new = mremap(addr, len_old, len, MREMAP_MAYMOVE);
+    if (addr_new == MAP_FAILED) {
+        fprintf(stderr, "%s %s:%s:%d: %s\n", "MEMORY MAPPING FAILURE", __SOURCE_FILENAME__, __func__, __LINE__, "Aborting...");
+        exit(EXIT_FAILURE);
+    }
+
+    // the kernel only guarantees page alignment: move the mapping over an aligned reservation, which it replaces
+    if ((uintptr_t)addr_new % VT_HPALLOCATOR_HUGE_PAGE_SIZE != 0) {
+        void *const aligned = vt_hpallocator_map(len);
+        addr_new = mremap(addr_new, len, len, MREMAP_MAYMOVE | MREMAP_FIXED, aligned);
+        if (addr_new == MAP_FAILED) {
+            fprintf(stderr, "%s %s:%s:%d: %s\n", "MEMORY MAPPING FAILURE", __SOURCE_FILENAME__, __func__, __LINE__, "Aborting...");
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    #ifdef MADV_HUGEPAGE
+        madvise(addr_new, len, MADV_HUGEPAGE);
+    #endif
+
+    return addr_new;
+#else
+    void *const addr_new = vt_hpallocator_map(len);
+    memcpy(addr_new, addr, len < len_old ? len : len_old);
+    vt_hpallocator_unmap(addr, len_old);
+
+    return addr_new;
+#endif
+}
+
+/** Resizes mapping without moving it
+    @param addr mapping start
+    @param len_old current mapping length
+    @param len new mapping length (multiple of the huge page size)
+
+    @returns `true` upon success, `false` if the address range after the mapping is taken or remapping is not supported
+*/
+static bool vt_hpallocator_remap_in_place(void *const addr, const size_t len_old, const size_t len) {
+#if defined(__linux__)
+    if (mremap(addr, len_old, len, 0) == MAP_FAILED) {
+        return false;
+    }
+
+    #ifdef MADV_HUGEPAGE
+        madvise(addr, len, MADV_HUGEPAGE);
+    #endif
+
+    return true;
+#else
+    (void)addr;
+    (void)len_old;
+    (void)len;
+
+    return false;
+#endif
+}
+
+/** Unmaps memory
+    @param addr mapping start
+    @param len mapping length
+*/
+static void vt_hpallocator_unmap(void *const addr, const size_t len) {
+#if defined(_WIN32) || defined(_WIN64)
+    VirtualFree(addr, 0, MEM_RELEASE);
+    (void)len;
+#else
+    munmap(addr, len);
+#endif
+}
@@ -1,10 +1,16 @@
 #include "vita/allocator/mallocator.h"
 
 static void vt_mallocator_obj_list_add(vt_mallocator_t *const alloctr, const struct VitaAllocatedObject obj);
-static size_t vt_mallocator_obj_list_remove(vt_mallocator_t *const alloctr, const void *const ptr);
+static struct VitaAllocatedObject vt_mallocator_obj_list_remove(vt_mallocator_t *const alloctr, const void *const ptr);
 static void vt_mallocator_obj_list_resize(vt_mallocator_t *const alloctr, const size_t length);
 static bool vt_mallocator_obj_list_has_space(const vt_mallocator_t *const alloctr);
 static int64_t vt_mallocator_obj_list_find(const vt_mallocator_t *const alloctr, const void *const ptr);
+static size_t vt_mallocator_obj_list_hash(const void *const ptr, const size_t capacity);
+static size_t vt_mallocator_profile_site(struct VitaAllocationProfile *const profile, const char *const file, const char *const func, const size_t line);
+static void vt_mallocator_profile_index_resize(struct VitaAllocationProfile *const profile, const size_t length);
+static size_t vt_mallocator_profile_hash(const char *const func, const size_t line, const size_t capacity);
+static void vt_mallocator_profile_own(struct VitaAllocationProfile *const profile, const size_t site, const size_t bytes);
+static int vt_mallocator_profile_cmp(const void *a, const void *b);
 
 vt_mallocator_t *vt_mallocator_create(void) {
     // create a mallocator instance
@@ -20,6 +26,7 @@ vt_mallocator_t *vt_mallocator_create(void) {
     alloctr->alloc = vt_mallocator_alloc;
     alloctr->realloc = vt_mallocator_realloc;
     alloctr->free = vt_mallocator_free;
+    alloctr->alloc_aligned = vt_mallocator_alloc_aligned;
 
     return alloctr;
 }
@@ -33,10 +40,15 @@ void vt_mallocator_destroy(vt_mallocator_t *alloctr) {
     alloctr->alloc = NULL;
     alloctr->realloc = NULL;
     alloctr->free = NULL;
-
-    // free all objects in object list
-    VT_FOREACH(iter, 0, alloctr->obj_list_len) {
-        VT_FREE(alloctr->obj_list[iter].ptr);
+    alloctr->alloc_aligned = NULL;
+
+    // free all objects in object list (empty slots hold NULL)
+    VT_FOREACH(iter, 0, alloctr->obj_list_capacity) {
+        if (alloctr->obj_list[iter].alignment) {
+            VT_FREE_ALIGNED(alloctr->obj_list[iter].ptr);
+        } else {
+            VT_FREE(alloctr->obj_list[iter].ptr);
+        }
 
         // reset
         alloctr->obj_list[iter].ptr = NULL;
@@ -49,29 +61,51 @@ void vt_mallocator_destroy(vt_mallocator_t *alloctr) {
     alloctr->obj_list_len = 0;
     alloctr->obj_list_capacity = 0;
 
+    // free the profile
+    if (alloctr->profile != NULL) {
+        VT_FREE(alloctr->profile->sites);
+        VT_FREE(alloctr->profile->index);
+        VT_FREE(alloctr->profile);
+        alloctr->profile = NULL;
+    }
+
     // free allocator itself
     VT_FREE(alloctr);
     alloctr = NULL;
 }
 
 void *vt_mallocator_alloc(vt_mallocator_t *const alloctr, const size_t bytes, const char *const file, const char *const func, const size_t line) {
+    return vt_mallocator_alloc_aligned(alloctr, bytes, 0, file, func, line);
+}
+
+void *vt_mallocator_alloc_aligned(vt_mallocator_t *const alloctr, const size_t bytes, const size_t alignment, const char *const file, const char *const func, const size_t line) {
     // check for invalid input
     VT_DEBUG_ASSERT(alloctr != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
     VT_DEBUG_ASSERT(alloctr->obj_list != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_IS_NULL));
     VT_DEBUG_ASSERT(bytes > 0, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    VT_DEBUG_ASSERT((alignment & (alignment - 1)) == 0, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
 
     // allocate memory
     const struct VitaAllocatedObject obj = { 
-        .ptr = vt_calloc(bytes, file, func, line),
-        .bytes = bytes
+        .ptr = alignment ? vt_calloc_aligned(bytes, alignment, file, func, line) : vt_calloc(bytes, file, func, line),
+        .bytes = bytes,
+        .alignment = alignment,
+        .site = alloctr->profile ? vt_mallocator_profile_site(alloctr->profile, file, func, line) : VT_MALLOCATOR_PROFILE_SITE_NONE
     };
 
     // add the pointer to the mallocator instance object list
     vt_mallocator_obj_list_add(alloctr, obj);
 
     // update stats
-    alloctr->stats.count_allocs++;
-    alloctr->stats.count_bytes_allocated += bytes;
+    vt_allocator_stats_on_alloc(&alloctr->stats, bytes);
+
+    // update call site profile
+    if (obj.site != VT_MALLOCATOR_PROFILE_SITE_NONE) {
+        struct VitaAllocationSite *const site = &alloctr->profile->sites[obj.site];
+        site->count_allocs++;
+        site->bytes_allocated += bytes;
+        vt_mallocator_profile_own(alloctr->profile, obj.site, bytes);
+    }
 
     // debug info
     VT_DEBUG_PRINTF("%s:%s:%d: %zu bytes allocated\n", file, func, line, bytes);
@@ -87,22 +121,42 @@ void *vt_mallocator_realloc(vt_mallocator_t *const alloctr, void *ptr, const siz
     VT_DEBUG_ASSERT(bytes > 0, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
 
     // remove the pointer from the mallocator instance object list
-    const size_t bytes_old = vt_mallocator_obj_list_remove(alloctr, ptr);
+    const struct VitaAllocatedObject obj_old = vt_mallocator_obj_list_remove(alloctr, ptr);
+    const size_t bytes_old = obj_old.bytes;
     
-    // reallocate memory
+    // reallocate memory (aligned blocks are moved to keep their alignment)
+    void *ptr_new = NULL;
+    if (obj_old.alignment) {
+        ptr_new = vt_calloc_aligned(bytes, obj_old.alignment, file, func, line);
+        memcpy(ptr_new, ptr, bytes < bytes_old ? bytes : bytes_old);
+        vt_free_aligned(ptr);
+    } else {
+        ptr_new = vt_realloc(ptr, bytes, file, func, line);
+    }
     const struct VitaAllocatedObject obj = { 
-        .ptr = vt_realloc(ptr, bytes, file, func, line), 
-        .bytes = bytes
+        .ptr = ptr_new, 
+        .bytes = bytes,
+        .alignment = obj_old.alignment,
+        .site = alloctr->profile ? vt_mallocator_profile_site(alloctr->profile, file, func, line) : VT_MALLOCATOR_PROFILE_SITE_NONE
     };
 
     // add the pointer to the mallocator instance object list
     vt_mallocator_obj_list_add(alloctr, obj);
 
+    // update call site profile: the reallocating site takes ownership of the block
+    if (obj.site != VT_MALLOCATOR_PROFILE_SITE_NONE) {
+        struct VitaAllocationSite *const site = &alloctr->profile->sites[obj.site];
+        site->count_reallocs++;
+        site->bytes_allocated += bytes > bytes_old ? bytes - bytes_old : 0;
+        site->bytes_realloc_churn += obj.ptr != ptr ? (bytes < bytes_old ? bytes : bytes_old) : 0;
+        if (obj_old.site != VT_MALLOCATOR_PROFILE_SITE_NONE) {
+            alloctr->profile->sites[obj_old.site].bytes_live -= bytes_old;
+        }
+        vt_mallocator_profile_own(alloctr->profile, obj.site, bytes);
+    }
+
     // update stats
-    const int64_t bytes_diff = ((int64_t)bytes - bytes_old);
-    alloctr->stats.count_reallocs++;
-    alloctr->stats.count_bytes_allocated += bytes_diff;
-    alloctr->stats.count_bytes_freed -= bytes_diff < 0 ? bytes_diff : 0;
+    vt_allocator_stats_on_realloc(&alloctr->stats, bytes_old, bytes);
 
     // debug info
     VT_DEBUG_PRINTF("%s:%s:%d: %zu bytes reallocated (old size: %d)\n", file, func, line, bytes, bytes_old);
@@ -117,12 +171,18 @@ void vt_mallocator_free(vt_mallocator_t *const alloctr, void *ptr, const char *c
     VT_DEBUG_ASSERT(ptr != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
 
     // remove the pointer from the mallocator instance object list
-    const size_t bytes = vt_mallocator_obj_list_remove(alloctr, ptr);
+    const struct VitaAllocatedObject obj = vt_mallocator_obj_list_remove(alloctr, ptr);
+    const size_t bytes = obj.bytes;
     if (bytes > 0) {
         // update stats
-        alloctr->stats.count_frees++;
-        alloctr->stats.count_bytes_freed += bytes;
-        alloctr->stats.count_bytes_allocated -= bytes;
+        vt_allocator_stats_on_free(&alloctr->stats, bytes);
+
+        // update call site profile: frees are attributed to the owning site
+        if (obj.site != VT_MALLOCATOR_PROFILE_SITE_NONE && alloctr->profile != NULL) {
+            struct VitaAllocationSite *const site = &alloctr->profile->sites[obj.site];
+            site->count_frees++;
+            site->bytes_live -= bytes;
+        }
 
         // debug info
         VT_DEBUG_PRINTF("%s:%s:%d: %zu bytes freed (left: %zu)\n", file, func, line, bytes, alloctr->stats.count_bytes_allocated);
@@ -132,7 +192,11 @@ void vt_mallocator_free(vt_mallocator_t *const alloctr, void *ptr, const char *c
     }
 
     // free the data
-    vt_free(ptr);
+    if (obj.alignment) {
+        vt_free_aligned(ptr);
+    } else {
+        vt_free(ptr);
+    }
     ptr = NULL;
 }
 
@@ -146,15 +210,21 @@ void vt_mallocator_print_stats(const struct VitaAllocatorStats stats) {
         "| N   ALLOCS | %*zu |\n"        // %*zu, * = 10 = width
         "| N REALLOCS | %*zu |\n"
         "| N    FREES | %*zu |\n"
+        "| N    GROWS | %*zu |\n"
+        "| N  SHRINKS | %*zu |\n"
+        "| N C.OBJCTS | %*zu |\n"
+        "| N P.OBJCTS | %*zu |\n"
         "|-------------------------|\n"
         "| B T.ALLOCD | %*zu |\n"
         "| B C.ALLOCD | %*zu |\n"
+        "| B P.ALLOCD | %*zu |\n"
         "| B    FREED | %*zu |\n"
         "|-------------------------|\n"
         "| (N) - COUNT             |\n"
         "| (B) - BYTES             |\n"
         "| (T) - TOTAL             |\n"
         "| (C) - CURRENT           |\n"
+        "| (P) - PEAK              |\n"
         "|-------------------------|\n";
     
     printf(
@@ -162,12 +232,86 @@ void vt_mallocator_print_stats(const struct VitaAllocatorStats stats) {
         width, stats.count_allocs,
         width, stats.count_reallocs,
         width, stats.count_frees,
+        width, stats.count_reallocs_grow,
+        width, stats.count_reallocs_shrink,
+        width, stats.count_objects_live,
+        width, stats.count_objects_peak,
         width, stats.count_bytes_allocated + stats.count_bytes_freed,
         width, stats.count_bytes_allocated,
+        width, stats.count_bytes_peak,
         width, stats.count_bytes_freed
     );
 }
 
+void vt_mallocator_profile_enable(vt_mallocator_t *const alloctr) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(alloctr != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    // already enabled
+    if (alloctr->profile != NULL) {
+        return;
+    }
+
+    // create an empty profile
+    alloctr->profile = VT_CALLOC(sizeof(struct VitaAllocationProfile));
+    alloctr->profile->sites = VT_CALLOC(VT_ARRAY_DEFAULT_INIT_ELEMENTS * sizeof(struct VitaAllocationSite));
+    alloctr->profile->sites_capacity = VT_ARRAY_DEFAULT_INIT_ELEMENTS;
+    vt_mallocator_profile_index_resize(alloctr->profile, 2 * VT_ARRAY_DEFAULT_INIT_ELEMENTS);
+}
+
+void vt_mallocator_profile_dump(const vt_mallocator_t *const alloctr, FILE *stream, const enum VitaMallocatorProfileFormat format) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(alloctr != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    VT_DEBUG_ASSERT(stream != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    VT_DEBUG_ASSERT(format < VT_MALLOCATOR_PROFILE_FORMAT_COUNT, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    const struct VitaAllocationProfile *const profile = alloctr->profile;
+    if (profile == NULL) {
+        return;
+    }
+
+    // sort sites by total bytes allocated
+    const struct VitaAllocationSite **sorted = VT_CALLOC((profile->sites_len + 1) * sizeof(struct VitaAllocationSite*));
+    VT_FOREACH(i, 0, profile->sites_len) {
+        sorted[i] = &profile->sites[i];
+    }
+    qsort(sorted, profile->sites_len, sizeof(struct VitaAllocationSite*), vt_mallocator_profile_cmp);
+
+    // write header
+    if (format == VT_MALLOCATOR_PROFILE_FORMAT_CSV) {
+        fprintf(stream, "file,func,line,allocs,reallocs,frees,bytes_allocated,bytes_live,bytes_live_peak,bytes_realloc_churn\n");
+    } else {
+        fprintf(
+            stream, "%-40s %10s %10s %10s %14s %12s %12s %12s\n",
+            "SITE", "ALLOCS", "REALLOCS", "FREES", "B ALLOCATED", "B LIVE", "B PEAK", "B CHURN"
+        );
+    }
+
+    // write sites
+    char location[256] = {0};
+    VT_FOREACH(i, 0, profile->sites_len) {
+        const struct VitaAllocationSite *const site = sorted[i];
+        if (format == VT_MALLOCATOR_PROFILE_FORMAT_CSV) {
+            fprintf(
+                stream, "%s,%s,%zu,%zu,%zu,%zu,%zu,%zu,%zu,%zu\n", 
+                site->file, site->func, site->line, 
+                site->count_allocs, site->count_reallocs, site->count_frees, 
+                site->bytes_allocated, site->bytes_live, site->bytes_live_peak, site->bytes_realloc_churn
+            );
+        } else {
+            snprintf(location, sizeof(location), "%s:%s:%zu", site->file, site->func, site->line);
+            fprintf(
+                stream, "%-40s %10zu %10zu %10zu %14zu %12zu %12zu %12zu\n", 
+                location, 
+                site->count_allocs, site->count_reallocs, site->count_frees, 
+                site->bytes_allocated, site->bytes_live, site->bytes_live_peak, site->bytes_realloc_churn
+            );
+        }
+    }
+
+    VT_FREE(sorted);
+}
+
 /* ---------------------- PRIVATE FUNCTIONS ---------------------- */
 
 /** Adds pointer to object list
@@ -185,60 +329,91 @@ static void vt_mallocator_obj_list_add(vt_mallocator_t *const alloctr, const str
         vt_mallocator_obj_list_resize(alloctr, 2 * alloctr->obj_list_capacity);
     }
 
+    // find the first empty slot starting from the pointer's home slot (linear probing)
+    const size_t mask = alloctr->obj_list_capacity - 1;
+    size_t idx = vt_mallocator_obj_list_hash(obj.ptr, alloctr->obj_list_capacity);
+    while (alloctr->obj_list[idx].ptr != NULL) {
+        idx = (idx + 1) & mask;
+    }
+
     // add object
-    alloctr->obj_list[alloctr->obj_list_len++] = obj;
+    alloctr->obj_list[idx] = obj;
+    alloctr->obj_list_len++;
 }
 
 /** Removes pointer from object list
     @param alloctr allocator instance
     @param ptr pointer to remove
 
-    @returns bytes allocated for that pointer or `0` if pointer wasn't found in the object list
+    @returns removed object or a zeroed object if pointer wasn't found in the object list
 */
-static size_t vt_mallocator_obj_list_remove(vt_mallocator_t *const alloctr, const void *const ptr) {
+static struct VitaAllocatedObject vt_mallocator_obj_list_remove(vt_mallocator_t *const alloctr, const void *const ptr) {
     // check for invalid input
     VT_DEBUG_ASSERT(alloctr != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
     VT_DEBUG_ASSERT(alloctr->obj_list != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_IS_NULL));
     VT_DEBUG_ASSERT(ptr != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
 
-    // remove only if the object list isn't empty
-    size_t bytes_old = 0;
-    const size_t obj_list_len = alloctr->obj_list_len;
-    if (obj_list_len > 0) {
-        const int64_t idx = vt_mallocator_obj_list_find(alloctr, ptr);
-        if (idx < 0) {
-            return bytes_old;
-        }
-
-        // retrieve bytes from the object we want to remove
-        bytes_old = alloctr->obj_list[idx].bytes;
+    // find the object
+    const int64_t found = vt_mallocator_obj_list_find(alloctr, ptr);
+    if (found < 0) {
+        return (struct VitaAllocatedObject) {0};
+    }
 
-        // remove only if it's not the last in the list
-        if (idx != (int64_t)(obj_list_len-1)) { 
-            alloctr->obj_list[idx] = alloctr->obj_list[obj_list_len-1];
+    // retrieve the object we want to remove
+    size_t idx = (size_t)found;
+    const struct VitaAllocatedObject obj = alloctr->obj_list[idx];
+
+    // backward shift deletion: pull up the following objects of the probe chain,
+    // so that lookups never stop early at the freed slot (no tombstones needed)
+    const size_t mask = alloctr->obj_list_capacity - 1;
+    size_t next = (idx + 1) & mask;
+    while (alloctr->obj_list[next].ptr != NULL) {
+        // move the object only if its home slot is not within (idx; next]
+        const size_t home = vt_mallocator_obj_list_hash(alloctr->obj_list[next].ptr, alloctr->obj_list_capacity);
+        if (((next - home) & mask) >= ((next - idx) & mask)) {
+            alloctr->obj_list[idx] = alloctr->obj_list[next];
+            idx = next;
         }
-        alloctr->obj_list_len--;
+        next = (next + 1) & mask;
     }
 
-    return bytes_old;
+    // reset the slot
+    alloctr->obj_list[idx] = (struct VitaAllocatedObject) {0};
+    alloctr->obj_list_len--;
+
+    return obj;
 }
 
-/** Resize object list
+/** Resize object list and re-insert all objects
     @param alloctr allocator instance
-    @param size new size
+    @param length new size (power of 2)
 */
 static void vt_mallocator_obj_list_resize(vt_mallocator_t *const alloctr, const size_t length) {
     // check for invalid input
     VT_DEBUG_ASSERT(alloctr != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
     VT_DEBUG_ASSERT(alloctr->obj_list != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_IS_NULL));
-    VT_DEBUG_ASSERT(length > 0, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    VT_DEBUG_ASSERT(length > alloctr->obj_list_len, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    VT_DEBUG_ASSERT((length & (length - 1)) == 0, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
 
-    // resize object list
-    alloctr->obj_list = VT_REALLOC(alloctr->obj_list, length * sizeof(struct VitaAllocatedObject));
+    // swap in a new empty object list
+    struct VitaAllocatedObject *const obj_list_old = alloctr->obj_list;
+    const size_t obj_list_capacity_old = alloctr->obj_list_capacity;
+    alloctr->obj_list = VT_CALLOC(length * sizeof(struct VitaAllocatedObject));
     alloctr->obj_list_capacity = length;
+    alloctr->obj_list_len = 0;
+
+    // re-insert objects
+    VT_FOREACH(i, 0, obj_list_capacity_old) {
+        if (obj_list_old[i].ptr != NULL) {
+            vt_mallocator_obj_list_add(alloctr, obj_list_old[i]);
+        }
+    }
+
+    // free the old list
+    VT_FREE(obj_list_old);
 }
 
-/** Check if object list has enough space
+/** Check if object list has enough space (load factor is kept under 3/4)
     @param alloctr allocator instance
     @returns ditto
 */
@@ -247,7 +422,7 @@ static bool vt_mallocator_obj_list_has_space(const vt_mallocator_t *const alloct
     VT_DEBUG_ASSERT(alloctr != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
     VT_DEBUG_ASSERT(alloctr->obj_list != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_IS_NULL));
 
-    return (alloctr->obj_list_capacity - alloctr->obj_list_len);
+    return (alloctr->obj_list_len + 1) * 4 <= alloctr->obj_list_capacity * 3;
 }
 
 /** Find index of a pointer in object list
@@ -262,15 +437,141 @@ static int64_t vt_mallocator_obj_list_find(const vt_mallocator_t *const alloctr,
     VT_DEBUG_ASSERT(alloctr->obj_list != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_IS_NULL));
     VT_DEBUG_ASSERT(ptr != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
 
-    // find element
-    const size_t len = alloctr->obj_list_len;
-    for (size_t i = 0; i < len; i++) {
-        if (alloctr->obj_list[i].ptr == ptr) {
-            return i;
+    // probe until an empty slot is encountered
+    const size_t mask = alloctr->obj_list_capacity - 1;
+    size_t idx = vt_mallocator_obj_list_hash(ptr, alloctr->obj_list_capacity);
+    while (alloctr->obj_list[idx].ptr != NULL) {
+        if (alloctr->obj_list[idx].ptr == ptr) {
+            return (int64_t)idx;
         }
+        idx = (idx + 1) & mask;
     }
 
     return -1;
 }
 
+/** Computes the home slot of a pointer in object list
+    @param ptr pointer
+    @param capacity object list capacity (power of 2)
+
+    @returns slot index
+*/
+static size_t vt_mallocator_obj_list_hash(const void *const ptr, const size_t capacity) {
+    // mix all pointer bits, since the low bits are always zero due to alignment
+    uint64_t h = (uint64_t)(uintptr_t)ptr;
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+
+    return (size_t)(h & (capacity - 1));
+}
+
+/** Finds call site index in profile, adds a new site if it is not there yet
+    @param profile allocation profile
+    @param file __SOURCE_FILENAME__
+    @param func __func__
+    @param line __LINE__
+
+    @returns site index
+
+    @note sites are identified by the `func` pointer and `line`
+*/
+static size_t vt_mallocator_profile_site(struct VitaAllocationProfile *const profile, const char *const file, const char *const func, const size_t line) {
+    // look up the site (linear probing)
+    const size_t mask = profile->index_capacity - 1;
+    size_t idx = vt_mallocator_profile_hash(func, line, profile->index_capacity);
+    while (profile->index[idx] != VT_MALLOCATOR_PROFILE_SITE_NONE) {
+        const struct VitaAllocationSite *const site = &profile->sites[profile->index[idx]];
+        if (site->func == func && site->line == line) {
+            return profile->index[idx];
+        }
+        idx = (idx + 1) & mask;
+    }
+
+    // grow the site list
+    if (profile->sites_len >= profile->sites_capacity) {
+        profile->sites_capacity *= VT_ARRAY_DEFAULT_GROWTH_RATE;
+        profile->sites = VT_REALLOC(profile->sites, profile->sites_capacity * sizeof(struct VitaAllocationSite));
+    }
+
+    // add the site
+    const size_t site_idx = profile->sites_len++;
+    profile->sites[site_idx] = (struct VitaAllocationSite) {
+        .file = file,
+        .func = func,
+        .line = line,
+    };
+    profile->index[idx] = site_idx;
+
+    // keep the index load factor under 1/2
+    if (profile->sites_len * 2 > profile->index_capacity) {
+        vt_mallocator_profile_index_resize(profile, 2 * profile->index_capacity);
+    }
+
+    return site_idx;
+}
 
+/** Rebuilds profile site index
+    @param profile allocation profile
+    @param length new size (power of 2)
+*/
+static void vt_mallocator_profile_index_resize(struct VitaAllocationProfile *const profile, const size_t length) {
+    VT_FREE(profile->index);
+    profile->index = VT_MALLOC(length * sizeof(size_t));
+    profile->index_capacity = length;
+    VT_FOREACH(i, 0, length) {
+        profile->index[i] = VT_MALLOCATOR_PROFILE_SITE_NONE;
+    }
+
+    // re-insert sites
+    const size_t mask = length - 1;
+    VT_FOREACH(i, 0, profile->sites_len) {
+        size_t idx = vt_mallocator_profile_hash(profile->sites[i].func, profile->sites[i].line, length);
+        while (profile->index[idx] != VT_MALLOCATOR_PROFILE_SITE_NONE) {
+            idx = (idx + 1) & mask;
+        }
+        profile->index[idx] = i;
+    }
+}
+
+/** Computes the home slot of a call site in profile index
+    @param func __func__
+    @param line __LINE__
+    @param capacity index capacity (power of 2)
+
+    @returns slot index
+*/
+static size_t vt_mallocator_profile_hash(const char *const func, const size_t line, const size_t capacity) {
+    uint64_t h = (uint64_t)(uintptr_t)func + (uint64_t)line * 0x9e3779b97f4a7c15ULL;
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+
+    return (size_t)(h & (capacity - 1));
+}
+
+/** Assigns bytes to a site and updates its peak
+    @param profile allocation profile
+    @param site site index
+    @param bytes number of bytes
+*/
+static void vt_mallocator_profile_own(struct VitaAllocationProfile *const profile, const size_t site, const size_t bytes) {
+    struct VitaAllocationSite *const s = &profile->sites[site];
+    s->bytes_live += bytes;
+    if (s->bytes_live > s->bytes_live_peak) {
+        s->bytes_live_peak = s->bytes_live;
+    }
+}
+
+/** Compares sites by total bytes allocated in descending order (qsort comparator)
+    @param a pointer to `struct VitaAllocationSite*`
+    @param b pointer to `struct VitaAllocationSite*`
+
+    @returns `<0` if a goes first, `>0` if b goes first, `0` otherwise
+*/
+static int vt_mallocator_profile_cmp(const void *a, const void *b) {
+    const struct VitaAllocationSite *const sa = *(const struct VitaAllocationSite *const*)a;
+    const struct VitaAllocationSite *const sb = *(const struct VitaAllocationSite *const*)b;
+
+    return (sa->bytes_allocated < sb->bytes_allocated) - (sa->bytes_allocated > sb->bytes_allocated);
+}
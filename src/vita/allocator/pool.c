@@ -0,0 +1,253 @@
+#include "vita/allocator/pool.h"
+
+// slab data starts after the slab header to keep blocks 16-byte aligned
+#define VT_POOL_SLAB_HEADER_SIZE (2 * sizeof(void*))
+
+static void *vt_pool_block_alloc(vt_pool_t *const pool, const size_t bytes);
+static void vt_pool_block_free(vt_pool_t *const pool, void *const ptr);
+static struct VitaPoolBlockHeader *vt_pool_block_header(const void *const ptr);
+static void *vt_pool_carve(vt_pool_t *const pool, const size_t class_idx);
+
+vt_pool_t *vt_pool_create(void) {
+    // create a pool instance
+    vt_pool_t *pool = VT_CALLOC(sizeof(vt_pool_t));
+
+    // set up functions
+    pool->base.alloc = vt_pool_alloc;
+    pool->base.realloc = vt_pool_realloc;
+    pool->base.free = vt_pool_free;
+
+    return pool;
+}
+
+void vt_pool_destroy(vt_pool_t *pool) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(pool != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    // free all slabs
+    void *slab = pool->slabs;
+    while (slab != NULL) {
+        void *const next = *(void**)slab;
+        VT_FREE(slab);
+        slab = next;
+    }
+
+    // free large blocks
+    struct VitaPoolLargeBlock *block = pool->large;
+    while (block != NULL) {
+        struct VitaPoolLargeBlock *const next = block->next;
+        VT_FREE(block);
+        block = next;
+    }
+
+    // free pool itself
+    VT_FREE(pool);
+    pool = NULL;
+}
+
+void *vt_pool_alloc(struct VitaBaseAllocatorType *const alloctr, const size_t bytes, const char *const file, const char *const func, const size_t line) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(alloctr != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    VT_DEBUG_ASSERT(bytes > 0, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    // allocate memory
+    void *const ptr = vt_pool_block_alloc((vt_pool_t*)alloctr, bytes);
+
+    // update stats
+    vt_allocator_stats_on_alloc(&alloctr->stats, bytes);
+
+    // debug info
+    VT_DEBUG_PRINTF("%s:%s:%zu: %zu bytes allocated\n", file, func, line, bytes);
+    (void)file;
+    (void)func;
+    (void)line;
+
+    return ptr;
+}
+
+void *vt_pool_realloc(struct VitaBaseAllocatorType *const alloctr, void *ptr, const size_t bytes, const char *const file, const char *const func, const size_t line) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(alloctr != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    VT_DEBUG_ASSERT(ptr != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    VT_DEBUG_ASSERT(bytes > 0, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    struct VitaPoolBlockHeader *const header = vt_pool_block_header(ptr);
+    const size_t bytes_old = header->bytes;
+
+    void *ptr_new = ptr;
+    if (header->class_idx < VT_ALLOCATOR_SIZE_CLASS_COUNT && bytes <= vt_pool_class_size(header->class_idx)) {
+        // the block is big enough, resize in place
+        if (bytes > bytes_old) {
+            memset((char*)ptr + bytes_old, 0, bytes - bytes_old);
+        }
+        header->bytes = bytes;
+    } else {
+        // move to a block of another size class
+        ptr_new = vt_pool_block_alloc((vt_pool_t*)alloctr, bytes);
+        memcpy(ptr_new, ptr, bytes_old < bytes ? bytes_old : bytes);
+        vt_pool_block_free((vt_pool_t*)alloctr, ptr);
+    }
+
+    // update stats
+    vt_allocator_stats_on_realloc(&alloctr->stats, bytes_old, bytes);
+
+    // debug info
+    VT_DEBUG_PRINTF("%s:%s:%zu: %zu bytes reallocated (old size: %zu)\n", file, func, line, bytes, bytes_old);
+    (void)file;
+    (void)func;
+    (void)line;
+
+    return ptr_new;
+}
+
+void vt_pool_free(struct VitaBaseAllocatorType *const alloctr, void *ptr, const char *const file, const char *const func, const size_t line) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(alloctr != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    VT_DEBUG_ASSERT(ptr != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    // free memory
+    const size_t bytes = vt_pool_block_header(ptr)->bytes;
+    vt_pool_block_free((vt_pool_t*)alloctr, ptr);
+
+    // update stats
+    vt_allocator_stats_on_free(&alloctr->stats, bytes);
+
+    // debug info
+    VT_DEBUG_PRINTF("%s:%s:%zu: %zu bytes freed\n", file, func, line, bytes);
+    (void)file;
+    (void)func;
+    (void)line;
+}
+
+void vt_pool_print_stats(const struct VitaAllocatorStats stats) {
+    printf(
+        "|------------------------------------|\n"
+        "|          POOL CLASS STATS          |\n"
+        "|------------------------------------|\n"
+        "| B  CLASS |       HITS |     MISSES |\n"
+        "|------------------------------------|\n"
+    );
+    for (size_t i = 0; i < VT_ALLOCATOR_SIZE_CLASS_COUNT; i++) {
+        printf("| %8zu | %10zu | %10zu |\n", vt_pool_class_size(i), stats.count_class_hits[i], stats.count_class_misses[i]);
+    }
+    printf("|------------------------------------|\n");
+}
+
+size_t vt_pool_class_index(const size_t bytes) {
+    size_t class_idx = 0;
+    size_t class_size = VT_ALLOCATOR_SIZE_CLASS_MIN;
+    while (class_size < bytes && class_idx < VT_ALLOCATOR_SIZE_CLASS_COUNT) {
+        class_size <<= 1;
+        class_idx++;
+    }
+
+    return class_idx;
+}
+
+size_t vt_pool_class_size(const size_t class_idx) {
+    return (size_t)VT_ALLOCATOR_SIZE_CLASS_MIN << class_idx;
+}
+
+/* ---------------------- PRIVATE FUNCTIONS ---------------------- */
+
+/** Takes a zero-initialized block from its size class or allocates a large block
+    @param pool vt_pool_t instance
+    @param bytes number of bytes
+
+    @returns pointer to block data
+*/
+static void *vt_pool_block_alloc(vt_pool_t *const pool, const size_t bytes) {
+    const size_t class_idx = vt_pool_class_index(bytes);
+
+    void *ptr = NULL;
+    if (class_idx < VT_ALLOCATOR_SIZE_CLASS_COUNT) {
+        // take a block from the free list or carve a new one
+        struct VitaPoolSizeClass *const sc = &pool->classes[class_idx];
+        if (sc->free_list != NULL) {
+            ptr = sc->free_list;
+            sc->free_list = *(void**)ptr;
+            pool->base.stats.count_class_hits[class_idx]++;
+        } else {
+            ptr = vt_pool_carve(pool, class_idx);
+            pool->base.stats.count_class_misses[class_idx]++;
+        }
+        memset(ptr, 0, bytes);
+    } else {
+        // allocate a large block and link it
+        struct VitaPoolLargeBlock *const block = VT_CALLOC(sizeof(struct VitaPoolLargeBlock) + sizeof(struct VitaPoolBlockHeader) + bytes);
+        block->next = pool->large;
+        if (pool->large != NULL) {
+            pool->large->prev = block;
+        }
+        pool->large = block;
+        ptr = (char*)(block + 1) + sizeof(struct VitaPoolBlockHeader);
+    }
+
+    // save block info
+    struct VitaPoolBlockHeader *const header = vt_pool_block_header(ptr);
+    header->bytes = bytes;
+    header->class_idx = class_idx;
+
+    return ptr;
+}
+
+/** Returns a block to its size class free list or releases a large block
+    @param pool vt_pool_t instance
+    @param ptr pointer to block data
+*/
+static void vt_pool_block_free(vt_pool_t *const pool, void *const ptr) {
+    const size_t class_idx = vt_pool_block_header(ptr)->class_idx;
+    if (class_idx < VT_ALLOCATOR_SIZE_CLASS_COUNT) {
+        // push the block to its free list
+        struct VitaPoolSizeClass *const sc = &pool->classes[class_idx];
+        *(void**)ptr = sc->free_list;
+        sc->free_list = ptr;
+    } else {
+        // unlink the large block and release it
+        struct VitaPoolLargeBlock *const block = (struct VitaPoolLargeBlock*)((char*)ptr - sizeof(struct VitaPoolBlockHeader)) - 1;
+        if (block->prev != NULL) {
+            block->prev->next = block->next;
+        } else {
+            pool->large = block->next;
+        }
+        if (block->next != NULL) {
+            block->next->prev = block->prev;
+        }
+        VT_FREE(block);
+    }
+}
+
+/** Returns header of an allocated block
+    @param ptr allocated block
+    @returns pointer to block header
+*/
+static struct VitaPoolBlockHeader *vt_pool_block_header(const void *const ptr) {
+    return (struct VitaPoolBlockHeader*)ptr - 1;
+}
+
+/** Carves a new block of a size class from its slab, allocates a new slab if the current one is exhausted
+    @param pool vt_pool_t instance
+    @param class_idx size class index
+
+    @returns pointer to block data
+*/
+static void *vt_pool_carve(vt_pool_t *const pool, const size_t class_idx) {
+    struct VitaPoolSizeClass *const sc = &pool->classes[class_idx];
+    const size_t stride = sizeof(struct VitaPoolBlockHeader) + vt_pool_class_size(class_idx);
+
+    // allocate a new slab
+    if (sc->cursor == NULL || sc->cursor + stride > sc->cursor_end) {
+        char *const slab = VT_MALLOC(VT_POOL_SLAB_SIZE);
+        *(void**)slab = pool->slabs;
+        pool->slabs = slab;
+
+        sc->cursor = slab + VT_POOL_SLAB_HEADER_SIZE;
+        sc->cursor_end = slab + VT_POOL_SLAB_SIZE;
+    }
+
+    // carve a block
+    void *const ptr = sc->cursor + sizeof(struct VitaPoolBlockHeader);
+    sc->cursor += stride;
+
+    return ptr;
+}
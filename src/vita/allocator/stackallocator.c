@@ -0,0 +1,330 @@
+#include "vita/allocator/stackallocator.h"
+
+static struct VitaStackBlockHeader *vt_stackallocator_block_alloc(vt_stackallocator_t *const sa, const size_t bytes, const size_t alignment);
+static void vt_stackallocator_block_free(vt_stackallocator_t *const sa, struct VitaStackBlockHeader *const header);
+static struct VitaStackBlockHeader *vt_stackallocator_carve(vt_stackallocator_t *const sa, const size_t bytes, const size_t alignment);
+static struct VitaStackBlockHeader *vt_stackallocator_spill(vt_stackallocator_t *const sa, const size_t bytes, const size_t alignment);
+static void vt_stackallocator_spill_free(vt_stackallocator_t *const sa, struct VitaStackBlockHeader *const header);
+static void vt_stackallocator_rewind(vt_stackallocator_t *const sa);
+static bool vt_stackallocator_owns(const vt_stackallocator_t *const sa, const void *const ptr);
+static bool vt_stackallocator_is_live(const vt_stackallocator_t *const sa, const struct VitaStackBlockHeader *const header);
+static size_t vt_stackallocator_spill_offset(const size_t alignment);
+static struct VitaStackBlockHeader *vt_stackallocator_block_header(const void *const ptr);
+static char *vt_stackallocator_block_data(const struct VitaStackBlockHeader *const header);
+
+vt_stackallocator_t vt_stackallocator_create(void *const buf, const size_t size) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(buf != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    VT_DEBUG_ASSERT(size > 0, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    // create an allocator instance
+    vt_stackallocator_t sa = {
+        .buf = buf,
+        .capacity = size,
+    };
+
+    // set up functions
+    sa.base.alloc = vt_stackallocator_alloc;
+    sa.base.realloc = vt_stackallocator_realloc;
+    sa.base.free = vt_stackallocator_free;
+    sa.base.alloc_aligned = vt_stackallocator_alloc_aligned;
+
+    return sa;
+}
+
+void vt_stackallocator_destroy(vt_stackallocator_t *const sa) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(sa != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    // free spilled blocks
+    while (sa->spills != NULL) {
+        vt_stackallocator_spill_free(sa, sa->spills);
+    }
+
+    // the buffer belongs to the caller
+    *sa = (vt_stackallocator_t) {0};
+}
+
+void vt_stackallocator_reset(vt_stackallocator_t *const sa) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(sa != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    // free spilled blocks
+    while (sa->spills != NULL) {
+        vt_stackallocator_spill_free(sa, sa->spills);
+    }
+
+    // reset, blocks carved before are recognized by their generation
+    sa->offset = 0;
+    sa->top = NULL;
+    sa->generation++;
+
+    // update stats
+    sa->base.stats.count_bytes_freed += sa->base.stats.count_bytes_allocated;
+    sa->base.stats.count_bytes_allocated = 0;
+    sa->base.stats.count_objects_live = 0;
+}
+
+void *vt_stackallocator_alloc(struct VitaBaseAllocatorType *const alloctr, const size_t bytes, const char *const file, const char *const func, const size_t line) {
+    return vt_stackallocator_alloc_aligned(alloctr, bytes, VT_STACKALLOCATOR_ALIGNMENT, file, func, line);
+}
+
+void *vt_stackallocator_alloc_aligned(struct VitaBaseAllocatorType *const alloctr, const size_t bytes, const size_t alignment, const char *const file, const char *const func, const size_t line) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(alloctr != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    VT_DEBUG_ASSERT(bytes > 0, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    VT_DEBUG_ASSERT(alignment > 0 && (alignment & (alignment - 1)) == 0, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    // allocate memory
+    struct VitaStackBlockHeader *const header = vt_stackallocator_block_alloc(
+        (vt_stackallocator_t*)alloctr, bytes, alignment < VT_STACKALLOCATOR_ALIGNMENT ? VT_STACKALLOCATOR_ALIGNMENT : alignment
+    );
+
+    // update stats
+    vt_allocator_stats_on_alloc(&alloctr->stats, bytes);
+
+    // debug info
+    VT_DEBUG_PRINTF("%s:%s:%zu: %zu bytes allocated\n", file, func, line, bytes);
+    (void)file;
+    (void)func;
+    (void)line;
+
+    return vt_stackallocator_block_data(header);
+}
+
+void *vt_stackallocator_realloc(struct VitaBaseAllocatorType *const alloctr, void *ptr, const size_t bytes, const char *const file, const char *const func, const size_t line) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(alloctr != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    VT_DEBUG_ASSERT(ptr != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    VT_DEBUG_ASSERT(bytes > 0, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    vt_stackallocator_t *const sa = (vt_stackallocator_t*)alloctr;
+    struct VitaStackBlockHeader *header = vt_stackallocator_block_header(ptr);
+    const size_t bytes_old = header->bytes;
+
+    // resize in place: the last buffer block can grow up to the end of the buffer, any buffer block can shrink
+    const bool is_owned = vt_stackallocator_owns(sa, ptr);
+    if (is_owned && header == sa->top && (size_t)((char*)ptr - sa->buf) + bytes <= sa->capacity) {
+        if (bytes > bytes_old) {
+            memset((char*)ptr + bytes_old, 0, bytes - bytes_old);
+        }
+        header->bytes = bytes;
+        sa->offset = (size_t)((char*)ptr - sa->buf) + bytes;
+    } else if (is_owned && bytes <= bytes_old) {
+        header->bytes = bytes;
+    } else {
+        // move to a new block
+        struct VitaStackBlockHeader *const header_new = vt_stackallocator_block_alloc(sa, bytes, header->alignment);
+        memcpy(vt_stackallocator_block_data(header_new), ptr, bytes < bytes_old ? bytes : bytes_old);
+        vt_stackallocator_block_free(sa, header);
+        header = header_new;
+    }
+
+    // update stats
+    vt_allocator_stats_on_realloc(&alloctr->stats, bytes_old, bytes);
+
+    // debug info
+    VT_DEBUG_PRINTF("%s:%s:%zu: %zu bytes reallocated (old size: %zu)\n", file, func, line, bytes, bytes_old);
+    (void)file;
+    (void)func;
+    (void)line;
+
+    return vt_stackallocator_block_data(header);
+}
+
+void vt_stackallocator_free(struct VitaBaseAllocatorType *const alloctr, void *ptr, const char *const file, const char *const func, const size_t line) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(alloctr != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    VT_DEBUG_ASSERT(ptr != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    // blocks allocated before the last reset were already released along with their stats
+    vt_stackallocator_t *const sa = (vt_stackallocator_t*)alloctr;
+    struct VitaStackBlockHeader *const header = vt_stackallocator_block_header(ptr);
+    if (!vt_stackallocator_is_live(sa, header)) {
+        alloctr->stats.count_frees++;
+        return;
+    }
+
+    // free memory
+    const size_t bytes = header->bytes;
+    vt_stackallocator_block_free(sa, header);
+
+    // update stats
+    vt_allocator_stats_on_free(&alloctr->stats, bytes);
+
+    // debug info
+    VT_DEBUG_PRINTF("%s:%s:%zu: %zu bytes freed\n", file, func, line, bytes);
+    (void)file;
+    (void)func;
+    (void)line;
+}
+
+/* ---------------------- PRIVATE FUNCTIONS ---------------------- */
+
+/** Allocates a zero-initialized block from the buffer, or from the heap if the buffer is full
+    @param sa vt_stackallocator_t instance
+    @param bytes number of bytes
+    @param alignment power of 2
+
+    @returns block header
+*/
+static struct VitaStackBlockHeader *vt_stackallocator_block_alloc(vt_stackallocator_t *const sa, const size_t bytes, const size_t alignment) {
+    struct VitaStackBlockHeader *const header = vt_stackallocator_carve(sa, bytes, alignment);
+    return header != NULL ? header : vt_stackallocator_spill(sa, bytes, alignment);
+}
+
+/** Frees a buffer or heap block
+    @param sa vt_stackallocator_t instance
+    @param header block header
+*/
+static void vt_stackallocator_block_free(vt_stackallocator_t *const sa, struct VitaStackBlockHeader *const header) {
+    if (vt_stackallocator_owns(sa, vt_stackallocator_block_data(header))) {
+        header->alignment = 0;
+        vt_stackallocator_rewind(sa);
+    } else {
+        vt_stackallocator_spill_free(sa, header);
+    }
+}
+
+/** Carves a zero-initialized block from the buffer
+    @param sa vt_stackallocator_t instance
+    @param bytes number of bytes
+    @param alignment power of 2
+
+    @returns block header or NULL if the buffer has not enough space
+*/
+static struct VitaStackBlockHeader *vt_stackallocator_carve(vt_stackallocator_t *const sa, const size_t bytes, const size_t alignment) {
+    // place the header right before the aligned data
+    const uintptr_t start = (uintptr_t)(sa->buf + sa->offset) + sizeof(struct VitaStackBlockHeader);
+    const size_t data_offset = (size_t)(((start + alignment - 1) & ~(uintptr_t)(alignment - 1)) - (uintptr_t)sa->buf);
+    if (data_offset > sa->capacity || bytes > sa->capacity - data_offset) {
+        return NULL;
+    }
+
+    // carve; the buffer may hold data of previously freed blocks
+    char *const data = sa->buf + data_offset;
+    memset(data, 0, bytes);
+    struct VitaStackBlockHeader *const header = vt_stackallocator_block_header(data);
+    *header = (struct VitaStackBlockHeader) {
+        .prev = sa->top,
+        .bytes = bytes,
+        .alignment = alignment,
+        .generation = sa->generation,
+    };
+    sa->top = header;
+    sa->offset = data_offset + bytes;
+
+    return header;
+}
+
+/** Allocates a zero-initialized block from the heap and links it
+    @param sa vt_stackallocator_t instance
+    @param bytes number of bytes
+    @param alignment power of 2
+
+    @returns block header
+*/
+static struct VitaStackBlockHeader *vt_stackallocator_spill(vt_stackallocator_t *const sa, const size_t bytes, const size_t alignment) {
+    char *const mem = VT_CALLOC_ALIGNED(vt_stackallocator_spill_offset(alignment) + bytes, alignment);
+    struct VitaStackBlockHeader *const header = vt_stackallocator_block_header(mem + vt_stackallocator_spill_offset(alignment));
+    *header = (struct VitaStackBlockHeader) {
+        .next = sa->spills,
+        .bytes = bytes,
+        .alignment = alignment,
+        .generation = sa->generation,
+    };
+
+    // link
+    if (sa->spills != NULL) {
+        sa->spills->prev = header;
+    }
+    sa->spills = header;
+    sa->count_spills++;
+
+    return header;
+}
+
+/** Unlinks a heap block and frees it
+    @param sa vt_stackallocator_t instance
+    @param header block header
+*/
+static void vt_stackallocator_spill_free(vt_stackallocator_t *const sa, struct VitaStackBlockHeader *const header) {
+    // unlink
+    if (header->prev != NULL) {
+        header->prev->next = header->next;
+    } else {
+        sa->spills = header->next;
+    }
+    if (header->next != NULL) {
+        header->next->prev = header->prev;
+    }
+
+    // release
+    VT_FREE_ALIGNED(vt_stackallocator_block_data(header) - vt_stackallocator_spill_offset(header->alignment));
+}
+
+/** Pops freed blocks from the top of the buffer
+    @param sa vt_stackallocator_t instance
+*/
+static void vt_stackallocator_rewind(vt_stackallocator_t *const sa) {
+    while (sa->top != NULL && sa->top->alignment == 0) {
+        sa->top = sa->top->prev;
+    }
+    sa->offset = (sa->top != NULL) ? (size_t)(vt_stackallocator_block_data(sa->top) - sa->buf) + sa->top->bytes : 0;
+}
+
+/** Checks if a block was carved from the buffer
+    @param sa vt_stackallocator_t instance
+    @param ptr block data
+
+    @returns `true` if the block lies within the buffer
+*/
+static bool vt_stackallocator_owns(const vt_stackallocator_t *const sa, const void *const ptr) {
+    return (uintptr_t)ptr >= (uintptr_t)sa->buf && (uintptr_t)ptr < (uintptr_t)sa->buf + sa->capacity;
+}
+
+/** Checks if a block was allocated after the last reset
+    @param sa vt_stackallocator_t instance
+    @param header block header
+
+    @returns `true` if the block has not been released by a reset
+
+    @note heap blocks are looked up in the spill list, since a reset frees them
+*/
+static bool vt_stackallocator_is_live(const vt_stackallocator_t *const sa, const struct VitaStackBlockHeader *const header) {
+    if (vt_stackallocator_owns(sa, vt_stackallocator_block_data(header))) {
+        return header->generation == sa->generation;
+    }
+
+    for (const struct VitaStackBlockHeader *spill = sa->spills; spill != NULL; spill = spill->next) {
+        if (spill == header) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/** Returns offset of heap block data from the start of its allocation
+    @param alignment power of 2
+    @returns the header size rounded up to the alignment
+*/
+static size_t vt_stackallocator_spill_offset(const size_t alignment) {
+    return (sizeof(struct VitaStackBlockHeader) + alignment - 1) & ~(alignment - 1);
+}
+
+/** Returns block header of an allocated block
+    @param ptr allocated block
+    @returns block header
+*/
+static struct VitaStackBlockHeader *vt_stackallocator_block_header(const void *const ptr) {
+    return (struct VitaStackBlockHeader*)((char*)ptr - sizeof(struct VitaStackBlockHeader));
+}
+
+/** Returns block data
+    @param header block header
+    @returns pointer to block data
+*/
+static char *vt_stackallocator_block_data(const struct VitaStackBlockHeader *const header) {
+    return (char*)header + sizeof(struct VitaStackBlockHeader);
+}
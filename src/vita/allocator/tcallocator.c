@@ -0,0 +1,517 @@
+#include "vita/allocator/tcallocator.h"
+
+#if defined(_WIN32) || defined(_WIN64)
+    #include <windows.h>
+    #define VT_TCALLOCATOR_YIELD() SwitchToThread()
+#else
+    #include <sched.h>
+    #define VT_TCALLOCATOR_YIELD() sched_yield()
+#endif
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    #include <immintrin.h>
+    #define VT_TCALLOCATOR_PAUSE() _mm_pause()
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    #include <intrin.h>
+    #define VT_TCALLOCATOR_PAUSE() _mm_pause()
+#elif defined(__GNUC__) && defined(__aarch64__)
+    #define VT_TCALLOCATOR_PAUSE() __asm__ __volatile__("yield")
+#else
+    #define VT_TCALLOCATOR_PAUSE() ((void)0)
+#endif
+
+#define VT_TCALLOCATOR_SPINS 64     // number of spins before the lock waiter yields its time slice
+
+// cached free blocks of a size class
+struct VitaThreadCacheClass {
+    void *blocks;               // free blocks (next pointer is stored inside the block)
+    size_t count;               // number of cached blocks
+};
+
+// per-thread cache of an allocator
+struct VitaThreadCache {
+    size_t id;                                                          // allocator id, 0 if unused
+    struct VitaThreadCacheClass classes[VT_ALLOCATOR_SIZE_CLASS_COUNT];
+    struct VitaAllocatorStats stats;                                    // changes not yet merged into allocator stats
+};
+
+static atomic_size_t vt_tcallocator_next_id = 1;
+static _Thread_local struct VitaThreadCache vt_tcallocator_caches[VT_TCALLOCATOR_THREAD_CACHES];
+
+// ids of live allocators, used to reuse thread caches left behind by destroyed allocators
+static atomic_flag vt_tcallocator_registry_lock = ATOMIC_FLAG_INIT;
+static size_t *vt_tcallocator_registry = NULL;
+static size_t vt_tcallocator_registry_len = 0;
+static size_t vt_tcallocator_registry_cap = 0;
+static atomic_size_t vt_tcallocator_epoch = 0;                      // incremented whenever an allocator is destroyed
+static _Thread_local size_t vt_tcallocator_epoch_seen = 0;          // epoch at which the calling thread last released stale caches
+
+static void *vt_tcallocator_block_alloc(vt_tcallocator_t *const tc, struct VitaThreadCache *const cache, const size_t bytes);
+static void vt_tcallocator_block_free(vt_tcallocator_t *const tc, struct VitaThreadCache *const cache, void *const ptr);
+static struct VitaThreadCache *vt_tcallocator_cache_get(const vt_tcallocator_t *const tc);
+static struct VitaThreadCache *vt_tcallocator_cache_find(const vt_tcallocator_t *const tc);
+static void vt_tcallocator_cache_refill(vt_tcallocator_t *const tc, struct VitaThreadCache *const cache, const size_t class_idx);
+static void vt_tcallocator_cache_drain(vt_tcallocator_t *const tc, struct VitaThreadCache *const cache, const size_t class_idx, size_t count);
+static void vt_tcallocator_merge_stats(vt_tcallocator_t *const tc, struct VitaThreadCache *const cache);
+static void vt_tcallocator_cache_release_stale(void);
+static void vt_tcallocator_registry_add(const size_t id);
+static void vt_tcallocator_registry_remove(const size_t id);
+static bool vt_tcallocator_registry_has(const size_t id);
+static void vt_tcallocator_lock(atomic_flag *const lock);
+static void vt_tcallocator_unlock(atomic_flag *const lock);
+static struct VitaPoolBlockHeader *vt_tcallocator_block_header(const void *const ptr);
+
+vt_tcallocator_t *vt_tcallocator_create(void) {
+    // create an allocator instance
+    vt_tcallocator_t *tc = VT_CALLOC(sizeof(vt_tcallocator_t));
+    tc->id = atomic_fetch_add(&vt_tcallocator_next_id, 1);
+    tc->pool = vt_pool_create();
+    atomic_flag_clear(&tc->lock);
+    vt_tcallocator_registry_add(tc->id);
+
+    // set up functions
+    tc->base.alloc = vt_tcallocator_alloc;
+    tc->base.realloc = vt_tcallocator_realloc;
+    tc->base.free = vt_tcallocator_free;
+
+    return tc;
+}
+
+void vt_tcallocator_destroy(vt_tcallocator_t *tc) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(tc != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    // release the cache of the calling thread, the blocks are freed along with the pool
+    struct VitaThreadCache *const cache = vt_tcallocator_cache_find(tc);
+    if (cache != NULL) {
+        cache->id = 0;
+    }
+
+    // caches of other threads are released lazily once they run out of unused caches
+    vt_tcallocator_registry_remove(tc->id);
+    atomic_fetch_add(&vt_tcallocator_epoch, 1);
+
+    // free the pool and allocator itself
+    vt_pool_destroy(tc->pool);
+    VT_FREE(tc);
+    tc = NULL;
+}
+
+void vt_tcallocator_flush(vt_tcallocator_t *const tc) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(tc != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    struct VitaThreadCache *const cache = vt_tcallocator_cache_find(tc);
+    if (cache == NULL) {
+        return;
+    }
+
+    // return all blocks to the pool and merge stats
+    vt_tcallocator_lock(&tc->lock);
+    for (size_t i = 0; i < VT_ALLOCATOR_SIZE_CLASS_COUNT; i++) {
+        vt_tcallocator_cache_drain(tc, cache, i, cache->classes[i].count);
+    }
+    vt_tcallocator_merge_stats(tc, cache);
+    vt_tcallocator_unlock(&tc->lock);
+
+    // release the cache
+    cache->id = 0;
+}
+
+struct VitaAllocatorStats vt_tcallocator_get_stats(vt_tcallocator_t *const tc) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(tc != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    // merge stats of the calling thread and copy them while no other thread is merging
+    struct VitaThreadCache *const cache = vt_tcallocator_cache_find(tc);
+    vt_tcallocator_lock(&tc->lock);
+    if (cache != NULL) {
+        vt_tcallocator_merge_stats(tc, cache);
+    }
+    const struct VitaAllocatorStats stats = tc->base.stats;
+    vt_tcallocator_unlock(&tc->lock);
+
+    return stats;
+}
+
+void *vt_tcallocator_alloc(struct VitaBaseAllocatorType *const alloctr, const size_t bytes, const char *const file, const char *const func, const size_t line) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(alloctr != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    VT_DEBUG_ASSERT(bytes > 0, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    vt_tcallocator_t *const tc = (vt_tcallocator_t*)alloctr;
+    struct VitaThreadCache *const cache = vt_tcallocator_cache_get(tc);
+
+    void *ptr = NULL;
+    if (cache == NULL) {
+        // no thread cache is available, allocate from the pool directly
+        vt_tcallocator_lock(&tc->lock);
+        vt_allocator_stats_on_alloc(&tc->base.stats, bytes);
+        ptr = VT_ALLOCATOR_ALLOC(&tc->pool->base, bytes);
+        vt_tcallocator_unlock(&tc->lock);
+    } else {
+        // update stats
+        vt_allocator_stats_on_alloc(&cache->stats, bytes);
+
+        // allocate memory
+        ptr = vt_tcallocator_block_alloc(tc, cache, bytes);
+    }
+
+    // debug info
+    VT_DEBUG_PRINTF("%s:%s:%zu: %zu bytes allocated\n", file, func, line, bytes);
+    (void)file;
+    (void)func;
+    (void)line;
+
+    return ptr;
+}
+
+void *vt_tcallocator_realloc(struct VitaBaseAllocatorType *const alloctr, void *ptr, const size_t bytes, const char *const file, const char *const func, const size_t line) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(alloctr != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    VT_DEBUG_ASSERT(ptr != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    VT_DEBUG_ASSERT(bytes > 0, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    vt_tcallocator_t *const tc = (vt_tcallocator_t*)alloctr;
+    struct VitaThreadCache *const cache = vt_tcallocator_cache_get(tc);
+    struct VitaPoolBlockHeader *const header = vt_tcallocator_block_header(ptr);
+    const size_t bytes_old = header->bytes;
+
+    void *ptr_new = ptr;
+    if (cache == NULL) {
+        // no thread cache is available, reallocate in the pool directly
+        vt_tcallocator_lock(&tc->lock);
+        vt_allocator_stats_on_realloc(&tc->base.stats, bytes_old, bytes);
+        ptr_new = VT_ALLOCATOR_REALLOC(&tc->pool->base, ptr, bytes);
+        vt_tcallocator_unlock(&tc->lock);
+    } else {
+        // update stats
+        vt_allocator_stats_on_realloc(&cache->stats, bytes_old, bytes);
+
+        if (header->class_idx < VT_ALLOCATOR_SIZE_CLASS_COUNT && bytes <= vt_pool_class_size(header->class_idx)) {
+            // the block is big enough, resize in place
+            if (bytes > bytes_old) {
+                memset((char*)ptr + bytes_old, 0, bytes - bytes_old);
+            }
+            header->bytes = bytes;
+        } else {
+            // move to a block of another size class
+            ptr_new = vt_tcallocator_block_alloc(tc, cache, bytes);
+            memcpy(ptr_new, ptr, bytes_old < bytes ? bytes_old : bytes);
+            vt_tcallocator_block_free(tc, cache, ptr);
+        }
+    }
+
+    // debug info
+    VT_DEBUG_PRINTF("%s:%s:%zu: %zu bytes reallocated (old size: %zu)\n", file, func, line, bytes, bytes_old);
+    (void)file;
+    (void)func;
+    (void)line;
+
+    return ptr_new;
+}
+
+void vt_tcallocator_free(struct VitaBaseAllocatorType *const alloctr, void *ptr, const char *const file, const char *const func, const size_t line) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(alloctr != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    VT_DEBUG_ASSERT(ptr != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    vt_tcallocator_t *const tc = (vt_tcallocator_t*)alloctr;
+    struct VitaThreadCache *const cache = vt_tcallocator_cache_get(tc);
+    const size_t bytes = vt_tcallocator_block_header(ptr)->bytes;
+
+    if (cache == NULL) {
+        // no thread cache is available, return the block to the pool directly
+        vt_tcallocator_lock(&tc->lock);
+        vt_allocator_stats_on_free(&tc->base.stats, bytes);
+        VT_ALLOCATOR_FREE(&tc->pool->base, ptr);
+        vt_tcallocator_unlock(&tc->lock);
+    } else {
+        // update stats
+        vt_allocator_stats_on_free(&cache->stats, bytes);
+
+        // free memory
+        vt_tcallocator_block_free(tc, cache, ptr);
+    }
+
+    // debug info
+    VT_DEBUG_PRINTF("%s:%s:%zu: %zu bytes freed\n", file, func, line, bytes);
+    (void)file;
+    (void)func;
+    (void)line;
+}
+
+/* ---------------------- PRIVATE FUNCTIONS ---------------------- */
+
+/** Takes a zero-initialized block from the thread cache or allocates a large block from the pool
+    @param tc vt_tcallocator_t instance
+    @param cache thread cache
+    @param bytes number of bytes
+
+    @returns pointer to block data
+*/
+static void *vt_tcallocator_block_alloc(vt_tcallocator_t *const tc, struct VitaThreadCache *const cache, const size_t bytes) {
+    const size_t class_idx = vt_pool_class_index(bytes);
+    if (class_idx >= VT_ALLOCATOR_SIZE_CLASS_COUNT) {
+        // large blocks are allocated from the pool directly
+        vt_tcallocator_lock(&tc->lock);
+        void *const ptr = VT_ALLOCATOR_ALLOC(&tc->pool->base, bytes);
+        vt_tcallocator_merge_stats(tc, cache);
+        vt_tcallocator_unlock(&tc->lock);
+
+        return ptr;
+    }
+
+    // take a block from the thread cache, refill it from the pool if empty
+    struct VitaThreadCacheClass *const cc = &cache->classes[class_idx];
+    if (cc->count == 0) {
+        cache->stats.count_class_misses[class_idx]++;
+        vt_tcallocator_cache_refill(tc, cache, class_idx);
+    } else {
+        cache->stats.count_class_hits[class_idx]++;
+    }
+
+    void *const ptr = cc->blocks;
+    cc->blocks = *(void**)ptr;
+    cc->count--;
+
+    vt_tcallocator_block_header(ptr)->bytes = bytes;
+    return memset(ptr, 0, bytes);
+}
+
+/** Puts a block to the thread cache, drains the cache if it is full, or returns a large block to the pool
+    @param tc vt_tcallocator_t instance
+    @param cache thread cache
+    @param ptr pointer to block data
+*/
+static void vt_tcallocator_block_free(vt_tcallocator_t *const tc, struct VitaThreadCache *const cache, void *const ptr) {
+    const size_t class_idx = vt_tcallocator_block_header(ptr)->class_idx;
+    if (class_idx >= VT_ALLOCATOR_SIZE_CLASS_COUNT) {
+        // large blocks are returned to the pool directly
+        vt_tcallocator_lock(&tc->lock);
+        VT_ALLOCATOR_FREE(&tc->pool->base, ptr);
+        vt_tcallocator_merge_stats(tc, cache);
+        vt_tcallocator_unlock(&tc->lock);
+
+        return;
+    }
+
+    // push the block to the thread cache, drain half of it to the pool if full
+    struct VitaThreadCacheClass *const cc = &cache->classes[class_idx];
+    *(void**)ptr = cc->blocks;
+    cc->blocks = ptr;
+    cc->count++;
+
+    if (cc->count >= VT_TCALLOCATOR_CACHE_SIZE) {
+        vt_tcallocator_lock(&tc->lock);
+        vt_tcallocator_cache_drain(tc, cache, class_idx, VT_TCALLOCATOR_CACHE_BATCH);
+        vt_tcallocator_merge_stats(tc, cache);
+        vt_tcallocator_unlock(&tc->lock);
+    }
+}
+
+/** Returns the calling thread cache of an allocator, sets up a new one if there is none
+    @param tc vt_tcallocator_t instance
+    @returns thread cache or `NULL` if all thread caches are taken by other allocators
+
+    @note a cache is never evicted while its allocator is alive, since only its owner thread could flush it
+*/
+static struct VitaThreadCache *vt_tcallocator_cache_get(const vt_tcallocator_t *const tc) {
+    struct VitaThreadCache *const cache = vt_tcallocator_cache_find(tc);
+    if (cache != NULL) {
+        return cache;
+    }
+
+    // take an unused cache, release caches of destroyed allocators if there is none
+    for (size_t pass = 0; pass < 2; pass++) {
+        for (size_t i = 0; i < VT_TCALLOCATOR_THREAD_CACHES; i++) {
+            if (vt_tcallocator_caches[i].id == 0) {
+                vt_tcallocator_caches[i] = (struct VitaThreadCache) {
+                    .id = tc->id,
+                };
+                return &vt_tcallocator_caches[i];
+            }
+        }
+
+        // nothing was destroyed since the last check
+        const size_t epoch = atomic_load(&vt_tcallocator_epoch);
+        if (epoch == vt_tcallocator_epoch_seen) {
+            break;
+        }
+        vt_tcallocator_epoch_seen = epoch;
+        vt_tcallocator_cache_release_stale();
+    }
+
+    return NULL;
+}
+
+/** Finds the calling thread cache of an allocator
+    @param tc vt_tcallocator_t instance
+    @returns thread cache or `NULL` if the thread has none
+*/
+static struct VitaThreadCache *vt_tcallocator_cache_find(const vt_tcallocator_t *const tc) {
+    for (size_t i = 0; i < VT_TCALLOCATOR_THREAD_CACHES; i++) {
+        if (vt_tcallocator_caches[i].id == tc->id) {
+            return &vt_tcallocator_caches[i];
+        }
+    }
+
+    return NULL;
+}
+
+/** Releases the calling thread caches of destroyed allocators
+    @note the cached blocks were freed along with the pool of the allocator, so they are dropped
+*/
+static void vt_tcallocator_cache_release_stale(void) {
+    for (size_t i = 0; i < VT_TCALLOCATOR_THREAD_CACHES; i++) {
+        if (vt_tcallocator_caches[i].id != 0 && !vt_tcallocator_registry_has(vt_tcallocator_caches[i].id)) {
+            vt_tcallocator_caches[i].id = 0;
+        }
+    }
+}
+
+/** Adds an allocator id to the registry of live allocators
+    @param id allocator id
+*/
+static void vt_tcallocator_registry_add(const size_t id) {
+    vt_tcallocator_lock(&vt_tcallocator_registry_lock);
+    if (vt_tcallocator_registry_len == vt_tcallocator_registry_cap) {
+        vt_tcallocator_registry_cap = vt_tcallocator_registry_cap ? vt_tcallocator_registry_cap * 2 : 8;
+        vt_tcallocator_registry = VT_REALLOC(vt_tcallocator_registry, vt_tcallocator_registry_cap * sizeof(size_t));
+    }
+    vt_tcallocator_registry[vt_tcallocator_registry_len++] = id;
+    vt_tcallocator_unlock(&vt_tcallocator_registry_lock);
+}
+
+/** Removes an allocator id from the registry of live allocators, frees the registry once it is empty
+    @param id allocator id
+*/
+static void vt_tcallocator_registry_remove(const size_t id) {
+    vt_tcallocator_lock(&vt_tcallocator_registry_lock);
+    for (size_t i = 0; i < vt_tcallocator_registry_len; i++) {
+        if (vt_tcallocator_registry[i] == id) {
+            vt_tcallocator_registry[i] = vt_tcallocator_registry[--vt_tcallocator_registry_len];
+            break;
+        }
+    }
+    if (vt_tcallocator_registry_len == 0) {
+        VT_FREE(vt_tcallocator_registry);
+        vt_tcallocator_registry = NULL;
+        vt_tcallocator_registry_cap = 0;
+    }
+    vt_tcallocator_unlock(&vt_tcallocator_registry_lock);
+}
+
+/** Checks if an allocator is alive
+    @param id allocator id
+    @returns `true` if the allocator has not been destroyed
+*/
+static bool vt_tcallocator_registry_has(const size_t id) {
+    bool found = false;
+    vt_tcallocator_lock(&vt_tcallocator_registry_lock);
+    for (size_t i = 0; i < vt_tcallocator_registry_len && !found; i++) {
+        found = vt_tcallocator_registry[i] == id;
+    }
+    vt_tcallocator_unlock(&vt_tcallocator_registry_lock);
+
+    return found;
+}
+
+/** Moves a batch of blocks from the pool to the thread cache and merges stats
+    @param tc vt_tcallocator_t instance
+    @param cache thread cache
+    @param class_idx size class index
+*/
+static void vt_tcallocator_cache_refill(vt_tcallocator_t *const tc, struct VitaThreadCache *const cache, const size_t class_idx) {
+    struct VitaThreadCacheClass *const cc = &cache->classes[class_idx];
+    const size_t class_size = vt_pool_class_size(class_idx);
+
+    vt_tcallocator_lock(&tc->lock);
+    for (size_t i = 0; i < VT_TCALLOCATOR_CACHE_BATCH; i++) {
+        void *const ptr = VT_ALLOCATOR_ALLOC(&tc->pool->base, class_size);
+        *(void**)ptr = cc->blocks;
+        cc->blocks = ptr;
+    }
+    vt_tcallocator_merge_stats(tc, cache);
+    vt_tcallocator_unlock(&tc->lock);
+
+    cc->count += VT_TCALLOCATOR_CACHE_BATCH;
+}
+
+/** Moves blocks from the thread cache to the pool
+    @param tc vt_tcallocator_t instance
+    @param cache thread cache
+    @param class_idx size class index
+    @param count number of blocks to move
+
+    @note the lock must be held
+*/
+static void vt_tcallocator_cache_drain(vt_tcallocator_t *const tc, struct VitaThreadCache *const cache, const size_t class_idx, size_t count) {
+    struct VitaThreadCacheClass *const cc = &cache->classes[class_idx];
+    while (count-- > 0 && cc->blocks != NULL) {
+        void *const ptr = cc->blocks;
+        cc->blocks = *(void**)ptr;
+        cc->count--;
+        VT_ALLOCATOR_FREE(&tc->pool->base, ptr);
+    }
+}
+
+/** Adds thread stats to allocator stats and resets them
+    @param tc vt_tcallocator_t instance
+    @param cache thread cache
+
+    @note the lock must be held
+*/
+static void vt_tcallocator_merge_stats(vt_tcallocator_t *const tc, struct VitaThreadCache *const cache) {
+    // thread stats are deltas, which may wrap around, so peaks are recomputed after merging
+    struct VitaAllocatorStats *const stats = &tc->base.stats;
+    stats->count_allocs += cache->stats.count_allocs;
+    stats->count_reallocs += cache->stats.count_reallocs;
+    stats->count_frees += cache->stats.count_frees;
+    stats->count_bytes_allocated += cache->stats.count_bytes_allocated;
+    stats->count_bytes_freed += cache->stats.count_bytes_freed;
+    stats->count_objects_live += cache->stats.count_objects_live;
+    stats->count_reallocs_grow += cache->stats.count_reallocs_grow;
+    stats->count_reallocs_shrink += cache->stats.count_reallocs_shrink;
+    for (size_t i = 0; i < VT_ALLOCATOR_SIZE_CLASS_COUNT; i++) {
+        stats->count_class_hits[i] += cache->stats.count_class_hits[i];
+        stats->count_class_misses[i] += cache->stats.count_class_misses[i];
+    }
+    for (size_t i = 0; i < VT_ALLOCATOR_HIST_BINS; i++) {
+        stats->count_size_hist[i] += cache->stats.count_size_hist[i];
+    }
+    vt_allocator_stats_update_peak(stats);
+
+    cache->stats = (struct VitaAllocatorStats) {0};
+}
+
+/** Acquires a spinlock
+    @param lock allocator or registry lock
+*/
+static void vt_tcallocator_lock(atomic_flag *const lock) {
+    size_t spins = 0;
+    while (atomic_flag_test_and_set_explicit(lock, memory_order_acquire)) {
+        // the holder may have been preempted, give up the time slice instead of spinning through it
+        if (++spins < VT_TCALLOCATOR_SPINS) {
+            VT_TCALLOCATOR_PAUSE();
+        } else {
+            spins = 0;
+            VT_TCALLOCATOR_YIELD();
+        }
+    }
+}
+
+/** Releases a spinlock
+    @param lock allocator or registry lock
+*/
+static void vt_tcallocator_unlock(atomic_flag *const lock) {
+    atomic_flag_clear_explicit(lock, memory_order_release);
+}
+
+/** Returns header of an allocated block
+    @param ptr allocated block
+    @returns pointer to block header
+*/
+static struct VitaPoolBlockHeader *vt_tcallocator_block_header(const void *const ptr) {
+    return (struct VitaPoolBlockHeader*)ptr - 1;
+}
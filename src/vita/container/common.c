@@ -70,6 +70,47 @@ bool vt_array_has_alloctr(const struct VitaBaseArrayType *const vbat) {
     return !(vbat->alloctr == NULL);
 }
 
+void vt_array_set_growth_policy(struct VitaBaseArrayType *const vbat, const enum VitaGrowthPolicy policy) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(vt_array_is_valid_object(vbat), "%s\n", vt_status_to_str(VT_STATUS_ERROR_IS_INVALID_OBJECT));
+    VT_DEBUG_ASSERT(policy < VT_GROWTH_POLICY_COUNT, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    vbat->growth_policy = policy;
+}
+
+size_t vt_array_growth(const struct VitaBaseArrayType *const vbat, const size_t n) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(vt_array_is_valid_object(vbat), "%s\n", vt_status_to_str(VT_STATUS_ERROR_IS_INVALID_OBJECT));
+
+    // number of elements to add
+    const size_t capacity = vbat->capacity;
+    const size_t chunk = VT_ARRAY_GROWTH_CHUNK_BYTES / vbat->elsize;
+    const size_t cap = VT_ARRAY_GROWTH_CAP_BYTES / vbat->elsize;
+    size_t growth = 0;
+    switch (vbat->growth_policy) {
+        case VT_GROWTH_POLICY_DEFAULT:
+            growth = capacity * VT_ARRAY_DEFAULT_GROWTH_RATE;
+            break;
+        case VT_GROWTH_POLICY_FACTOR_2:
+            growth = capacity;
+            break;
+        case VT_GROWTH_POLICY_FACTOR_1_5:
+            growth = capacity / 2;
+            break;
+        case VT_GROWTH_POLICY_LINEAR:
+            growth = chunk;
+            break;
+        case VT_GROWTH_POLICY_CAPPED:
+            growth = capacity < cap ? capacity : cap;
+            break;
+        case VT_GROWTH_POLICY_EXACT:
+        default:
+            break;
+    }
+
+    return growth > n ? growth : n;
+}
+
 void *vt_array_get(const struct VitaBaseArrayType *const vbat, const size_t at) {
     // check for invalid input
     VT_DEBUG_ASSERT(vt_array_is_valid_object(vbat), "%s\n", vt_status_to_str(VT_STATUS_ERROR_IS_INVALID_OBJECT));
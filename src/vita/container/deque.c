@@ -0,0 +1,394 @@
+#include "vita/container/deque.h"
+
+static char *vt_deque_slot(const vt_deque_t *const d, const size_t idx);
+static void vt_deque_copy(void *const dst, const void *const src, const size_t n);
+static void vt_deque_grow(vt_deque_t *const d, const size_t capacity);
+
+vt_deque_t *vt_deque_create(const size_t n, const size_t elsize, struct VitaBaseAllocatorType *const alloctr) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(n > 0, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    VT_DEBUG_ASSERT(elsize > 0, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    // round up to a power of 2, so that indices wrap around with a mask
+    size_t capacity = 1;
+    while (capacity < n) {
+        capacity <<= 1;
+    }
+
+    // allocate a new vt_deque_t instance
+    vt_deque_t *d = alloctr ? VT_ALLOCATOR_ALLOC(alloctr, sizeof(vt_deque_t)) : VT_CALLOC(sizeof(vt_deque_t));
+    *d = (vt_deque_t) {
+        .alloctr = alloctr,
+        .ptr = alloctr ? VT_ALLOCATOR_ALLOC(alloctr, capacity * elsize) : VT_CALLOC(capacity * elsize),
+        .capacity = capacity,
+        .elsize = elsize,
+    };
+
+    return d;
+}
+
+void vt_deque_destroy(vt_deque_t *d) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(d != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    // free the buffer and vt_deque_t instance itself
+    if (d->alloctr) {
+        VT_ALLOCATOR_FREE(d->alloctr, d->ptr);
+        VT_ALLOCATOR_FREE(d->alloctr, d);
+    } else {
+        VT_FREE(d->ptr);
+        VT_FREE(d);
+    }
+    d = NULL;
+}
+
+size_t vt_deque_len(const vt_deque_t *const d) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(d != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    return d->len;
+}
+
+size_t vt_deque_capacity(const vt_deque_t *const d) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(d != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    return d->capacity;
+}
+
+bool vt_deque_is_empty(const vt_deque_t *const d) {
+    return !vt_deque_len(d);
+}
+
+void vt_deque_clear(vt_deque_t *const d) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(d != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    d->head = 0;
+    d->len = 0;
+}
+
+void vt_deque_reserve(vt_deque_t *const d, const size_t n) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(d != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    VT_DEBUG_ASSERT(n > 0, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    // round up to a power of 2
+    size_t capacity = d->capacity;
+    while (capacity < d->capacity + n) {
+        capacity <<= 1;
+    }
+    vt_deque_grow(d, capacity);
+}
+
+void vt_deque_push_front(vt_deque_t *const d, const void *const val) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(d != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    VT_DEBUG_ASSERT(val != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    // check if new memory needs to be allocated
+    if (d->len == d->capacity) {
+        vt_deque_grow(d, d->capacity * 2);
+    }
+
+    // the head moves back, wrapping around to the end of the buffer
+    d->head = (d->head - 1) & (d->capacity - 1);
+    vt_deque_copy(vt_deque_slot(d, d->head), val, d->elsize);
+    d->len++;
+}
+
+#define VT_INSTANTIATE_DEQUE_PUSH_FRONT(T, t)                       \
+    void vt_deque_push_front##t(vt_deque_t *const d, const T val) { \
+        vt_deque_push_front(d, &val);                               \
+    }
+VT_INSTANTIATE_DEQUE_PUSH_FRONT(int8_t, i8)
+VT_INSTANTIATE_DEQUE_PUSH_FRONT(uint8_t, u8)
+VT_INSTANTIATE_DEQUE_PUSH_FRONT(int16_t, i16)
+VT_INSTANTIATE_DEQUE_PUSH_FRONT(uint16_t, u16)
+VT_INSTANTIATE_DEQUE_PUSH_FRONT(int32_t, i32)
+VT_INSTANTIATE_DEQUE_PUSH_FRONT(uint32_t, u32)
+VT_INSTANTIATE_DEQUE_PUSH_FRONT(int64_t, i64)
+VT_INSTANTIATE_DEQUE_PUSH_FRONT(uint64_t, u64)
+VT_INSTANTIATE_DEQUE_PUSH_FRONT(float, f)
+VT_INSTANTIATE_DEQUE_PUSH_FRONT(double, d)
+VT_INSTANTIATE_DEQUE_PUSH_FRONT(real, r)
+#undef VT_INSTANTIATE_DEQUE_PUSH_FRONT
+
+void vt_deque_push_back(vt_deque_t *const d, const void *const val) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(d != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    VT_DEBUG_ASSERT(val != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    // check if new memory needs to be allocated
+    if (d->len == d->capacity) {
+        vt_deque_grow(d, d->capacity * 2);
+    }
+
+    // copy val past the last element
+    vt_deque_copy(vt_deque_slot(d, d->head + d->len), val, d->elsize);
+    d->len++;
+}
+
+#define VT_INSTANTIATE_DEQUE_PUSH_BACK(T, t)                       \
+    void vt_deque_push_back##t(vt_deque_t *const d, const T val) { \
+        vt_deque_push_back(d, &val);                               \
+    }
+VT_INSTANTIATE_DEQUE_PUSH_BACK(int8_t, i8)
+VT_INSTANTIATE_DEQUE_PUSH_BACK(uint8_t, u8)
+VT_INSTANTIATE_DEQUE_PUSH_BACK(int16_t, i16)
+VT_INSTANTIATE_DEQUE_PUSH_BACK(uint16_t, u16)
+VT_INSTANTIATE_DEQUE_PUSH_BACK(int32_t, i32)
+VT_INSTANTIATE_DEQUE_PUSH_BACK(uint32_t, u32)
+VT_INSTANTIATE_DEQUE_PUSH_BACK(int64_t, i64)
+VT_INSTANTIATE_DEQUE_PUSH_BACK(uint64_t, u64)
+VT_INSTANTIATE_DEQUE_PUSH_BACK(float, f)
+VT_INSTANTIATE_DEQUE_PUSH_BACK(double, d)
+VT_INSTANTIATE_DEQUE_PUSH_BACK(real, r)
+#undef VT_INSTANTIATE_DEQUE_PUSH_BACK
+
+void vt_deque_push_back_n(vt_deque_t *const d, const void *const vals, const size_t n) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(d != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    VT_DEBUG_ASSERT(vals != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    // check if new memory needs to be allocated
+    if (d->len + n > d->capacity) {
+        vt_deque_reserve(d, d->len + n - d->capacity);
+    }
+
+    // copy up to the end of the buffer, then the rest to its start
+    const size_t start = (d->head + d->len) & (d->capacity - 1);
+    const size_t first = n < d->capacity - start ? n : d->capacity - start;
+    memcpy(vt_deque_slot(d, start), vals, first * d->elsize);
+    memcpy(d->ptr, (const char*)vals + first * d->elsize, (n - first) * d->elsize);
+    d->len += n;
+}
+
+void vt_deque_pop_front(vt_deque_t *const d) {
+    vt_deque_pop_get_front(d);
+}
+
+void vt_deque_pop_back(vt_deque_t *const d) {
+    vt_deque_pop_get_back(d);
+}
+
+void *vt_deque_pop_get_front(vt_deque_t *const d) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(d != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    // pop the first element
+    if (d->len > 0) {
+        void *const ptr = vt_deque_slot(d, d->head);
+        d->head = (d->head + 1) & (d->capacity - 1);
+        d->len--;
+        return ptr;
+    }
+
+    return NULL;
+}
+
+#define VT_INSTANTIATE_DEQUE_POP_GET_FRONT(T, t)        \
+    T vt_deque_pop_get_front##t(vt_deque_t *const d) {  \
+        void *ptr = vt_deque_pop_get_front(d);          \
+        return ptr ? *(T*)ptr : 0;                      \
+    }
+VT_INSTANTIATE_DEQUE_POP_GET_FRONT(int8_t, i8)
+VT_INSTANTIATE_DEQUE_POP_GET_FRONT(uint8_t, u8)
+VT_INSTANTIATE_DEQUE_POP_GET_FRONT(int16_t, i16)
+VT_INSTANTIATE_DEQUE_POP_GET_FRONT(uint16_t, u16)
+VT_INSTANTIATE_DEQUE_POP_GET_FRONT(int32_t, i32)
+VT_INSTANTIATE_DEQUE_POP_GET_FRONT(uint32_t, u32)
+VT_INSTANTIATE_DEQUE_POP_GET_FRONT(int64_t, i64)
+VT_INSTANTIATE_DEQUE_POP_GET_FRONT(uint64_t, u64)
+VT_INSTANTIATE_DEQUE_POP_GET_FRONT(float, f)
+VT_INSTANTIATE_DEQUE_POP_GET_FRONT(double, d)
+VT_INSTANTIATE_DEQUE_POP_GET_FRONT(real, r)
+#undef VT_INSTANTIATE_DEQUE_POP_GET_FRONT
+
+void *vt_deque_pop_get_back(vt_deque_t *const d) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(d != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    // pop the last element
+    if (d->len > 0) {
+        return vt_deque_slot(d, d->head + --d->len);
+    }
+
+    return NULL;
+}
+
+#define VT_INSTANTIATE_DEQUE_POP_GET_BACK(T, t)         \
+    T vt_deque_pop_get_back##t(vt_deque_t *const d) {   \
+        void *ptr = vt_deque_pop_get_back(d);           \
+        return ptr ? *(T*)ptr : 0;                      \
+    }
+VT_INSTANTIATE_DEQUE_POP_GET_BACK(int8_t, i8)
+VT_INSTANTIATE_DEQUE_POP_GET_BACK(uint8_t, u8)
+VT_INSTANTIATE_DEQUE_POP_GET_BACK(int16_t, i16)
+VT_INSTANTIATE_DEQUE_POP_GET_BACK(uint16_t, u16)
+VT_INSTANTIATE_DEQUE_POP_GET_BACK(int32_t, i32)
+VT_INSTANTIATE_DEQUE_POP_GET_BACK(uint32_t, u32)
+VT_INSTANTIATE_DEQUE_POP_GET_BACK(int64_t, i64)
+VT_INSTANTIATE_DEQUE_POP_GET_BACK(uint64_t, u64)
+VT_INSTANTIATE_DEQUE_POP_GET_BACK(float, f)
+VT_INSTANTIATE_DEQUE_POP_GET_BACK(double, d)
+VT_INSTANTIATE_DEQUE_POP_GET_BACK(real, r)
+#undef VT_INSTANTIATE_DEQUE_POP_GET_BACK
+
+size_t vt_deque_pop_front_n(vt_deque_t *const d, void *const dst, const size_t n) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(d != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    // copy up to the end of the buffer, then the rest from its start
+    const size_t count = n < d->len ? n : d->len;
+    if (dst != NULL) {
+        const size_t first = count < d->capacity - d->head ? count : d->capacity - d->head;
+        memcpy(dst, vt_deque_slot(d, d->head), first * d->elsize);
+        memcpy((char*)dst + first * d->elsize, d->ptr, (count - first) * d->elsize);
+    }
+    d->head = (d->head + count) & (d->capacity - 1);
+    d->len -= count;
+
+    return count;
+}
+
+void vt_deque_set(vt_deque_t *const d, const void *const val, const size_t at) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(val != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    vt_deque_copy(vt_deque_get(d, at), val, d->elsize);
+}
+
+#define VT_INSTANTIATE_DEQUE_SET(T, t)                                          \
+    void vt_deque_set##t(vt_deque_t *const d, const T val, const size_t at) {   \
+        vt_deque_set(d, &val, at);                                              \
+    }
+VT_INSTANTIATE_DEQUE_SET(int8_t, i8)
+VT_INSTANTIATE_DEQUE_SET(uint8_t, u8)
+VT_INSTANTIATE_DEQUE_SET(int16_t, i16)
+VT_INSTANTIATE_DEQUE_SET(uint16_t, u16)
+VT_INSTANTIATE_DEQUE_SET(int32_t, i32)
+VT_INSTANTIATE_DEQUE_SET(uint32_t, u32)
+VT_INSTANTIATE_DEQUE_SET(int64_t, i64)
+VT_INSTANTIATE_DEQUE_SET(uint64_t, u64)
+VT_INSTANTIATE_DEQUE_SET(float, f)
+VT_INSTANTIATE_DEQUE_SET(double, d)
+VT_INSTANTIATE_DEQUE_SET(real, r)
+#undef VT_INSTANTIATE_DEQUE_SET
+
+void *vt_deque_get(const vt_deque_t *const d, const size_t at) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(d != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    VT_DEBUG_ASSERT(
+        at < d->len,
+        "%s: Out of bounds memory access at %zu, but length is %zu!\n",
+        vt_status_to_str(VT_STATUS_ERROR_OUT_OF_BOUNDS_ACCESS),
+        at,
+        d->len
+    );
+
+    return vt_deque_slot(d, d->head + at);
+}
+
+#define VT_INSTANTIATE_DEQUE_GET(T, t)                                  \
+    T vt_deque_get##t(const vt_deque_t *const d, const size_t at) {     \
+        return *(T*)(vt_deque_get(d, at));                              \
+    }
+VT_INSTANTIATE_DEQUE_GET(int8_t, i8)
+VT_INSTANTIATE_DEQUE_GET(uint8_t, u8)
+VT_INSTANTIATE_DEQUE_GET(int16_t, i16)
+VT_INSTANTIATE_DEQUE_GET(uint16_t, u16)
+VT_INSTANTIATE_DEQUE_GET(int32_t, i32)
+VT_INSTANTIATE_DEQUE_GET(uint32_t, u32)
+VT_INSTANTIATE_DEQUE_GET(int64_t, i64)
+VT_INSTANTIATE_DEQUE_GET(uint64_t, u64)
+VT_INSTANTIATE_DEQUE_GET(float, f)
+VT_INSTANTIATE_DEQUE_GET(double, d)
+VT_INSTANTIATE_DEQUE_GET(real, r)
+#undef VT_INSTANTIATE_DEQUE_GET
+
+void vt_deque_spans(const vt_deque_t *const d, vt_span_t *const first, vt_span_t *const second) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(d != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    VT_DEBUG_ASSERT(first != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    VT_DEBUG_ASSERT(second != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    // the first segment ends at the end of the buffer at most
+    const size_t len = d->len < d->capacity - d->head ? d->len : d->capacity - d->head;
+    *first = (vt_span_t) {
+        .instance.ptr = vt_deque_slot(d, d->head),
+        .instance.len = len,
+        .instance.elsize = d->elsize,
+    };
+    *second = (vt_span_t) {
+        .instance.ptr = d->ptr,
+        .instance.len = d->len - len,
+        .instance.elsize = d->elsize,
+    };
+}
+
+void vt_deque_apply(const vt_deque_t *const d, void (*func)(void*, size_t)) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(d != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    VT_DEBUG_ASSERT(func != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    VT_FOREACH(i, 0, d->len) {
+        func(vt_deque_slot(d, d->head + i), i);
+    }
+}
+
+/* ---------------------- PRIVATE FUNCTIONS ---------------------- */
+
+/** Returns a pointer into the buffer
+    @param d vt_deque_t instance
+    @param idx buffer index, wrapped around the capacity
+    @returns pointer to the element
+*/
+static char *vt_deque_slot(const vt_deque_t *const d, const size_t idx) {
+    return (char*)d->ptr + (idx & (d->capacity - 1)) * d->elsize;
+}
+
+/** Copies an element, integer-sized elements are copied inline
+    @param dst destination
+    @param src source
+    @param n number of bytes
+*/
+static void vt_deque_copy(void *const dst, const void *const src, const size_t n) {
+    switch (n) {
+        case 4:
+            memcpy(dst, src, 4);
+            break;
+        case 8:
+            memcpy(dst, src, 8);
+            break;
+        default:
+            memcpy(dst, src, n);
+            break;
+    }
+}
+
+/** Reallocates the buffer and unwraps the elements that wrapped around its end
+    @param d vt_deque_t instance
+    @param capacity new capacity, power of 2 and at least twice the current one
+*/
+static void vt_deque_grow(vt_deque_t *const d, const size_t capacity) {
+    // reallocate
+    const size_t capacity_old = d->capacity;
+    const size_t bytes = capacity * d->elsize;
+    d->ptr = d->alloctr
+        ? VT_ALLOCATOR_REALLOC(d->alloctr, d->ptr, bytes)
+        : VT_REALLOC(d->ptr, bytes);
+    d->capacity = capacity;
+
+    // nothing wrapped around
+    if (d->head + d->len <= capacity_old) {
+        return;
+    }
+
+    // move the smaller segment: the wrapped part after the old end, or the front part to the new end
+    const size_t first = capacity_old - d->head;
+    const size_t second = d->len - first;
+    if (second <= first) {
+        memcpy((char*)d->ptr + capacity_old * d->elsize, d->ptr, second * d->elsize);
+    } else {
+        memcpy((char*)d->ptr + (capacity - first) * d->elsize, (char*)d->ptr + d->head * d->elsize, first * d->elsize);
+        d->head = capacity - first;
+    }
+}
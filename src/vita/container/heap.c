@@ -0,0 +1,603 @@
+#include "vita/container/heap.h"
+
+// numeric element types: kind, type, suffix
+#define VT_HEAP_FOREACH_KIND(apply)         \
+    apply(VT_HEAP_KIND_I8, int8_t, i8)      \
+    apply(VT_HEAP_KIND_U8, uint8_t, u8)     \
+    apply(VT_HEAP_KIND_I16, int16_t, i16)   \
+    apply(VT_HEAP_KIND_U16, uint16_t, u16)  \
+    apply(VT_HEAP_KIND_I32, int32_t, i32)   \
+    apply(VT_HEAP_KIND_U32, uint32_t, u32)  \
+    apply(VT_HEAP_KIND_I64, int64_t, i64)   \
+    apply(VT_HEAP_KIND_U64, uint64_t, u64)  \
+    apply(VT_HEAP_KIND_F, float, f)         \
+    apply(VT_HEAP_KIND_D, double, d)        \
+    apply(VT_HEAP_KIND_R, real, r)
+
+static vt_heap_t *vt_heap_new(const size_t n, const size_t elsize, struct VitaBaseAllocatorType *const alloctr);
+static char *vt_heap_at(const vt_heap_t *const heap, const size_t pos);
+static size_t *vt_heap_handle_at(const vt_heap_t *const heap, const size_t pos);
+static size_t *vt_heap_position_of(const vt_heap_t *const heap, const size_t handle);
+static size_t vt_heap_handle_acquire(vt_heap_t *const heap, const size_t pos);
+static void vt_heap_handle_release(vt_heap_t *const heap, const size_t pos);
+static void vt_heap_move(vt_heap_t *const heap, const size_t pos, const void *const src, const size_t handle);
+static void vt_heap_swap(vt_heap_t *const heap, const size_t i, const size_t j);
+static size_t vt_heap_sift_up_generic(vt_heap_t *const heap, size_t pos);
+static size_t vt_heap_sift_down_generic(vt_heap_t *const heap, size_t pos);
+static void vt_heap_sift_up(vt_heap_t *const heap, const size_t pos);
+static void vt_heap_sift_down(vt_heap_t *const heap, const size_t pos);
+static void vt_heap_fix(vt_heap_t *const heap, const size_t pos);
+
+#define VT_PROTOTYPE_HEAP_PRIVATE(K, T, t)                                                          \
+    static int32_t vt_heap_cmp_min##t(const void *a, const void *b);                                \
+    static int32_t vt_heap_cmp_max##t(const void *a, const void *b);                                \
+    static void vt_heap_sift_up_min##t(T *const a, size_t pos);                                     \
+    static void vt_heap_sift_up_max##t(T *const a, size_t pos);                                     \
+    static void vt_heap_sift_down_min##t(T *const a, const size_t len, size_t pos);                 \
+    static void vt_heap_sift_down_max##t(T *const a, const size_t len, size_t pos);
+VT_HEAP_FOREACH_KIND(VT_PROTOTYPE_HEAP_PRIVATE)
+#undef VT_PROTOTYPE_HEAP_PRIVATE
+
+vt_heap_t *vt_heap_create(const size_t n, const size_t elsize, int32_t (*cmp)(const void *a, const void *b), struct VitaBaseAllocatorType *const alloctr) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(cmp != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    vt_heap_t *heap = vt_heap_new(n, elsize, alloctr);
+    heap->cmp = cmp;
+
+    return heap;
+}
+
+#define VT_INSTANTIATE_HEAP_CREATE(K, T, t)                                                                                 \
+    vt_heap_t *vt_heap_create##t(const size_t n, const enum VitaHeapOrder order, struct VitaBaseAllocatorType *const alloctr) { \
+        VT_DEBUG_ASSERT(order < VT_HEAP_ORDER_COUNT, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));         \
+        vt_heap_t *heap = vt_heap_new(n, sizeof(T), alloctr);                                                               \
+        heap->cmp = order == VT_HEAP_ORDER_MIN ? vt_heap_cmp_min##t : vt_heap_cmp_max##t;                                   \
+        heap->kind = K;                                                                                                     \
+        heap->order = order;                                                                                                \
+        return heap;                                                                                                        \
+    }
+VT_HEAP_FOREACH_KIND(VT_INSTANTIATE_HEAP_CREATE)
+#undef VT_INSTANTIATE_HEAP_CREATE
+
+void vt_heap_destroy(vt_heap_t *heap) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(heap != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    // free handles
+    if (heap->handles) {
+        vt_vec_destroy(heap->handles);
+        vt_vec_destroy(heap->positions);
+        vt_vec_destroy(heap->free_handles);
+    }
+
+    // free elements and vt_heap_t instance itself
+    struct VitaBaseAllocatorType *const alloctr = heap->data->alloctr;
+    vt_vec_destroy(heap->data);
+    if (alloctr) {
+        VT_ALLOCATOR_FREE(alloctr, heap->tmp);
+        VT_ALLOCATOR_FREE(alloctr, heap);
+    } else {
+        VT_FREE(heap->tmp);
+        VT_FREE(heap);
+    }
+    heap = NULL;
+}
+
+size_t vt_heap_len(const vt_heap_t *const heap) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(heap != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    return vt_vec_len(heap->data);
+}
+
+bool vt_heap_is_empty(const vt_heap_t *const heap) {
+    return !vt_heap_len(heap);
+}
+
+void vt_heap_clear(vt_heap_t *const heap) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(heap != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    vt_vec_clear(heap->data);
+    if (heap->handles) {
+        vt_vec_clear(heap->handles);
+        vt_vec_clear(heap->positions);
+        vt_vec_clear(heap->free_handles);
+    }
+}
+
+void vt_heap_reserve(vt_heap_t *const heap, const size_t n) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(heap != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    vt_vec_reserve(heap->data, n);
+    if (heap->handles) {
+        vt_vec_reserve(heap->handles, n);
+        vt_vec_reserve(heap->positions, n);
+    }
+}
+
+void vt_heap_enable_handles(vt_heap_t *const heap) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(heap != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    VT_DEBUG_ASSERT(vt_heap_is_empty(heap), "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    // already enabled
+    if (heap->handles) {
+        return;
+    }
+
+    // numeric heaps are sifted with their comparator from now on, since handles move along with elements
+    const size_t n = vt_vec_capacity(heap->data);
+    heap->handles = vt_vec_create(n, sizeof(size_t), heap->data->alloctr);
+    heap->positions = vt_vec_create(n, sizeof(size_t), heap->data->alloctr);
+    heap->free_handles = vt_vec_create(VT_ARRAY_DEFAULT_INIT_ELEMENTS, sizeof(size_t), heap->data->alloctr);
+}
+
+size_t vt_heap_push(vt_heap_t *const heap, const void *const val) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(heap != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    VT_DEBUG_ASSERT(val != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    // append, then move up
+    const size_t pos = vt_vec_len(heap->data);
+    vt_vec_push_back(heap->data, val);
+    if (!heap->handles) {
+        vt_heap_sift_up(heap, pos);
+        return VT_HEAP_NO_HANDLE;
+    }
+
+    const size_t handle = vt_heap_handle_acquire(heap, pos);
+    vt_vec_push_back(heap->handles, &handle);
+    vt_heap_sift_up_generic(heap, pos);
+
+    return handle;
+}
+
+#define VT_INSTANTIATE_HEAP_PUSH(K, T, t)                           \
+    size_t vt_heap_push##t(vt_heap_t *const heap, const T val) {    \
+        return vt_heap_push(heap, &val);                            \
+    }
+VT_HEAP_FOREACH_KIND(VT_INSTANTIATE_HEAP_PUSH)
+#undef VT_INSTANTIATE_HEAP_PUSH
+
+void *vt_heap_peek(const vt_heap_t *const heap) {
+    return vt_heap_is_empty(heap) ? NULL : heap->data->ptr;
+}
+
+#define VT_INSTANTIATE_HEAP_PEEK(K, T, t)                   \
+    T vt_heap_peek##t(const vt_heap_t *const heap) {        \
+        const void *ptr = vt_heap_peek(heap);               \
+        return ptr ? *(const T*)ptr : 0;                    \
+    }
+VT_HEAP_FOREACH_KIND(VT_INSTANTIATE_HEAP_PEEK)
+#undef VT_INSTANTIATE_HEAP_PEEK
+
+void vt_heap_pop(vt_heap_t *const heap) {
+    vt_heap_pop_get(heap);
+}
+
+void *vt_heap_pop_get(vt_heap_t *const heap) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(heap != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    // nothing to pop
+    const size_t len = vt_vec_len(heap->data);
+    if (len == 0) {
+        return NULL;
+    }
+
+    // the top goes past the end, the last element goes to the top and moves down
+    if (heap->handles) {
+        vt_heap_handle_release(heap, 0);
+    }
+    vt_heap_swap(heap, 0, len - 1);
+    void *const ptr = vt_vec_pop_get(heap->data);
+    if (heap->handles) {
+        vt_vec_pop(heap->handles);
+    }
+    vt_heap_sift_down(heap, 0);
+
+    return ptr;
+}
+
+#define VT_INSTANTIATE_HEAP_POP_GET(K, T, t)            \
+    T vt_heap_pop_get##t(vt_heap_t *const heap) {       \
+        void *ptr = vt_heap_pop_get(heap);              \
+        return ptr ? *(T*)ptr : 0;                      \
+    }
+VT_HEAP_FOREACH_KIND(VT_INSTANTIATE_HEAP_POP_GET)
+#undef VT_INSTANTIATE_HEAP_POP_GET
+
+size_t vt_heap_replace(vt_heap_t *const heap, const void *const val) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(heap != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    VT_DEBUG_ASSERT(val != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    VT_DEBUG_ASSERT(!vt_heap_is_empty(heap), "%s\n", vt_status_to_str(VT_STATUS_ERROR_OUT_OF_BOUNDS_ACCESS));
+
+    // overwrite the top, then move it down
+    memcpy(heap->data->ptr, val, heap->data->elsize);
+    if (!heap->handles) {
+        vt_heap_sift_down(heap, 0);
+        return VT_HEAP_NO_HANDLE;
+    }
+
+    vt_heap_handle_release(heap, 0);
+    const size_t handle = vt_heap_handle_acquire(heap, 0);
+    *vt_heap_handle_at(heap, 0) = handle;
+    vt_heap_sift_down_generic(heap, 0);
+
+    return handle;
+}
+
+void vt_heap_heapify(vt_heap_t *const heap, const vt_vec_t *const v) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(heap != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    VT_DEBUG_ASSERT(vt_array_is_valid_object(v), "%s\n", vt_status_to_str(VT_STATUS_ERROR_IS_INVALID_OBJECT));
+    VT_DEBUG_ASSERT(v->elsize == heap->data->elsize, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INCOMPATIBLE_DATATYPE));
+
+    // copy the elements
+    const size_t len = vt_vec_len(v);
+    vt_heap_clear(heap);
+    if (len == 0) {
+        return;
+    }
+    if (vt_vec_capacity(heap->data) < len) {
+        vt_vec_reserve(heap->data, len - vt_vec_capacity(heap->data));
+    }
+    memcpy(heap->data->ptr, v->ptr, len * v->elsize);
+    heap->data->len = len;
+
+    // handles are the indices in the vector
+    if (heap->handles) {
+        VT_FOREACH(i, 0, len) {
+            vt_vec_push_back(heap->handles, &i);
+            vt_vec_push_back(heap->positions, &i);
+        }
+    }
+
+    // move every parent down, starting from the last one: O(n) in total
+    for (size_t pos = len / 2; pos-- > 0;) {
+        vt_heap_sift_down(heap, pos);
+    }
+}
+
+void *vt_heap_get(const vt_heap_t *const heap, const size_t handle) {
+    return vt_heap_at(heap, *vt_heap_position_of(heap, handle));
+}
+
+void vt_heap_update(vt_heap_t *const heap, const size_t handle, const void *const val) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(val != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    const size_t pos = *vt_heap_position_of(heap, handle);
+    memcpy(vt_heap_at(heap, pos), val, heap->data->elsize);
+    vt_heap_fix(heap, pos);
+}
+
+void vt_heap_remove(vt_heap_t *const heap, const size_t handle) {
+    const size_t pos = *vt_heap_position_of(heap, handle);
+    const size_t last = vt_vec_len(heap->data) - 1;
+
+    // the last element takes the place of the removed one
+    vt_heap_handle_release(heap, pos);
+    vt_heap_swap(heap, pos, last);
+    vt_vec_pop(heap->data);
+    vt_vec_pop(heap->handles);
+    if (pos < last) {
+        vt_heap_fix(heap, pos);
+    }
+}
+
+/* ---------------------- PRIVATE FUNCTIONS ---------------------- */
+
+/** Allocates a heap without a comparator
+    @param n number of elements to make room for
+    @param elsize element size
+    @param alloctr allocator instance
+    @returns `vt_heap_t*`
+*/
+static vt_heap_t *vt_heap_new(const size_t n, const size_t elsize, struct VitaBaseAllocatorType *const alloctr) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(elsize > 0, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    // allocate a new vt_heap_t instance
+    vt_heap_t *heap = alloctr ? VT_ALLOCATOR_ALLOC(alloctr, sizeof(vt_heap_t)) : VT_CALLOC(sizeof(vt_heap_t));
+    *heap = (vt_heap_t) {
+        .data = vt_vec_create(n > 0 ? n : VT_ARRAY_DEFAULT_INIT_ELEMENTS, elsize, alloctr),
+        .tmp = alloctr ? VT_ALLOCATOR_ALLOC(alloctr, elsize) : VT_CALLOC(elsize),
+        .kind = VT_HEAP_KIND_CUSTOM,
+        .order = VT_HEAP_ORDER_MIN,
+    };
+
+    return heap;
+}
+
+/** Returns the element at a heap position
+    @param heap vt_heap_t instance
+    @param pos heap position
+    @returns pointer to the element
+*/
+static char *vt_heap_at(const vt_heap_t *const heap, const size_t pos) {
+    return (char*)heap->data->ptr + pos * heap->data->elsize;
+}
+
+/** Returns the handle of the element at a heap position
+    @param heap vt_heap_t instance with handles enabled
+    @param pos heap position
+    @returns pointer to the handle
+*/
+static size_t *vt_heap_handle_at(const vt_heap_t *const heap, const size_t pos) {
+    return (size_t*)heap->handles->ptr + pos;
+}
+
+/** Returns the heap position of a handle
+    @param heap vt_heap_t instance with handles enabled
+    @param handle element handle
+    @returns pointer to the heap position
+*/
+static size_t *vt_heap_position_of(const vt_heap_t *const heap, const size_t handle) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(heap != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    VT_DEBUG_ASSERT(heap->handles != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_IS_NULL));
+    VT_DEBUG_ASSERT(handle < vt_vec_len(heap->positions), "%s\n", vt_status_to_str(VT_STATUS_ERROR_OUT_OF_BOUNDS_ACCESS));
+    VT_DEBUG_ASSERT(((size_t*)heap->positions->ptr)[handle] != VT_HEAP_NO_HANDLE, "%s\n", vt_status_to_str(VT_STATUS_ERROR_ELEMENT_NOT_FOUND));
+
+    return (size_t*)heap->positions->ptr + handle;
+}
+
+/** Takes a released handle or a new one for an element
+    @param heap vt_heap_t instance with handles enabled
+    @param pos heap position of the element
+    @returns handle
+*/
+static size_t vt_heap_handle_acquire(vt_heap_t *const heap, const size_t pos) {
+    if (!vt_vec_is_empty(heap->free_handles)) {
+        const size_t handle = *(size_t*)vt_vec_pop_get(heap->free_handles);
+        ((size_t*)heap->positions->ptr)[handle] = pos;
+        return handle;
+    }
+
+    vt_vec_push_back(heap->positions, &pos);
+    return vt_vec_len(heap->positions) - 1;
+}
+
+/** Releases the handle of the element at a heap position
+    @param heap vt_heap_t instance with handles enabled
+    @param pos heap position
+*/
+static void vt_heap_handle_release(vt_heap_t *const heap, const size_t pos) {
+    const size_t handle = *vt_heap_handle_at(heap, pos);
+    ((size_t*)heap->positions->ptr)[handle] = VT_HEAP_NO_HANDLE;
+    vt_vec_push_back(heap->free_handles, &handle);
+}
+
+/** Copies an element into a heap position and updates its handle
+    @param heap vt_heap_t instance with handles enabled
+    @param pos heap position
+    @param src element
+    @param handle handle of the element
+*/
+static void vt_heap_move(vt_heap_t *const heap, const size_t pos, const void *const src, const size_t handle) {
+    memcpy(vt_heap_at(heap, pos), src, heap->data->elsize);
+    *vt_heap_handle_at(heap, pos) = handle;
+    ((size_t*)heap->positions->ptr)[handle] = pos;
+}
+
+/** Swaps two elements and their handles
+    @param heap vt_heap_t instance
+    @param i heap position
+    @param j heap position
+*/
+static void vt_heap_swap(vt_heap_t *const heap, const size_t i, const size_t j) {
+    if (i == j) {
+        return;
+    }
+
+    const size_t elsize = heap->data->elsize;
+    memcpy(heap->tmp, vt_heap_at(heap, i), elsize);
+    memcpy(vt_heap_at(heap, i), vt_heap_at(heap, j), elsize);
+    memcpy(vt_heap_at(heap, j), heap->tmp, elsize);
+
+    // released handles are not updated
+    if (heap->handles) {
+        size_t *const hi = vt_heap_handle_at(heap, i);
+        size_t *const hj = vt_heap_handle_at(heap, j);
+        const size_t handle = *hi;
+        *hi = *hj;
+        *hj = handle;
+
+        size_t *const positions = heap->positions->ptr;
+        if (positions[*hi] != VT_HEAP_NO_HANDLE) {
+            positions[*hi] = i;
+        }
+        if (positions[*hj] != VT_HEAP_NO_HANDLE) {
+            positions[*hj] = j;
+        }
+    }
+}
+
+/** Moves an element up with the comparator, keeping handles up to date
+    @param heap vt_heap_t instance
+    @param pos heap position
+    @returns new heap position
+*/
+static size_t vt_heap_sift_up_generic(vt_heap_t *const heap, size_t pos) {
+    // the element is held aside while parents move down into the hole
+    const size_t elsize = heap->data->elsize;
+    const size_t handle = heap->handles ? *vt_heap_handle_at(heap, pos) : VT_HEAP_NO_HANDLE;
+    memcpy(heap->tmp, vt_heap_at(heap, pos), elsize);
+    while (pos > 0) {
+        const size_t parent = (pos - 1) / 2;
+        if (heap->cmp(heap->tmp, vt_heap_at(heap, parent)) >= 0) {
+            break;
+        }
+
+        if (heap->handles) {
+            vt_heap_move(heap, pos, vt_heap_at(heap, parent), *vt_heap_handle_at(heap, parent));
+        } else {
+            memcpy(vt_heap_at(heap, pos), vt_heap_at(heap, parent), elsize);
+        }
+        pos = parent;
+    }
+
+    if (heap->handles) {
+        vt_heap_move(heap, pos, heap->tmp, handle);
+    } else {
+        memcpy(vt_heap_at(heap, pos), heap->tmp, elsize);
+    }
+
+    return pos;
+}
+
+/** Moves an element down with the comparator, keeping handles up to date
+    @param heap vt_heap_t instance
+    @param pos heap position
+    @returns new heap position
+*/
+static size_t vt_heap_sift_down_generic(vt_heap_t *const heap, size_t pos) {
+    const size_t len = vt_vec_len(heap->data);
+    if (pos >= len) {
+        return pos;
+    }
+
+    // the element is held aside while children move up into the hole
+    const size_t elsize = heap->data->elsize;
+    const size_t handle = heap->handles ? *vt_heap_handle_at(heap, pos) : VT_HEAP_NO_HANDLE;
+    memcpy(heap->tmp, vt_heap_at(heap, pos), elsize);
+    while (2 * pos + 1 < len) {
+        // the child that goes first
+        size_t child = 2 * pos + 1;
+        if (child + 1 < len && heap->cmp(vt_heap_at(heap, child + 1), vt_heap_at(heap, child)) < 0) {
+            child++;
+        }
+        if (heap->cmp(vt_heap_at(heap, child), heap->tmp) >= 0) {
+            break;
+        }
+
+        if (heap->handles) {
+            vt_heap_move(heap, pos, vt_heap_at(heap, child), *vt_heap_handle_at(heap, child));
+        } else {
+            memcpy(vt_heap_at(heap, pos), vt_heap_at(heap, child), elsize);
+        }
+        pos = child;
+    }
+
+    if (heap->handles) {
+        vt_heap_move(heap, pos, heap->tmp, handle);
+    } else {
+        memcpy(vt_heap_at(heap, pos), heap->tmp, elsize);
+    }
+
+    return pos;
+}
+
+/** Moves an element up, numbers without handles are compared directly
+    @param heap vt_heap_t instance
+    @param pos heap position
+*/
+static void vt_heap_sift_up(vt_heap_t *const heap, const size_t pos) {
+    if (heap->handles) {
+        vt_heap_sift_up_generic(heap, pos);
+        return;
+    }
+
+    #define VT_HEAP_SIFT_UP_CASE(K, T, t)                           \
+        case K:                                                     \
+            if (heap->order == VT_HEAP_ORDER_MIN) {                 \
+                vt_heap_sift_up_min##t(heap->data->ptr, pos);       \
+            } else {                                                \
+                vt_heap_sift_up_max##t(heap->data->ptr, pos);       \
+            }                                                       \
+            break;
+    switch (heap->kind) {
+        VT_HEAP_FOREACH_KIND(VT_HEAP_SIFT_UP_CASE)
+        default:
+            vt_heap_sift_up_generic(heap, pos);
+            break;
+    }
+    #undef VT_HEAP_SIFT_UP_CASE
+}
+
+/** Moves an element down, numbers without handles are compared directly
+    @param heap vt_heap_t instance
+    @param pos heap position
+*/
+static void vt_heap_sift_down(vt_heap_t *const heap, const size_t pos) {
+    if (heap->handles) {
+        vt_heap_sift_down_generic(heap, pos);
+        return;
+    }
+
+    const size_t len = vt_vec_len(heap->data);
+    #define VT_HEAP_SIFT_DOWN_CASE(K, T, t)                             \
+        case K:                                                         \
+            if (heap->order == VT_HEAP_ORDER_MIN) {                     \
+                vt_heap_sift_down_min##t(heap->data->ptr, len, pos);    \
+            } else {                                                    \
+                vt_heap_sift_down_max##t(heap->data->ptr, len, pos);    \
+            }                                                           \
+            break;
+    switch (heap->kind) {
+        VT_HEAP_FOREACH_KIND(VT_HEAP_SIFT_DOWN_CASE)
+        default:
+            vt_heap_sift_down_generic(heap, pos);
+            break;
+    }
+    #undef VT_HEAP_SIFT_DOWN_CASE
+}
+
+/** Moves an element whose value changed up or down to its place
+    @param heap vt_heap_t instance with handles enabled
+    @param pos heap position
+*/
+static void vt_heap_fix(vt_heap_t *const heap, const size_t pos) {
+    if (vt_heap_sift_up_generic(heap, pos) == pos) {
+        vt_heap_sift_down_generic(heap, pos);
+    }
+}
+
+/** Numeric comparators and sifting: `OP` is `<` for min-heaps and `>` for max-heaps
+*/
+#define VT_INSTANTIATE_HEAP_SIFT(T, t, order, OP)                                   \
+    static int32_t vt_heap_cmp_##order##t(const void *a, const void *b) {           \
+        const T x = *(const T*)a;                                                   \
+        const T y = *(const T*)b;                                                   \
+        return (x OP y) ? -1 : (y OP x) ? 1 : 0;                                    \
+    }                                                                               \
+    static void vt_heap_sift_up_##order##t(T *const a, size_t pos) {                \
+        const T x = a[pos];                                                         \
+        while (pos > 0) {                                                           \
+            const size_t parent = (pos - 1) / 2;                                    \
+            if (!(x OP a[parent])) {                                                \
+                break;                                                              \
+            }                                                                       \
+            a[pos] = a[parent];                                                     \
+            pos = parent;                                                           \
+        }                                                                           \
+        a[pos] = x;                                                                 \
+    }                                                                               \
+    static void vt_heap_sift_down_##order##t(T *const a, const size_t len, size_t pos) { \
+        if (pos >= len) {                                                           \
+            return;                                                                 \
+        }                                                                           \
+        const T x = a[pos];                                                         \
+        while (2 * pos + 1 < len) {                                                 \
+            size_t child = 2 * pos + 1;                                             \
+            if (child + 1 < len && a[child + 1] OP a[child]) {                      \
+                child++;                                                            \
+            }                                                                       \
+            if (!(a[child] OP x)) {                                                 \
+                break;                                                              \
+            }                                                                       \
+            a[pos] = a[child];                                                      \
+            pos = child;                                                            \
+        }                                                                           \
+        a[pos] = x;                                                                 \
+    }
+#define VT_INSTANTIATE_HEAP_PRIVATE(K, T, t)    \
+    VT_INSTANTIATE_HEAP_SIFT(T, t, min, <)      \
+    VT_INSTANTIATE_HEAP_SIFT(T, t, max, >)
+VT_HEAP_FOREACH_KIND(VT_INSTANTIATE_HEAP_PRIVATE)
+#undef VT_INSTANTIATE_HEAP_PRIVATE
+#undef VT_INSTANTIATE_HEAP_SIFT
@@ -0,0 +1,202 @@
+#include "vita/container/intern.h"
+
+static size_t vt_intern_probe(const vt_intern_t *const in, const char *const z, const size_t n, const uint64_t hash);
+static void vt_intern_grow(vt_intern_t *const in);
+
+vt_intern_t *vt_intern_create(struct VitaBaseAllocatorType *const alloctr) {
+    // create a vt_intern_t instance
+    vt_intern_t *in = VT_ALLOCATOR_ALLOC_OR_DEFAULT(alloctr, sizeof(vt_intern_t));
+    *in = (vt_intern_t) {
+        .alloctr = alloctr,
+        .arena = vt_arena_create(VT_INTERN_CHUNK_SIZE, alloctr),
+        .slots = VT_ALLOCATOR_ALLOC_OR_DEFAULT(alloctr, VT_INTERN_INIT_CAPACITY * sizeof(struct VitaInternSlot)),
+        .capacity = VT_INTERN_INIT_CAPACITY,
+    };
+
+    return in;
+}
+
+void vt_intern_destroy(vt_intern_t *in) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(in != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    // free canonical strings and the table
+    vt_arena_destroy(in->arena);
+    VT_ALLOCATOR_FREE_OR_DEFAULT(in->alloctr, in->slots);
+
+    // free vt_intern_t instance itself
+    VT_ALLOCATOR_FREE_OR_DEFAULT(in->alloctr, in);
+    in = NULL;
+}
+
+void vt_intern_clear(vt_intern_t *const in) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(in != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    // the arena keeps its memory, the table keeps its capacity
+    vt_arena_reset(in->arena);
+    memset(in->slots, 0, in->capacity * sizeof(struct VitaInternSlot));
+    in->len = 0;
+    in->stats = (struct VitaInternStats) {0};
+}
+
+size_t vt_intern_len(const vt_intern_t *const in) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(in != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    return in->len;
+}
+
+const vt_str_t *vt_intern(vt_intern_t *const in, const char *const z) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(z != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    return vt_intern_n(in, z, strlen(z));
+}
+
+const vt_str_t *vt_intern_n(vt_intern_t *const in, const char *const z, const size_t n) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(in != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    VT_DEBUG_ASSERT(z != NULL || n == 0, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    // look up
+    in->stats.count_lookups++;
+    const uint64_t hash = vt_hash(z, n, VT_HASH_DEFAULT_SEED);
+    size_t i = vt_intern_probe(in, z, n, hash);
+    if (in->slots[i].str != NULL) {
+        in->stats.count_hits++;
+        in->stats.bytes_saved += n;
+        return in->slots[i].str;
+    }
+
+    // keep the load factor under 3/4
+    if ((in->len + 1) * 4 > in->capacity * 3) {
+        vt_intern_grow(in);
+        i = vt_intern_probe(in, z, n, hash);
+    }
+
+    // copy: the header is followed by the characters in the same allocation
+    vt_str_t *const s = VT_ALLOCATOR_ALLOC(&in->arena->base, sizeof(vt_str_t) + n + 1);
+    char *const data = (char*)(s + 1);
+    if (n) {
+        memcpy(data, z, n);
+    }
+    *s = (vt_str_t) {
+        .ptr = data,
+        .len = n,
+        .capacity = n,
+        .elsize = sizeof(char),
+        .is_view = true,
+    };
+
+    // insert
+    in->slots[i] = (struct VitaInternSlot) {
+        .hash = hash,
+        .str = s,
+    };
+    in->len++;
+    in->stats.bytes_stored += n;
+
+    return s;
+}
+
+const vt_str_t *vt_intern_str(vt_intern_t *const in, const vt_str_t *const s) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(vt_array_is_valid_object(s), "%s\n", vt_status_to_str(VT_STATUS_ERROR_IS_INVALID_OBJECT));
+    return vt_intern_n(in, vt_str_z(s), vt_str_len(s));
+}
+
+const vt_str_t *vt_intern_view(vt_intern_t *const in, const vt_strview_t sv) {
+    return vt_intern_n(in, sv.ptr, sv.len);
+}
+
+const vt_str_t *vt_intern_find_n(const vt_intern_t *const in, const char *const z, const size_t n) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(in != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    VT_DEBUG_ASSERT(z != NULL || n == 0, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    return in->slots[vt_intern_probe(in, z, n, vt_hash(z, n, VT_HASH_DEFAULT_SEED))].str;
+}
+
+vt_plist_t *vt_intern_split(vt_intern_t *const in, vt_plist_t *ps, const vt_str_t *const s, const char *const sep) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(in != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    VT_DEBUG_ASSERT(vt_array_is_valid_object(s), "%s\n", vt_status_to_str(VT_STATUS_ERROR_IS_INVALID_OBJECT));
+    VT_DEBUG_ASSERT(sep != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    // create a vt_plist_t instance
+    vt_plist_t *p = (ps == NULL)
+        ? vt_plist_create(VT_ARRAY_DEFAULT_INIT_ELEMENTS, NULL)
+        : ps;
+    if (p == NULL) {
+        VT_DEBUG_PRINTF("%s\n", vt_status_to_str(VT_STATUS_ERROR_ALLOCATION));
+        return NULL;
+    }
+
+    // clear
+    vt_plist_clear(p);
+
+    // intern tokens
+    vt_strview_t token;
+    vt_strview_split_iter_t it = vt_strview_split_iter(vt_strview_from_str(s), sep);
+    while (vt_strview_split_next(&it, &token)) {
+        vt_plist_push_back(p, vt_intern_view(in, token));
+    }
+
+    return p;
+}
+
+double vt_intern_hit_rate(const vt_intern_t *const in) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(in != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    return in->stats.count_lookups ? (double)in->stats.count_hits / (double)in->stats.count_lookups : 0;
+}
+
+/* ---------------------- PRIVATE FUNCTIONS ---------------------- */
+
+/** Finds the slot holding a string, or the empty slot where it would be inserted
+    @param in vt_intern_t instance
+    @param z string
+    @param n number of characters
+    @param hash string hash
+    @returns slot index
+*/
+static size_t vt_intern_probe(const vt_intern_t *const in, const char *const z, const size_t n, const uint64_t hash) {
+    const size_t mask = in->capacity - 1;
+    size_t i = (size_t)hash & mask;
+    while (in->slots[i].str != NULL) {
+        const struct VitaInternSlot *const slot = &in->slots[i];
+        if (slot->hash == hash && slot->str->len == n && (!n || !memcmp(slot->str->ptr, z, n))) {
+            break;
+        }
+        i = (i + 1) & mask;
+    }
+
+    return i;
+}
+
+/** Doubles the table capacity and reinserts all strings
+    @param in vt_intern_t instance
+*/
+static void vt_intern_grow(vt_intern_t *const in) {
+    const size_t old_capacity = in->capacity;
+    struct VitaInternSlot *const old_slots = in->slots;
+
+    // allocate a new table
+    in->capacity = old_capacity * 2;
+    in->slots = VT_ALLOCATOR_ALLOC_OR_DEFAULT(in->alloctr, in->capacity * sizeof(struct VitaInternSlot));
+
+    // reinsert: the strings are distinct, so an empty slot is all we need
+    const size_t mask = in->capacity - 1;
+    VT_FOREACH(j, 0, old_capacity) {
+        if (old_slots[j].str == NULL) {
+            continue;
+        }
+
+        size_t i = (size_t)old_slots[j].hash & mask;
+        while (in->slots[i].str != NULL) {
+            i = (i + 1) & mask;
+        }
+        in->slots[i] = old_slots[j];
+    }
+
+    VT_ALLOCATOR_FREE_OR_DEFAULT(in->alloctr, old_slots);
+}
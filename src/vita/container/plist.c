@@ -65,15 +65,22 @@ bool vt_plist_is_empty(const vt_plist_t *const p) {
     return !vt_array_len(p);
 }
 
+void vt_plist_set_growth_policy(vt_plist_t *const p, const enum VitaGrowthPolicy policy) {
+    vt_array_set_growth_policy(p, policy);
+}
+
 void vt_plist_reserve(vt_plist_t *const p, const size_t n) {
     // check for invalid input
     VT_DEBUG_ASSERT(vt_array_is_valid_object(p), "%s\n", vt_status_to_str(VT_STATUS_ERROR_IS_INVALID_OBJECT));
     VT_DEBUG_ASSERT(n > 0, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
 
-    // reserve memory for additional n elements
-    p->ptr2 = p->alloctr 
-        ? VT_ALLOCATOR_REALLOC(p->alloctr, p->ptr2, (p->capacity + n) * p->elsize) 
-        : VT_REALLOC(p->ptr2, (p->capacity + n) * p->elsize);
+    // reserve memory for additional n elements, growing in place if the allocator supports it
+    const size_t bytes = (p->capacity + n) * p->elsize;
+    if (!p->alloctr || !VT_ALLOCATOR_EXPAND(p->alloctr, p->ptr2, bytes)) {
+        p->ptr2 = p->alloctr 
+            ? VT_ALLOCATOR_REALLOC(p->alloctr, p->ptr2, bytes) 
+            : VT_REALLOC(p->ptr2, bytes);
+    }
 
     // update
     p->capacity += n;
@@ -132,7 +139,7 @@ void vt_plist_insert(vt_plist_t *const p, const void *const ptr, const size_t at
 
     // check if new memory needs to be allocated
     if (!vt_plist_has_space(p)) {
-        vt_plist_reserve(p, p->capacity * VT_ARRAY_DEFAULT_GROWTH_RATE);
+        vt_plist_reserve(p, vt_array_growth(p, 1));
     }
 
     // shift values by one value to the end of the vt_vec_t
@@ -200,7 +207,7 @@ void vt_plist_push_back(vt_plist_t *const p, const void *ptr) {
     
     // check if new memory needs to be allocated
     if (!vt_plist_has_space(p)) {
-        vt_plist_reserve(p, p->capacity * VT_ARRAY_DEFAULT_GROWTH_RATE);
+        vt_plist_reserve(p, vt_array_growth(p, 1));
     }
 
     // add ptr to vt_plist_t
@@ -1,7 +1,15 @@
 #include "vita/container/str.h"
+#include "vita/container/strview.h"
 
-static vt_str_t *vt_str_vfmt_set(vt_str_t *s, const char *const fmt, va_list args);
 static vt_str_t *vt_str_vfmt_append(vt_str_t *s, const char *const fmt, va_list args);
+static size_t vt_str_fmt_u64(char *const end, uint64_t v);
+static void vt_str_strip_set(vt_str_t *const s, const vt_ascii_set_t *const set);
+static void vt_str_strip_n(vt_str_t *const s, const size_t lead, const size_t trail);
+static void vt_str_bits_init(uint64_t *const bits, const char *const c);
+static bool vt_str_bits_has(const uint64_t *const bits, const char c);
+static vt_str_t *vt_str_new(struct VitaBaseAllocatorType *const alloctr);
+static char *vt_str_sso_buffer(const vt_str_t *const s);
+static void vt_str_realloc(vt_str_t *const s, const size_t n);
 
 vt_str_t vt_str_create_static(const char *const z) {
     // check for invalid input
@@ -36,14 +44,17 @@ vt_str_t *vt_str_create_len(const size_t n, struct VitaBaseAllocatorType *const
     // check for invalid input
     VT_DEBUG_ASSERT(n > 0, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
 
-    // allocate memory for a vt_str_t struct
-    vt_str_t *s = vt_array_new(alloctr);
+    // allocate memory for a vt_str_t struct, short strings are stored inline
+    vt_str_t *s = vt_str_new(alloctr);
     *s = (vt_str_t) {
         .alloctr = alloctr,
-        .ptr = alloctr ? VT_ALLOCATOR_ALLOC(alloctr, (n + 1) * sizeof(char)) : VT_CALLOC((n + 1) * sizeof(char)),
+        .ptr = (n <= VT_STR_SSO_CAPACITY) 
+            ? vt_str_sso_buffer(s) 
+            : alloctr ? VT_ALLOCATOR_ALLOC(alloctr, (n + 1) * sizeof(char)) : VT_CALLOC((n + 1) * sizeof(char)),
         .len = n,
         .capacity = n,
         .elsize = sizeof(char),
+        .growth_policy = VT_GROWTH_POLICY_EXACT,
     };
 
     // default initiaze it to whitespace
@@ -73,7 +84,9 @@ void vt_str_destroy(vt_str_t *s) {
     }
 
     // free the vt_str_t string and vt_str_t struct
-    if (s->alloctr) {
+    if (vt_str_is_sso(s)) {
+        // stored inline, freed with the struct
+    } else if (s->alloctr) {
         VT_ALLOCATOR_FREE(s->alloctr, s->ptr);
     } else {
         VT_FREE(s->ptr);
@@ -97,7 +110,7 @@ vt_str_t *vt_str_take_ownership(const char *const z, struct VitaBaseAllocatorTyp
     VT_DEBUG_ASSERT(z != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
 
     // allocate memory for a vt_str_t struct
-    vt_str_t *s = vt_array_new(alloctr);
+    vt_str_t *s = vt_str_new(alloctr);
 
     // init
     const size_t zLen = strlen(z);
@@ -107,6 +120,7 @@ vt_str_t *vt_str_take_ownership(const char *const z, struct VitaBaseAllocatorTyp
         .len = zLen,
         .capacity = zLen,
         .elsize = sizeof(char),
+        .growth_policy = VT_GROWTH_POLICY_EXACT,
     };
 
     return s;
@@ -135,6 +149,17 @@ bool vt_str_is_empty(const vt_str_t *const s) {
     return !vt_array_len(s);
 }
 
+bool vt_str_is_sso(const vt_str_t *const s) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(vt_array_is_valid_object(s), "%s\n", vt_status_to_str(VT_STATUS_ERROR_IS_INVALID_OBJECT));
+
+    return !s->is_view && s->ptr == vt_str_sso_buffer(s);
+}
+
+void vt_str_set_growth_policy(vt_str_t *const s, const enum VitaGrowthPolicy policy) {
+    vt_array_set_growth_policy(s, policy);
+}
+
 size_t vt_str_validate_len(vt_str_t *const s) {
     // check for invalid input
     VT_DEBUG_ASSERT(vt_array_is_valid_object(s), "%s\n", vt_status_to_str(VT_STATUS_ERROR_IS_INVALID_OBJECT));
@@ -160,9 +185,7 @@ void vt_str_shrink(vt_str_t *const s) {
     }
 
     // shrink the array capacity to length
-    s->ptr = s->alloctr 
-        ? VT_ALLOCATOR_REALLOC(s->alloctr, s->ptr, (s->len + 1) * s->elsize) 
-        : VT_REALLOC(s->ptr, (s->len + 1) * s->elsize);
+    vt_str_realloc(s, s->len);
 
     // update
     s->capacity = s->len;
@@ -189,9 +212,7 @@ void vt_str_reserve(vt_str_t *const s, const size_t n) {
     VT_ENFORCE(!s->is_view, "%s: Cannot modify a viewable-only object!\n", vt_status_to_str(VT_STATUS_ERROR_IS_VIEW));
 
     // reserve memory for additional n elements
-    s->ptr = s->alloctr 
-        ? VT_ALLOCATOR_REALLOC(s->alloctr, s->ptr, (s->capacity + n + 1) * s->elsize) 
-        : VT_REALLOC(s->ptr, (s->capacity + n + 1) * s->elsize);
+    vt_str_realloc(s, s->capacity + n);
 
     // update
     s->capacity += n;
@@ -207,9 +228,7 @@ void vt_str_resize(vt_str_t *const s, const size_t n) {
     VT_ENFORCE(!s->is_view, "%s: Cannot modify a viewable-only object!\n", vt_status_to_str(VT_STATUS_ERROR_IS_VIEW));
 
     // resize memory to (n + 1) elements
-    s->ptr = s->alloctr 
-        ? VT_ALLOCATOR_REALLOC(s->alloctr, s->ptr, (n + 1) * s->elsize) 
-        : VT_REALLOC(s->ptr, (n + 1) * s->elsize);
+    vt_str_realloc(s, n);
 
     // update
     s->len = (n < s->len) ? n : s->len;
@@ -316,13 +335,98 @@ enum VitaStatus vt_str_appendf(vt_str_t *const s, const char *const fmt, ...) {
     // iterate over all arguments
     va_list args; 
     va_start(args, fmt); 
-    if (vt_str_vfmt_append(s, fmt, args) == NULL) {
-        VT_DEBUG_PRINTF("%s\n", vt_status_to_str(VT_STATUS_OPERATION_FAILURE));
-        return VT_STATUS_OPERATION_FAILURE;
-    }
+    const vt_str_t *const res = vt_str_vfmt_append(s, fmt, args);
     va_end(args);
 
-    return VT_STATUS_OPERATION_SUCCESS;
+    return res ? VT_STATUS_OPERATION_SUCCESS : VT_STATUS_OPERATION_FAILURE;
+}
+
+void vt_str_append_i64(vt_str_t *const s, const int64_t v) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(vt_array_is_valid_object(s), "%s\n", vt_status_to_str(VT_STATUS_ERROR_IS_INVALID_OBJECT));
+
+    // negate in unsigned arithmetic, so INT64_MIN does not overflow
+    char buf[VT_STR_TYPED_BUFFER_SIZE];
+    char *const end = buf + sizeof(buf);
+    const uint64_t u = v < 0 ? 0 - (uint64_t)v : (uint64_t)v;
+    char *p = end - vt_str_fmt_u64(end, u);
+    if (v < 0) {
+        *--p = '-';
+    }
+
+    vt_str_append_n(s, p, (size_t)(end - p));
+}
+
+void vt_str_append_u64(vt_str_t *const s, const uint64_t v) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(vt_array_is_valid_object(s), "%s\n", vt_status_to_str(VT_STATUS_ERROR_IS_INVALID_OBJECT));
+
+    char buf[VT_STR_TYPED_BUFFER_SIZE];
+    char *const end = buf + sizeof(buf);
+    const size_t n = vt_str_fmt_u64(end, v);
+
+    vt_str_append_n(s, end - n, n);
+}
+
+void vt_str_append_hex(vt_str_t *const s, uint64_t v) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(vt_array_is_valid_object(s), "%s\n", vt_status_to_str(VT_STATUS_ERROR_IS_INVALID_OBJECT));
+
+    static const char digits[] = "0123456789abcdef";
+    char buf[VT_STR_TYPED_BUFFER_SIZE];
+    char *const end = buf + sizeof(buf);
+    char *p = end;
+    do {
+        *--p = digits[v & 0xf];
+        v >>= 4;
+    } while (v);
+
+    vt_str_append_n(s, p, (size_t)(end - p));
+}
+
+void vt_str_append_f64(vt_str_t *const s, const double v, const size_t precision) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(vt_array_is_valid_object(s), "%s\n", vt_status_to_str(VT_STATUS_ERROR_IS_INVALID_OBJECT));
+
+    // powers of 10 are exact doubles up to 1e22
+    static const uint64_t pow10[VT_STR_F64_MAX_PRECISION + 1] = {
+        1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL, 10000000ULL, 100000000ULL, 
+        1000000000ULL, 10000000000ULL, 100000000000ULL, 1000000000000ULL, 10000000000000ULL, 
+        100000000000000ULL, 1000000000000000ULL
+    };
+
+    // scale to an integer: v * 10^precision is computed with an error of at most half an ulp,
+    // so its rounding is exact unless the fraction lies that close to one half
+    if (precision <= VT_STR_F64_MAX_PRECISION && isfinite(v)) {
+        const double scaled = fabs(v) * (double)pow10[precision];
+        const double whole = floor(scaled);
+        const double frac = scaled - whole;
+        if (scaled < 1e15 && fabs(frac - 0.5) > scaled * DBL_EPSILON) {
+            char buf[VT_STR_TYPED_BUFFER_SIZE];
+            char *const end = buf + sizeof(buf);
+            char *p = end;
+            uint64_t u = (uint64_t)whole + (frac > 0.5);
+            if (precision) {
+                // fractional digits, padded with zeros
+                const uint64_t f = u % pow10[precision];
+                p -= precision;
+                vt_memset(p, '0', precision);
+                vt_str_fmt_u64(end, f);
+                *--p = '.';
+                u /= pow10[precision];
+            }
+            p -= vt_str_fmt_u64(p, u);
+            if (signbit(v)) {
+                *--p = '-';
+            }
+
+            vt_str_append_n(s, p, (size_t)(end - p));
+            return;
+        }
+    }
+
+    // a halfway case, large value, high precision, inf or nan
+    vt_str_appendf(s, "%.*f", (int32_t)precision, v);
 }
 
 void vt_str_append_n(vt_str_t *const s, const char *z, const size_t n) {
@@ -333,7 +437,7 @@ void vt_str_append_n(vt_str_t *const s, const char *z, const size_t n) {
 
     // check if new memory needs to be allocated
     if (vt_str_has_space(s) < n) {
-        vt_str_reserve(s, (n - vt_str_has_space(s)));
+        vt_str_reserve(s, vt_array_growth(s, n - vt_str_has_space(s)));
     }
 
     // copy z to vt_str_t
@@ -362,7 +466,7 @@ void vt_str_insert(vt_str_t *const s, const char *z, const size_t at) {
     const size_t zLen = strlen(z);
     const size_t hasSpace = vt_str_has_space(s);
     if (hasSpace < zLen) {
-        vt_str_reserve(s, (zLen - hasSpace));
+        vt_str_reserve(s, vt_array_growth(s, zLen - hasSpace));
     }
 
     // shift the end of string from the specified index `at` to `at + zLen` in str
@@ -382,48 +486,53 @@ enum VitaStatus vt_str_insertf(vt_str_t *const s, const size_t at, const char *c
     // check for invalid input
     VT_DEBUG_ASSERT(vt_array_is_valid_object(s), "%s\n", vt_status_to_str(VT_STATUS_ERROR_IS_INVALID_OBJECT));
     VT_DEBUG_ASSERT(fmt != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    VT_DEBUG_ASSERT(
+        at < s->len,
+        "%s: Inserts at %zu, but vt_str_t length is %zu!\n", 
+        vt_status_to_str(VT_STATUS_ERROR_OUT_OF_BOUNDS_ACCESS), 
+        at, 
+        s->len
+    );
 
     // iterate over all arguments
     va_list args; va_start(args, fmt); 
+    va_list args2; va_copy(args2, args);
     {
-        // check format length
-        int64_t len = 0;
-        va_list args2; va_copy(args2, args); 
-        {
-            len = vsnprintf(NULL, (size_t)0, fmt, args2);
-        } 
-        va_end(args2);
-
-        // check for error
+        // print formatted string to tmp_buf, small outputs are done in one pass
+        char tmp_buf[VT_STR_TMP_BUFFER_SIZE];
+        const int32_t len = vsnprintf(tmp_buf, sizeof(tmp_buf), fmt, args);
         if (len < 0) {
             VT_DEBUG_PRINTF("%s\n", vt_status_to_str(VT_STATUS_OPERATION_FAILURE));
+            va_end(args2);
+            va_end(args);
             return VT_STATUS_OPERATION_FAILURE;
         }
 
-        // if format length is small, use stack memory
-        if (len < VT_STR_TMP_BUFFER_SIZE - 1) {
-            char tmp_buf[VT_STR_TMP_BUFFER_SIZE] = {0};
-
-            // print formatted string to tmp_buf
-            vsprintf(tmp_buf, fmt, args);
-
+        if (len < VT_STR_TMP_BUFFER_SIZE) {
             // insert tmp_buf to vt_str_t
-            vt_str_insert(s, tmp_buf, at);
+            if (len > 0) {
+                vt_str_insert_n(s, tmp_buf, at, len);
+            }
         } else {
-            // append data to a temporary vt_str_t instance
-            vt_str_t *tmp_str = vt_str_create_len(len, s->alloctr);
-            if (vt_str_vfmt_set(tmp_str, fmt, args) == NULL) {
-                VT_DEBUG_PRINTF("%s\n", vt_status_to_str(VT_STATUS_OPERATION_FAILURE));
-                return VT_STATUS_OPERATION_FAILURE;
+            // check if new memory needs to be allocated
+            const size_t hasSpace = vt_str_has_space(s);
+            if (hasSpace < (size_t)len) {
+                vt_str_reserve(s, vt_array_growth(s, len - hasSpace));
             }
 
-            // insert tmp_str
-            vt_str_insert(s, vt_str_z(tmp_str), at);
+            // open a gap of len chars at `at` and print right into it
+            char *const gap = (char*)s->ptr + at;
+            vt_memmove(gap + len, gap, s->len - at);
+            const char c = gap[len];
+            vsnprintf(gap, len + 1, fmt, args2);
+            gap[len] = c;
 
-            // free tmp_str
-            vt_str_destroy(tmp_str);
+            // update
+            s->len += len;
+            ((char*)s->ptr)[s->len] = '\0';
         }
     } 
+    va_end(args2);
     va_end(args);
 
     return VT_STATUS_OPERATION_SUCCESS;
@@ -438,7 +547,7 @@ void vt_str_insert_n(vt_str_t *const s, const char *z, const size_t at, const si
     // check if new memory needs to be allocated
     const size_t hasSpace = vt_str_has_space(s);
     if (hasSpace < n) {
-        vt_str_reserve(s, (n - hasSpace));
+        vt_str_reserve(s, vt_array_growth(s, n - hasSpace));
     }
 
     // move everyting between [at; at + n) by n
@@ -519,14 +628,14 @@ enum VitaStatus vt_str_remove_first(vt_str_t *const s, const char *z) {
     VT_DEBUG_ASSERT(z != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
 
     // find a substring in strbuf; if substring wasn't found, return
-    char* sub = strstr(s->ptr, z);
+    const size_t zLen = strlen(z);
+    char *const sub = (char*)vt_search_substr(s->ptr, s->len, z, zLen);
     if (sub == NULL) {
         return VT_STATUS_ERROR_ELEMENT_NOT_FOUND;
     }
 
     // find how many characters to copy from the end
     // it cannot be negative, since the substring will always be to the right of the begining
-    const size_t zLen = strlen(z);
     const size_t diff = (size_t)(((char*)(s->ptr) + s->len * s->elsize) - (sub + zLen * s->elsize));
 
     // shift the characters to the left of the string by the substring length
@@ -548,11 +657,7 @@ enum VitaStatus vt_str_remove_last(vt_str_t *s, const char *const z) {
 
     // find the last instance of sep
     const size_t zLen = strlen(z);
-    char *p = strstr(s->ptr, z);
-    char *lastInstance = p;
-    while ((p = strstr(p + zLen, z)) != NULL) {
-        lastInstance = p;
-    }
+    const char *const lastInstance = vt_search_substr_last(s->ptr, s->len, z, zLen);
 
     // if not found, return
     if (lastInstance == NULL) {
@@ -560,7 +665,7 @@ enum VitaStatus vt_str_remove_last(vt_str_t *s, const char *const z) {
     }
 
     // find the position of last substring instance
-    const ptrdiff_t last_instance_pos = (((char*)(s->ptr) + s->len * s->elsize) - lastInstance);
+    const ptrdiff_t last_instance_pos = lastInstance - (const char*)s->ptr;
 
     // remove the last instance
     vt_str_remove(s, last_instance_pos, zLen);
@@ -584,38 +689,26 @@ void vt_str_remove_c(vt_str_t *const s, const char *const c) {
     VT_DEBUG_ASSERT(vt_array_is_valid_object(s), "%s\n", vt_status_to_str(VT_STATUS_ERROR_IS_INVALID_OBJECT));
     VT_DEBUG_ASSERT(c != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
 
-    // prepare
-    size_t offset = 0;
-    size_t last_index = 0;
-    size_t *sLen = &s->len;
-    size_t cLen = strlen(c);
-    char *start = s->ptr;
-
     // remove all specitified characters
-    bool copy = true;
-    for (size_t i = 0; i < *sLen; i++) {
-        for (size_t j = 0; j < cLen; j++) {
-            if (start[i] == c[j]) {
-                offset++;
-
-                // do not copy characters
-                copy = false;
-                break;
-            }
-        }
-        
-        // copy data
-        if (copy) {
-            last_index = i - offset;
-            start[last_index] = start[i];
-        } else {
-            copy = true;
+    if (s->len < VT_STR_SHORT_LEN) {
+        uint64_t bits[4];
+        vt_str_bits_init(bits, c);
+
+        char *const z = s->ptr;
+        size_t n = 0;
+        for (size_t i = 0; i < s->len; i++) {
+            z[n] = z[i];
+            n += !vt_str_bits_has(bits, z[i]);
         }
+        s->len = n;
+    } else {
+        vt_ascii_set_t set;
+        vt_ascii_set_init(&set, c);
+        s->len = vt_ascii_remove(s->ptr, s->len, &set);
     }
-    
-    // update length
-    *sLen -= offset;
-    start[*sLen] = '\0';
+
+    // update end
+    ((char*)s->ptr)[s->len] = '\0';
 }
 
 void vt_str_replace(vt_str_t *const s, const char *const sub, const char *const rsub) {
@@ -623,31 +716,77 @@ void vt_str_replace(vt_str_t *const s, const char *const sub, const char *const
     VT_DEBUG_ASSERT(vt_array_is_valid_object(s), "%s\n", vt_status_to_str(VT_STATUS_ERROR_IS_INVALID_OBJECT));
     VT_DEBUG_ASSERT(sub != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
     VT_DEBUG_ASSERT(rsub != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    VT_ENFORCE(!s->is_view, "%s: Cannot modify a viewable-only object!\n", vt_status_to_str(VT_STATUS_ERROR_IS_VIEW));
 
     // check length and do nothing if empty
     const size_t subLen = strlen(sub);
     const size_t rsubLen = strlen(rsub);
     if (!subLen || !rsubLen) return;
 
-    // find number of instances to be replaced
-    const char *ptr = vt_str_z(s);
-    while ((ptr = strstr(ptr, sub)) != NULL) {
-        const ptrdiff_t at_idx = ptr - vt_str_z(s);
+    // prepare
+    char *const z = s->ptr;
+    const size_t zLen = vt_str_len(s);
+    const char *const end = z + zLen;
 
-        // replace
-        if (subLen == rsubLen) {
-            vt_memcopy((char*)ptr, rsub, rsubLen);
-        } else {
-            vt_str_remove(s, at_idx, subLen);
-            if (at_idx < (ptrdiff_t)vt_str_len(s)) vt_str_insert(s, rsub, at_idx);
-            else vt_str_append(s, rsub);
+    // same length: overwrite every instance in place
+    if (subLen == rsubLen) {
+        for (char *p = z; (p = (char*)vt_search_substr(p, (size_t)(end - p), sub, subLen)) != NULL; p += subLen) {
+            vt_memcopy(p, rsub, rsubLen);
         }
+        return;
+    }
 
-        // adjust the pointer:
-        // since `s` can be resized during iteration, we cannot use `rsubLen`
-        // and must use `vt_str_z(s)` to account for this
-        ptr = vt_str_z(s) + at_idx + rsubLen;
+    // count instances to find the final length
+    size_t count = 0;
+    for (const char *p = z; (p = vt_search_substr(p, (size_t)(end - p), sub, subLen)) != NULL; p += subLen) {
+        count++;
     }
+    if (!count) return;
+
+    // shorter replacement: the result never overtakes the unread data, so build it in place;
+    // longer replacement: build it in a new buffer of the final size
+    const size_t newLen = (rsubLen < subLen) ? zLen - count * (subLen - rsubLen) : zLen + count * (rsubLen - subLen);
+    const size_t newCapacity = (newLen > s->capacity) ? newLen : s->capacity;
+    char sso[VT_STR_SSO_CAPACITY + 1];
+    char *const buf = (rsubLen < subLen) 
+        ? z 
+        : (newCapacity <= VT_STR_SSO_CAPACITY) 
+            ? sso 
+            : s->alloctr ? VT_ALLOCATOR_ALLOC(s->alloctr, (newCapacity + 1) * sizeof(char)) : VT_CALLOC((newCapacity + 1) * sizeof(char));
+
+    // copy the data between instances and the replacements in one forward pass
+    char *w = buf;
+    const char *r = z;
+    VT_FOREACH(i, 0, count) {
+        const char *const p = vt_search_substr(r, (size_t)(end - r), sub, subLen);
+        vt_memmove(w, r, (size_t)(p - r));
+        w += p - r;
+        vt_memcopy(w, rsub, rsubLen);
+        w += rsubLen;
+        r = p + subLen;
+    }
+    vt_memmove(w, r, (size_t)(end - r));
+
+    // switch to the new buffer (short results go to the inline storage)
+    if (buf != z) {
+        char *const ptr = (buf == sso) ? vt_str_sso_buffer(s) : buf;
+        if (buf == sso) {
+            vt_memcopy(ptr, sso, newLen);
+        }
+        if (z != ptr && z != vt_str_sso_buffer(s)) {
+            if (s->alloctr) {
+                VT_ALLOCATOR_FREE(s->alloctr, z);
+            } else {
+                VT_FREE(z);
+            }
+        }
+        s->ptr = ptr;
+        s->capacity = newCapacity;
+    }
+
+    // update length
+    s->len = newLen;
+    ((char*)s->ptr)[s->len] = '\0';
 }
 
 void vt_str_replace_first(vt_str_t *const s, const char *const sub, const char *const rsub) {
@@ -689,11 +828,7 @@ void vt_str_replace_last(vt_str_t *const s, const char *const sub, const char *c
     if (!subLen || !rsubLen) return;
 
     // find the last instance of sep
-    const char *ptr = strstr(s->ptr, sub);
-    const char *lastInstance = ptr;
-    while ((ptr = strstr(ptr + subLen, sub))) {
-        lastInstance = ptr;
-    }
+    const char *const lastInstance = vt_search_substr_last(s->ptr, s->len, sub, subLen);
 
     // find number of instances to be replaced
     if (lastInstance) {
@@ -724,83 +859,46 @@ void vt_str_replace_c(vt_str_t *const s, const char *const c, const char *const
     // do nothing if empty
     if (!rLen || !cLen) return;
 
-    // iterate over the string
-    char *const ptr = s->ptr;
-    const size_t sLen = vt_str_len(s);
-    VT_FOREACH(i, 0, sLen) {
-        VT_FOREACH(j, 0, cLen) {
-            if (ptr[i] == c[j]) {
-                ptr[i] = j < rLen ? r[j] : r[rLen - 1];
-                break;
+    // map characters to their replacements, the first occurrence in `c` takes precedence
+    char map[256];
+    for (size_t j = cLen; j-- > 0;) {
+        map[(uint8_t)c[j]] = j < rLen ? r[j] : r[rLen - 1];
+    }
+
+    // short strings: replace one character at a time
+    if (s->len < VT_STR_SHORT_LEN) {
+        uint64_t bits[4];
+        vt_str_bits_init(bits, c);
+
+        char *const z = s->ptr;
+        for (size_t i = 0; i < s->len; i++) {
+            if (vt_str_bits_has(bits, z[i])) {
+                z[i] = map[(uint8_t)z[i]];
             }
         }
+        return;
     }
+
+    // replace
+    vt_ascii_set_t set;
+    vt_ascii_set_init(&set, c);
+    vt_ascii_replace(s->ptr, s->len, &set, map);
 }
 
 void vt_str_strip(vt_str_t *const s) {
     // check for invalid input
     VT_DEBUG_ASSERT(vt_array_is_valid_object(s), "%s\n", vt_status_to_str(VT_STATUS_ERROR_IS_INVALID_OBJECT));
 
-    // prepare
-    size_t offset = 0;
-    size_t *len = &s->len;
-    const char *p = s->ptr;
-    const char *curr = p + offset;
-
-    // strip leading whitespace and control symbols
-    while (isspace(*curr)) {
-        offset++;
-        curr = p + offset;
-    }
-
-    // update length
-    *len -= offset;
-
-    // strip tailing whitespace and control symbols
-    curr = p + (*len + offset - 1);
-    while (isspace(*curr)) {
-        (*len)--;
-        curr = p + (*len + offset - 1);
-    }
-
-    // move string to the begining
-    vt_memmove(s->ptr, (char*)(s->ptr) + offset, *len);
-
-    // update end
-    ((char*)(s->ptr))[*len] = '\0';
+    // strip leading and tailing whitespace and control symbols
+    vt_str_strip_set(s, vt_ascii_set_space());
 }
 
 void vt_str_strip_punct(vt_str_t *const s) {
     // check for invalid input
     VT_DEBUG_ASSERT(vt_array_is_valid_object(s), "%s\n", vt_status_to_str(VT_STATUS_ERROR_IS_INVALID_OBJECT));
 
-    // prepare
-    size_t offset = 0;
-    size_t *len = &s->len;
-    const char *p = s->ptr;
-    const char *curr = p + offset;
-
-    // strip leading whitespace and control symbols
-    while (isspace(*curr) || ispunct(*curr)) {
-        offset++;
-        curr = p + offset;
-    }
-
-    // update length
-    *len -= offset;
-
-    // strip tailing whitespace and control symbols
-    curr = p + (*len + offset - 1);
-    while (isspace(*curr) || ispunct(*curr)) {
-        (*len)--;
-        curr = p + (*len + offset - 1);
-    }
-
-    // move string to the begining
-    vt_memmove(s->ptr, (char*)(s->ptr) + offset, *len);
-
-    // update end
-    ((char*)(s->ptr))[*len] = '\0';
+    // strip leading and tailing punctuation marks, whitespace and control symbols
+    vt_str_strip_set(s, vt_ascii_set_space_punct());
 }
 
 void vt_str_strip_c(vt_str_t *const s, const char *const c) {
@@ -808,67 +906,28 @@ void vt_str_strip_c(vt_str_t *const s, const char *const c) {
     VT_DEBUG_ASSERT(vt_array_is_valid_object(s), "%s\n", vt_status_to_str(VT_STATUS_ERROR_IS_INVALID_OBJECT));
     VT_DEBUG_ASSERT(c != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
 
-    // prepare
-    bool stop = false;
-    size_t offset = 0;
-    size_t cLen = strlen(c);
-    size_t *len = &s->len;
-    const char *p = s->ptr;
-    const char *curr = p + offset;
-
-    // strip leading whitespace and control symbols
-    while (!stop) {
-        for (size_t i = 0; i < cLen; i++) {
-            if (*curr == c[i]) {
-                offset++;
-                curr = p + offset;
-
-                // continue looping
-                stop = false;
-
-                break;
-            }
-
-            stop = true;
-        }
-    }
-
-    // update length
-    *len -= offset;
-
-    // strip tailing whitespace and control symbols
-    stop = false;
-    curr = p + (*len + offset - 1);
-    while (!stop) {
-        for (size_t i = 0; i < cLen; i++) {
-            if (*curr == c[i]) {
-                (*len)--;
-                curr = p + (*len + offset - 1);
-
-                // continue looping
-                stop = false;
-
-                break;
-            }
-
-            stop = true;
-        }
+    // strip leading and tailing characters in `c`
+    if (s->len < VT_STR_SHORT_LEN) {
+        vt_ascii_set_t set;
+        vt_str_bits_init(set.bits, c);
+        vt_str_strip_set(s, &set);
+    } else {
+        vt_ascii_set_t set;
+        vt_ascii_set_init(&set, c);
+        vt_str_strip_set(s, &set);
     }
-
-    // move string to the begining
-    vt_memmove(s->ptr, (char*)(s->ptr) + offset, *len);
-
-    // update end
-    ((char*)(s->ptr))[*len] = '\0';
 }
 
 const char *vt_str_find(const vt_str_t *const s, const char *sub) {
     // check for invalid input
     VT_DEBUG_ASSERT(vt_array_is_valid_object(s), "%s\n", vt_status_to_str(VT_STATUS_ERROR_IS_INVALID_OBJECT));
     VT_DEBUG_ASSERT(sub != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
-    VT_ENFORCE(strlen(sub) <= vt_str_len(s), "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
 
-    return strstr(vt_str_z(s), sub);
+    // substring (needle) cannot be longer than z (haystack)
+    const size_t subLen = strlen(sub);
+    VT_ENFORCE(subLen <= vt_str_len(s), "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    return vt_search_substr(vt_str_z(s), vt_str_len(s), sub, subLen);
 }
 
 size_t vt_str_can_find(const vt_str_t *const s, const char *sub) {
@@ -882,7 +941,8 @@ size_t vt_str_can_find(const vt_str_t *const s, const char *sub) {
 
     size_t count = 0;
     const char *p = vt_str_z(s);
-    while ((p = strstr(p, sub)) != NULL) {
+    const char *const end = p + vt_str_len(s);
+    while ((p = vt_search_substr(p, (size_t)(end - p), sub, subLen)) != NULL) {
         count++;
         p += subLen;
     }
@@ -919,35 +979,16 @@ vt_plist_t *vt_str_split(vt_plist_t *ps, const vt_str_t *const s, const char *co
     // clear
     vt_plist_clear(p);
 
-    // splitting the raw C string
-    const size_t sepLen = strlen(sep);
-    const char *head = s->ptr;
-    const char *current = head;
-    while (true) {
-        // find sep
-        current = strstr(head, sep);
-
-        // count copy length
-        const size_t copyLen = strlen(head) - (current == NULL ? 0 : strlen(current));
-        if (copyLen == 0) { // if head == current, move head by sepLen (if sep is in the begining)
-            head += sepLen;
-            continue;
-        } else {
-            // create a vt_str_t instance and copy the values
-            vt_str_t *tempStr = vt_str_create_len(copyLen, p->alloctr ? p->alloctr : NULL);
-
-            // set the value and push it to the list
-            vt_str_set_n(tempStr, head, copyLen);
-            vt_plist_push_back(p, tempStr);
-            
-            // update head
-            head = current + sepLen;
-        }
+    // split into tokens
+    vt_strview_t token;
+    vt_strview_split_iter_t it = vt_strview_split_iter(vt_strview_from_str(s), sep);
+    while (vt_strview_split_next(&it, &token)) {
+        // create a vt_str_t instance and copy the values
+        vt_str_t *tempStr = vt_str_create_len(token.len, p->alloctr ? p->alloctr : NULL);
 
-        // break from loop when no more sep is found or we are at the end of string
-        if (current == NULL || current[sepLen] == '\0') {
-            break;
-        }
+        // set the value and push it to the list
+        vt_str_set_n(tempStr, token.ptr, token.len);
+        vt_plist_push_back(p, tempStr);
     }
 
     return p;
@@ -960,13 +1001,15 @@ vt_str_t *vt_str_split_between(vt_str_t *const s, const char *const z, const cha
     VT_DEBUG_ASSERT(zr != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
 
     // find zl - left substring
-    const char *const lsub = strstr(z, zl);
+    const size_t zLen = strlen(z);
+    const size_t zlLen = strlen(zl);
+    const char *const lsub = vt_search_substr(z, zLen, zl, zlLen);
     if (lsub == NULL) {
         return NULL;
     }
 
     // find r - right substring
-    const char *const rsub = strstr(z, zr);
+    const char *const rsub = vt_search_substr(z, zLen, zr, strlen(zr));
     if (rsub == NULL) {
         return NULL;
     }
@@ -979,7 +1022,7 @@ vt_str_t *vt_str_split_between(vt_str_t *const s, const char *const z, const cha
 
     // check if lsub < rsub
     if (lsub < rsub) {
-        ptrdiff_t sub_len = rsub - lsub - strlen(zl);
+        ptrdiff_t sub_len = rsub - lsub - zlLen;
         vt_str_resize(st, sub_len);
 
         // append sub
@@ -1058,13 +1101,13 @@ vt_str_t *vt_str_pop_get_first(vt_str_t *sr, vt_str_t *const s, const char *cons
     }
 
     // check if s contains sep substring
-    const char *const tempStr = strstr(s->ptr, sep);
+    const char *const tempStr = vt_search_substr(s->ptr, s->len, sep, sepLen);
     if (tempStr == NULL) {
         return sr;
     }
 
     // if the copy length of the substring is zero, there is nothing to copy
-    const size_t copyLen = vt_str_len(s) - strlen(tempStr);
+    const size_t copyLen = (size_t)(tempStr - (const char*)s->ptr);
     if (!copyLen) {
         return sr;
     }
@@ -1102,18 +1145,8 @@ vt_str_t *vt_str_pop_get_last(vt_str_t *sr, vt_str_t *const s, const char *const
         return sr;
     }
 
-    // check if s contains sep substring
-    const char *const tempStr = strstr(s->ptr, sep);
-    if (tempStr == NULL) {
-        return sr;
-    }
-
     // find the last instance of sep
-    const char *p = strstr(s->ptr, sep);
-    const char *lastInstance = p;
-    while ((p = strstr(p + sepLen, sep)) != NULL) {
-        lastInstance = p;
-    }
+    const char *const lastInstance = vt_search_substr_last(s->ptr, s->len, sep, sepLen);
 
     // if not found, return
     if (lastInstance == NULL) {
@@ -1121,7 +1154,7 @@ vt_str_t *vt_str_pop_get_last(vt_str_t *sr, vt_str_t *const s, const char *const
     }
 
     // if the copy length of the substring is zero, there is nothing to copy
-    const size_t copyLen = strlen(lastInstance) - sepLen;
+    const size_t copyLen = vt_str_len(s) - (size_t)(lastInstance - (const char*)s->ptr) - sepLen;
     if (!copyLen) {
         return sr;
     }
@@ -1259,11 +1292,7 @@ void vt_str_to_uppercase(vt_str_t *const s) {
     VT_DEBUG_ASSERT(vt_array_is_valid_object(s), "%s\n", vt_status_to_str(VT_STATUS_ERROR_IS_INVALID_OBJECT));
 
     // to uppercase
-    char *const z = s->ptr;
-    const size_t zLen = vt_str_len(s);
-    for (size_t i = 0; i < zLen; i++) {
-        z[i] = toupper(z[i]);
-    }
+    vt_ascii_to_upper(s->ptr, vt_str_len(s));
 }
 
 void vt_str_to_lowercase(vt_str_t *const s) {
@@ -1271,18 +1300,15 @@ void vt_str_to_lowercase(vt_str_t *const s) {
     VT_DEBUG_ASSERT(vt_array_is_valid_object(s), "%s\n", vt_status_to_str(VT_STATUS_ERROR_IS_INVALID_OBJECT));
 
     // to lowercase
-    char *const z = s->ptr;
-    const size_t zLen = vt_str_len(s);
-    for (size_t i = 0; i < zLen; i++) {
-        z[i] = tolower(z[i]);
-    }
+    vt_ascii_to_lower(s->ptr, vt_str_len(s));
 }
 
 int64_t vt_str_index_of(const vt_str_t *const s, const char z) {
     // check for invalid input
     VT_DEBUG_ASSERT(vt_array_is_valid_object(s), "%s\n", vt_status_to_str(VT_STATUS_ERROR_IS_INVALID_OBJECT));
 
-    const char *const ztmp = strchr(vt_str_z(s), z);
+    // include the '\0' terminator in the search, like strchr
+    const char *const ztmp = memchr(vt_str_z(s), z, vt_str_len(s) + 1);
     if (ztmp == NULL) {
         return -1;
     }
@@ -1327,87 +1353,194 @@ void vt_str_slide_reset(vt_str_t *const s) {
 
 // -------------------------- PRIVATE -------------------------- //
 
-/** Sets a formatted string into a vt_str_t
+/** Appends a formatted string into a vt_str_t
     @param s vt_str_t instance
     @param fmt string print format
     @param args variable args list
 
     @returns `vt_str_t` instance upon success, NULL upon failure
+
+    @note formats straight into the spare capacity; formats once more only if the output did not fit
 */
-static vt_str_t *vt_str_vfmt_set(vt_str_t *s, const char *const fmt, va_list args) {
+static vt_str_t *vt_str_vfmt_append(vt_str_t *s, const char *const fmt, va_list args) {
     // check for invalid input
     VT_DEBUG_ASSERT(vt_array_is_valid_object(s), "%s\n", vt_status_to_str(VT_STATUS_ERROR_IS_INVALID_OBJECT));
     VT_DEBUG_ASSERT(fmt != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    VT_ENFORCE(!s->is_view, "%s: Cannot modify a viewable-only object!\n", vt_status_to_str(VT_STATUS_ERROR_IS_VIEW));
 
-    // format string
-    va_list args2; va_copy(args2, args); 
-    {
-        // check format length
-        const int64_t len = vsnprintf(NULL, (size_t)0, fmt, args) + 1;
-        if (len < 0) {
-            VT_DEBUG_PRINTF("%s\n", vt_status_to_str(VT_STATUS_OPERATION_FAILURE));
-            va_end(args2);
-            return NULL;
-        }
-
-        // check for space
-        const size_t hasSpace = vt_str_has_space(s);
-        if (hasSpace < (size_t)len) {
-            vt_str_reserve(s, (len - hasSpace));
-        }
-
-        // print data to s
-        // vsprintf((char*)s->ptr + s->len * s->elsize, fmt, args2); // TODO: remove
-        vsnprintf(s->ptr, len+1, fmt, args2);
-
-        // update
-        s->len = len;
+    // print data to s, the '\0' terminator slot is available too
+    va_list args2; va_copy(args2, args);
+    const size_t hasSpace = vt_str_has_space(s);
+    const int32_t len = vsnprintf((char*)s->ptr + s->len, hasSpace + 1, fmt, args);
+    if (len < 0) {
+        VT_DEBUG_PRINTF("%s\n", vt_status_to_str(VT_STATUS_OPERATION_FAILURE));
         ((char*)s->ptr)[s->len] = '\0';
+        va_end(args2);
+        return NULL;
+    }
+
+    // the output was truncated: grow and print again
+    if ((size_t)len > hasSpace) {
+        vt_str_reserve(s, vt_array_growth(s, len - hasSpace));
+        vsnprintf((char*)s->ptr + s->len, len + 1, fmt, args2);
     }
     va_end(args2);
 
+    // update
+    s->len += len;
+
     return s;
 }
 
-/** Appends a formatted string into a vt_str_t
-    @param s vt_str_t instance
-    @param fmt string print format
-    @param args variable args list
+/** Writes decimal digits of an unsigned integer backwards
+    @param end pointer past the last digit
+    @param v value
 
-    @returns `vt_str_t` instance upon success, NULL upon failure
+    @returns number of digits written
 */
-static vt_str_t *vt_str_vfmt_append(vt_str_t *s, const char *const fmt, va_list args) {
-    // check for invalid input
-    VT_DEBUG_ASSERT(vt_array_is_valid_object(s), "%s\n", vt_status_to_str(VT_STATUS_ERROR_IS_INVALID_OBJECT));
-    VT_DEBUG_ASSERT(fmt != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+static size_t vt_str_fmt_u64(char *const end, uint64_t v) {
+    // pairs of digits "00" to "99"
+    static const char lut[] = 
+        "0001020304050607080910111213141516171819"
+        "2021222324252627282930313233343536373839"
+        "4041424344454647484950515253545556575859"
+        "6061626364656667686970717273747576777879"
+        "8081828384858687888990919293949596979899";
+
+    char *p = end;
+    while (v >= 100) {
+        const size_t i = (size_t)(v % 100) * 2;
+        v /= 100;
+        *--p = lut[i + 1];
+        *--p = lut[i];
+    }
+    if (v >= 10) {
+        *--p = lut[v * 2 + 1];
+        *--p = lut[v * 2];
+    } else {
+        *--p = (char)('0' + v);
+    }
 
-    // format string
-    va_list args2; va_copy(args2, args); 
-    {
-        // check format length
-        const int64_t len = vsnprintf(NULL, (size_t)0, fmt, args);
-        if (len < 0) {
-            VT_DEBUG_PRINTF("%s\n", vt_status_to_str(VT_STATUS_OPERATION_FAILURE));
-            va_end(args2);
-            return NULL;
-        }
+    return (size_t)(end - p);
+}
 
-        // check for space
-        const size_t hasSpace = vt_str_has_space(s);
-        if (hasSpace < (size_t)len) {
-            vt_str_reserve(s, (len - hasSpace));
+/** Strips leading and tailing characters of a set
+    @param s vt_str_t instance
+    @param set vt_ascii_set_t instance
+*/
+static void vt_str_strip_set(vt_str_t *const s, const vt_ascii_set_t *const set) {
+    // count characters to strip
+    size_t lead = 0, trail = 0;
+    if (s->len < VT_STR_SHORT_LEN) {
+        const char *const z = s->ptr;
+        while (lead < s->len && vt_str_bits_has(set->bits, z[lead])) {
+            lead++;
         }
+        while (trail < s->len - lead && vt_str_bits_has(set->bits, z[s->len - trail - 1])) {
+            trail++;
+        }
+    } else {
+        lead = vt_ascii_span(s->ptr, s->len, set);
+        trail = vt_ascii_span_last((char*)s->ptr + lead, s->len - lead, set);
+    }
 
-        // print data to s
-        // vsprintf((char*)s->ptr + s->len * s->elsize, fmt, args2); // TODO: remove
-        vsnprintf((char*)s->ptr + s->len * s->elsize, len+1, fmt, args2);
+    vt_str_strip_n(s, lead, trail);
+}
 
-        // update
-        s->len += len;
-        ((char*)s->ptr)[s->len] = '\0';
-    } 
-    va_end(args2);
+/** Strips a number of leading and tailing characters
+    @param s vt_str_t instance
+    @param lead number of leading characters
+    @param trail number of tailing characters
+*/
+static void vt_str_strip_n(vt_str_t *const s, const size_t lead, const size_t trail) {
+    // move string to the begining
+    s->len -= lead + trail;
+    if (lead) {
+        vt_memmove(s->ptr, (char*)s->ptr + lead, s->len);
+    }
+
+    // update end
+    ((char*)s->ptr)[s->len] = '\0';
+}
+
+/** Marks the characters of a string in a 256-bit set, like vt_ascii_set_init without ranges
+    @param bits 4 words
+    @param c zero-terminated string of set members
+*/
+static void vt_str_bits_init(uint64_t *const bits, const char *const c) {
+    bits[0] = bits[1] = bits[2] = bits[3] = 0;
+    for (const char *p = c; *p; p++) {
+        const uint8_t u = (uint8_t)*p;
+        bits[u >> 6] |= 1ULL << (u & 63);
+    }
+}
+
+/** Checks if a character belongs to a 256-bit set, same as vt_ascii_set_has, but can be inlined
+    @param bits 4 words
+    @param c character
+    @returns `true` if it does
+*/
+static bool vt_str_bits_has(const uint64_t *const bits, const char c) {
+    const uint8_t u = (uint8_t)c;
+    return (bits[u >> 6] >> (u & 63)) & 1;
+}
+
+/** Allocates a vt_str_t struct followed by inline storage for short strings
+    @param alloctr allocator instance
+    @returns `vt_str_t*`
+
+    @note if `NULL` is specified, then vita calloc/realloc/free is used
+*/
+static vt_str_t *vt_str_new(struct VitaBaseAllocatorType *const alloctr) {
+    // the struct is freed by vt_array_free, which does not depend on the size
+    const size_t bytes = sizeof(vt_str_t) + (VT_STR_SSO_CAPACITY + 1) * sizeof(char);
+    vt_str_t *s = (vt_str_t*)(alloctr 
+        ? VT_ALLOCATOR_ALLOC(alloctr, bytes) 
+        : VT_CALLOC(bytes)
+    );
+    s->alloctr = alloctr;
 
     return s;
 }
 
+/** Returns inline storage of a vt_str_t
+    @param s vt_str_t instance
+    @returns pointer to VT_STR_SSO_CAPACITY + 1 chars after the struct
+*/
+static char *vt_str_sso_buffer(const vt_str_t *const s) {
+    return (char*)s + sizeof(vt_str_t);
+}
+
+/** Resizes string memory to (n + 1) chars, moving data between inline storage and the heap when needed
+    @param s vt_str_t instance
+    @param n new capacity
+
+    @note does not update the capacity
+*/
+static void vt_str_realloc(vt_str_t *const s, const size_t n) {
+    char *const sso = vt_str_sso_buffer(s);
+    const size_t bytes = (n + 1) * s->elsize;
+    const size_t bytes_old = (s->capacity + 1) * s->elsize;
+    if (s->ptr == sso) {
+        // promote to the heap
+        if (n > VT_STR_SSO_CAPACITY) {
+            char *const ptr = s->alloctr ? VT_ALLOCATOR_ALLOC(s->alloctr, bytes) : VT_CALLOC(bytes);
+            vt_memcopy(ptr, sso, bytes_old);
+            s->ptr = ptr;
+        }
+    } else if (n <= VT_STR_SSO_CAPACITY) {
+        // move back inline
+        vt_memcopy(sso, s->ptr, bytes < bytes_old ? bytes : bytes_old);
+        if (s->alloctr) {
+            VT_ALLOCATOR_FREE(s->alloctr, s->ptr);
+        } else {
+            VT_FREE(s->ptr);
+        }
+        s->ptr = sso;
+    } else if (!s->alloctr || bytes < bytes_old || !VT_ALLOCATOR_EXPAND(s->alloctr, s->ptr, bytes)) {
+        s->ptr = s->alloctr 
+            ? VT_ALLOCATOR_REALLOC(s->alloctr, s->ptr, bytes) 
+            : VT_REALLOC(s->ptr, bytes);
+    }
+}
+
@@ -0,0 +1,409 @@
+#include "vita/container/strbuilder.h"
+
+static struct VitaStrBuilderChunk *vt_strbuilder_chunk_new(vt_strbuilder_t *const sb, const size_t capacity);
+static void vt_strbuilder_chunk_free(vt_strbuilder_t *const sb, struct VitaStrBuilderChunk *const c);
+static size_t vt_strbuilder_chunk_size(const struct VitaStrBuilderChunk *const c);
+static void vt_strbuilder_chunk_update(struct VitaStrBuilderChunk *const c);
+static struct VitaStrBuilderChunk *vt_strbuilder_merge(struct VitaStrBuilderChunk *const a, struct VitaStrBuilderChunk *const b);
+static void vt_strbuilder_split(vt_strbuilder_t *const sb, struct VitaStrBuilderChunk *const c, const size_t pos, struct VitaStrBuilderChunk **const l, struct VitaStrBuilderChunk **const r);
+static void vt_strbuilder_flush_tail(vt_strbuilder_t *const sb);
+static void vt_strbuilder_apply_chunk(const struct VitaStrBuilderChunk *const c, void (*func)(const char*, size_t, void*), void *const user);
+static void vt_strbuilder_write_chunk(const char *const data, const size_t len, void *const user);
+static void vt_strbuilder_append_chunk(const char *const data, const size_t len, void *const user);
+
+vt_strbuilder_t *vt_strbuilder_create(struct VitaBaseAllocatorType *const alloctr) {
+    // allocate a new vt_strbuilder_t instance
+    vt_strbuilder_t *sb = alloctr
+        ? VT_ALLOCATOR_ALLOC(alloctr, sizeof(vt_strbuilder_t))
+        : VT_CALLOC(sizeof(vt_strbuilder_t));
+    *sb = (vt_strbuilder_t) {
+        .alloctr = alloctr,
+        .seed = 0x9E3779B9u,
+    };
+
+    return sb;
+}
+
+void vt_strbuilder_destroy(vt_strbuilder_t *sb) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(sb != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    // free chunks
+    vt_strbuilder_clear(sb);
+
+    // free vt_strbuilder_t instance itself
+    if (sb->alloctr) {
+        VT_ALLOCATOR_FREE(sb->alloctr, sb);
+    } else {
+        VT_FREE(sb);
+    }
+    sb = NULL;
+}
+
+size_t vt_strbuilder_len(const vt_strbuilder_t *const sb) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(sb != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    return vt_strbuilder_chunk_size(sb->root) + (sb->tail ? sb->tail->len : 0);
+}
+
+size_t vt_strbuilder_count_chunks(const vt_strbuilder_t *const sb) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(sb != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    return sb->count_chunks;
+}
+
+void vt_strbuilder_clear(vt_strbuilder_t *const sb) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(sb != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    vt_strbuilder_chunk_free(sb, sb->root);
+    vt_strbuilder_chunk_free(sb, sb->tail);
+    sb->root = sb->tail = NULL;
+}
+
+void vt_strbuilder_append(vt_strbuilder_t *const sb, const char *const z) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(z != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    vt_strbuilder_append_n(sb, z, strlen(z));
+}
+
+void vt_strbuilder_append_n(vt_strbuilder_t *const sb, const char *const z, const size_t n) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(sb != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    VT_DEBUG_ASSERT(z != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    size_t copied = 0;
+    while (copied < n) {
+        // start a new chunk when the tail is full, large pieces get a chunk of their own
+        if (sb->tail == NULL || sb->tail->len == sb->tail->capacity) {
+            vt_strbuilder_flush_tail(sb);
+            sb->tail = vt_strbuilder_chunk_new(sb, (n - copied > VT_STRBUILDER_CHUNK_SIZE) ? n - copied : VT_STRBUILDER_CHUNK_SIZE);
+        }
+
+        // fill the tail
+        struct VitaStrBuilderChunk *const tail = sb->tail;
+        const size_t count = (n - copied < tail->capacity - tail->len) ? n - copied : tail->capacity - tail->len;
+        vt_memcopy(tail->data + tail->len, z + copied, count);
+        tail->len += count;
+        copied += count;
+    }
+}
+
+enum VitaStatus vt_strbuilder_appendf(vt_strbuilder_t *const sb, const char *const fmt, ...) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(sb != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    VT_DEBUG_ASSERT(fmt != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    // format straight into the tail
+    const size_t space = sb->tail ? sb->tail->capacity - sb->tail->len : 0;
+    va_list args;
+    va_start(args, fmt);
+    const int32_t len = vsnprintf(space ? sb->tail->data + sb->tail->len : NULL, space, fmt, args);
+    va_end(args);
+    if (len < 0) {
+        VT_DEBUG_PRINTF("%s\n", vt_status_to_str(VT_STATUS_OPERATION_FAILURE));
+        return VT_STATUS_OPERATION_FAILURE;
+    } else if ((size_t)len < space) {
+        sb->tail->len += len;
+        return VT_STATUS_OPERATION_SUCCESS;
+    }
+
+    // did not fit: start a new tail large enough for the text and the '\0' written by vsnprintf
+    vt_strbuilder_flush_tail(sb);
+    sb->tail = vt_strbuilder_chunk_new(sb, ((size_t)len + 1 > VT_STRBUILDER_CHUNK_SIZE) ? (size_t)len + 1 : VT_STRBUILDER_CHUNK_SIZE);
+    va_start(args, fmt);
+    vsnprintf(sb->tail->data, sb->tail->capacity, fmt, args);
+    va_end(args);
+    sb->tail->len = len;
+
+    return VT_STATUS_OPERATION_SUCCESS;
+}
+
+void vt_strbuilder_insert(vt_strbuilder_t *const sb, const char *const z, const size_t at) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(z != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    vt_strbuilder_insert_n(sb, z, at, strlen(z));
+}
+
+void vt_strbuilder_insert_n(vt_strbuilder_t *const sb, const char *const z, const size_t at, const size_t n) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(sb != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    VT_DEBUG_ASSERT(z != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    VT_DEBUG_ASSERT(
+        at <= vt_strbuilder_len(sb),
+        "%s: Inserting at %zu, but length is %zu!\n",
+        vt_status_to_str(VT_STATUS_ERROR_OUT_OF_BOUNDS_ACCESS),
+        at,
+        vt_strbuilder_len(sb)
+    );
+
+    // nothing to insert
+    if (n == 0) {
+        return;
+    }
+
+    // insertion into the tail: shift within the chunk if it has space
+    const size_t rootLen = vt_strbuilder_chunk_size(sb->root);
+    if (at >= rootLen) {
+        struct VitaStrBuilderChunk *const tail = sb->tail;
+        if (tail == NULL || at == rootLen + tail->len) {
+            vt_strbuilder_append_n(sb, z, n);
+            return;
+        } else if (tail->capacity - tail->len >= n) {
+            const size_t offset = at - rootLen;
+            vt_memmove(tail->data + offset + n, tail->data + offset, tail->len - offset);
+            vt_memcopy(tail->data + offset, z, n);
+            tail->len += n;
+            return;
+        }
+        vt_strbuilder_flush_tail(sb);
+    }
+
+    // split the chunks at `at` and link a new chunk in between
+    struct VitaStrBuilderChunk *l = NULL, *r = NULL;
+    vt_strbuilder_split(sb, sb->root, at, &l, &r);
+    struct VitaStrBuilderChunk *const c = vt_strbuilder_chunk_new(sb, n);
+    vt_memcopy(c->data, z, n);
+    c->len = c->size = n;
+    sb->root = vt_strbuilder_merge(vt_strbuilder_merge(l, c), r);
+}
+
+char vt_strbuilder_get(const vt_strbuilder_t *const sb, const size_t at) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(sb != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    VT_DEBUG_ASSERT(
+        at < vt_strbuilder_len(sb),
+        "%s: Out of bounds memory access at %zu, but length is %zu!\n",
+        vt_status_to_str(VT_STATUS_ERROR_OUT_OF_BOUNDS_ACCESS),
+        at,
+        vt_strbuilder_len(sb)
+    );
+
+    // the tail
+    const size_t rootLen = vt_strbuilder_chunk_size(sb->root);
+    if (at >= rootLen) {
+        return sb->tail->data[at - rootLen];
+    }
+
+    // descend to the chunk that holds `at`
+    size_t pos = at;
+    const struct VitaStrBuilderChunk *c = sb->root;
+    while (true) {
+        const size_t leftLen = vt_strbuilder_chunk_size(c->left);
+        if (pos < leftLen) {
+            c = c->left;
+        } else if (pos < leftLen + c->len) {
+            return c->data[pos - leftLen];
+        } else {
+            pos -= leftLen + c->len;
+            c = c->right;
+        }
+    }
+}
+
+void vt_strbuilder_apply(const vt_strbuilder_t *const sb, void (*func)(const char*, size_t, void*), void *const user) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(sb != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    VT_DEBUG_ASSERT(func != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    vt_strbuilder_apply_chunk(sb->root, func, user);
+    if (sb->tail) {
+        func(sb->tail->data, sb->tail->len, user);
+    }
+}
+
+bool vt_strbuilder_write(const vt_strbuilder_t *const sb, FILE *const fp) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(fp != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    // the stream error flag tells if any chunk failed
+    vt_strbuilder_apply(sb, vt_strbuilder_write_chunk, fp);
+    return !ferror(fp);
+}
+
+vt_str_t *vt_strbuilder_to_str(const vt_strbuilder_t *const sb, struct VitaBaseAllocatorType *const alloctr) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(sb != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    // allocate the final size once and copy the chunks
+    const size_t len = vt_strbuilder_len(sb);
+    vt_str_t *s = vt_str_create_capacity(len ? len : 1, alloctr);
+    vt_strbuilder_apply(sb, vt_strbuilder_append_chunk, s);
+
+    return s;
+}
+
+/* ---------------------- PRIVATE FUNCTIONS ---------------------- */
+
+/** Allocates a chunk and counts it
+    @param sb vt_strbuilder_t instance
+    @param capacity chunk capacity in bytes
+    @returns empty chunk with a random priority
+*/
+static struct VitaStrBuilderChunk *vt_strbuilder_chunk_new(vt_strbuilder_t *const sb, const size_t capacity) {
+    const size_t bytes = sizeof(struct VitaStrBuilderChunk) + capacity;
+    struct VitaStrBuilderChunk *const c = sb->alloctr
+        ? VT_ALLOCATOR_ALLOC(sb->alloctr, bytes)
+        : VT_MALLOC(bytes);
+
+    // xorshift32
+    sb->seed ^= sb->seed << 13;
+    sb->seed ^= sb->seed >> 17;
+    sb->seed ^= sb->seed << 5;
+
+    *c = (struct VitaStrBuilderChunk) {
+        .capacity = capacity,
+        .priority = sb->seed,
+    };
+    sb->count_chunks++;
+
+    return c;
+}
+
+/** Frees a chunk and all chunks below it
+    @param sb vt_strbuilder_t instance
+    @param c chunk, may be `NULL`
+*/
+static void vt_strbuilder_chunk_free(vt_strbuilder_t *const sb, struct VitaStrBuilderChunk *const c) {
+    if (c == NULL) {
+        return;
+    }
+
+    vt_strbuilder_chunk_free(sb, c->left);
+    vt_strbuilder_chunk_free(sb, c->right);
+    if (sb->alloctr) {
+        VT_ALLOCATOR_FREE(sb->alloctr, c);
+    } else {
+        VT_FREE(c);
+    }
+    sb->count_chunks--;
+}
+
+/** Returns the total length of a subtree
+    @param c chunk, may be `NULL`
+    @returns size_t
+*/
+static size_t vt_strbuilder_chunk_size(const struct VitaStrBuilderChunk *const c) {
+    return c ? c->size : 0;
+}
+
+/** Recomputes the subtree length after its children changed
+    @param c chunk
+*/
+static void vt_strbuilder_chunk_update(struct VitaStrBuilderChunk *const c) {
+    c->size = c->len + vt_strbuilder_chunk_size(c->left) + vt_strbuilder_chunk_size(c->right);
+}
+
+/** Joins two trees, all text of `a` comes before `b`
+    @param a left tree
+    @param b right tree
+    @returns root of the joined tree
+*/
+static struct VitaStrBuilderChunk *vt_strbuilder_merge(struct VitaStrBuilderChunk *const a, struct VitaStrBuilderChunk *const b) {
+    if (a == NULL) {
+        return b;
+    } else if (b == NULL) {
+        return a;
+    }
+
+    if (a->priority >= b->priority) {
+        a->right = vt_strbuilder_merge(a->right, b);
+        vt_strbuilder_chunk_update(a);
+        return a;
+    } else {
+        b->left = vt_strbuilder_merge(a, b->left);
+        vt_strbuilder_chunk_update(b);
+        return b;
+    }
+}
+
+/** Splits a tree into the first `pos` characters and the rest, a chunk spanning `pos` is cut in two
+    @param sb vt_strbuilder_t instance
+    @param c tree root
+    @param pos split position
+    @param l tree with the first `pos` characters
+    @param r tree with the rest
+*/
+static void vt_strbuilder_split(vt_strbuilder_t *const sb, struct VitaStrBuilderChunk *const c, const size_t pos, struct VitaStrBuilderChunk **const l, struct VitaStrBuilderChunk **const r) {
+    if (c == NULL) {
+        *l = *r = NULL;
+        return;
+    }
+
+    const size_t leftLen = vt_strbuilder_chunk_size(c->left);
+    if (pos <= leftLen) {
+        vt_strbuilder_split(sb, c->left, pos, l, &c->left);
+        vt_strbuilder_chunk_update(c);
+        *r = c;
+    } else if (pos >= leftLen + c->len) {
+        vt_strbuilder_split(sb, c->right, pos - leftLen - c->len, &c->right, r);
+        vt_strbuilder_chunk_update(c);
+        *l = c;
+    } else {
+        // move the second part of the chunk into a new one with the same priority, so the heap order holds
+        const size_t offset = pos - leftLen;
+        struct VitaStrBuilderChunk *const c2 = vt_strbuilder_chunk_new(sb, c->len - offset);
+        vt_memcopy(c2->data, c->data + offset, c->len - offset);
+        c2->len = c->len - offset;
+        c2->priority = c->priority;
+        c2->right = c->right;
+        c->right = NULL;
+        c->len = offset;
+        vt_strbuilder_chunk_update(c);
+        vt_strbuilder_chunk_update(c2);
+        *l = c;
+        *r = c2;
+    }
+}
+
+/** Moves the tail into the tree
+    @param sb vt_strbuilder_t instance
+*/
+static void vt_strbuilder_flush_tail(vt_strbuilder_t *const sb) {
+    if (sb->tail == NULL) {
+        return;
+    }
+
+    vt_strbuilder_chunk_update(sb->tail);
+    sb->root = vt_strbuilder_merge(sb->root, sb->tail);
+    sb->tail = NULL;
+}
+
+/** Calls a function on every chunk of a tree in text order
+    @param c tree root
+    @param func function to call
+    @param user user data
+*/
+static void vt_strbuilder_apply_chunk(const struct VitaStrBuilderChunk *const c, void (*func)(const char*, size_t, void*), void *const user) {
+    if (c == NULL) {
+        return;
+    }
+
+    vt_strbuilder_apply_chunk(c->left, func, user);
+    func(c->data, c->len, user);
+    vt_strbuilder_apply_chunk(c->right, func, user);
+}
+
+/** Writes a chunk to a file
+    @param data chunk data
+    @param len chunk length
+    @param user FILE*
+*/
+static void vt_strbuilder_write_chunk(const char *const data, const size_t len, void *const user) {
+    fwrite(data, sizeof(char), len, (FILE*)user);
+}
+
+/** Appends a chunk to a vt_str_t
+    @param data chunk data
+    @param len chunk length
+    @param user vt_str_t*
+*/
+static void vt_strbuilder_append_chunk(const char *const data, const size_t len, void *const user) {
+    if (len) {
+        vt_str_append_n((vt_str_t*)user, data, len);
+    }
+}
@@ -0,0 +1,223 @@
+#include "vita/container/strview.h"
+
+vt_strview_t vt_strview_from(const char *const ptr, const size_t len) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(ptr != NULL || len == 0, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    return (vt_strview_t) {
+        .ptr = ptr,
+        .len = len,
+    };
+}
+
+vt_strview_t vt_strview_from_z(const char *const z) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(z != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    return vt_strview_from(z, strlen(z));
+}
+
+vt_strview_t vt_strview_from_str(const vt_str_t *const s) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(vt_array_is_valid_object(s), "%s\n", vt_status_to_str(VT_STATUS_ERROR_IS_INVALID_OBJECT));
+
+    return vt_strview_from(vt_str_z(s), vt_str_len(s));
+}
+
+size_t vt_strview_len(const vt_strview_t sv) {
+    return sv.len;
+}
+
+bool vt_strview_is_empty(const vt_strview_t sv) {
+    return sv.len == 0;
+}
+
+char vt_strview_get(const vt_strview_t sv, const size_t at) {
+    VT_DEBUG_ASSERT(
+        at < sv.len,
+        "%s: Out of bounds memory access at %zu, but length is %zu!\n", 
+        vt_status_to_str(VT_STATUS_ERROR_OUT_OF_BOUNDS_ACCESS), 
+        at, 
+        sv.len
+    );
+
+    return sv.ptr[at];
+}
+
+vt_strview_t vt_strview_slice(const vt_strview_t sv, const size_t from, const size_t to) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(from <= to, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    VT_DEBUG_ASSERT(
+        to <= sv.len,
+        "%s: Slice up to %zu, but length is %zu!\n", 
+        vt_status_to_str(VT_STATUS_ERROR_OUT_OF_BOUNDS_ACCESS), 
+        to, 
+        sv.len
+    );
+
+    return vt_strview_from(sv.ptr + from, to - from);
+}
+
+vt_strview_t vt_strview_strip(const vt_strview_t sv) {
+    size_t from = 0, to = sv.len;
+    while (from < to && isspace((unsigned char)sv.ptr[from])) {
+        from++;
+    }
+    while (to > from && isspace((unsigned char)sv.ptr[to - 1])) {
+        to--;
+    }
+
+    return vt_strview_from(sv.ptr + from, to - from);
+}
+
+const char *vt_strview_find(const vt_strview_t sv, const char *const sub) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(sub != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    return sv.len ? vt_search_substr(sv.ptr, sv.len, sub, strlen(sub)) : NULL;
+}
+
+const char *vt_strview_find_last(const vt_strview_t sv, const char *const sub) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(sub != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    return sv.len ? vt_search_substr_last(sv.ptr, sv.len, sub, strlen(sub)) : NULL;
+}
+
+size_t vt_strview_can_find(const vt_strview_t sv, const char *const sub) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(sub != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    // an empty substring is not counted
+    const size_t subLen = strlen(sub);
+    if (!subLen || !sv.len) {
+        return 0;
+    }
+
+    size_t count = 0;
+    const char *p = sv.ptr;
+    const char *const end = sv.ptr + sv.len;
+    while ((p = vt_search_substr(p, (size_t)(end - p), sub, subLen)) != NULL) {
+        count++;
+        p += subLen;
+    }
+
+    return count;
+}
+
+int64_t vt_strview_index_of(const vt_strview_t sv, const char c) {
+    const char *const p = sv.len ? memchr(sv.ptr, c, sv.len) : NULL;
+    return p ? (int64_t)(p - sv.ptr) : -1;
+}
+
+int64_t vt_strview_index_find(const vt_strview_t sv, const char *const sub) {
+    const char *const p = vt_strview_find(sv, sub);
+    return p ? (int64_t)(p - sv.ptr) : -1;
+}
+
+bool vt_strview_equals(const vt_strview_t sv1, const vt_strview_t sv2) {
+    return sv1.len == sv2.len && (!sv1.len || !memcmp(sv1.ptr, sv2.ptr, sv1.len));
+}
+
+bool vt_strview_equals_z(const vt_strview_t sv, const char *const z) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(z != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    return vt_strview_equals(sv, vt_strview_from_z(z));
+}
+
+bool vt_strview_starts_with(const vt_strview_t sv, const char *const sub) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(sub != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    const size_t subLen = strlen(sub);
+    if (subLen > sv.len) {
+        return false;
+    }
+
+    return !memcmp(sv.ptr, sub, subLen);
+}
+
+bool vt_strview_ends_with(const vt_strview_t sv, const char *const sub) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(sub != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    const size_t subLen = strlen(sub);
+    if (subLen > sv.len) {
+        return false;
+    }
+
+    return !memcmp(sv.ptr + sv.len - subLen, sub, subLen);
+}
+
+bool vt_strview_is_numeric(const vt_strview_t sv) {
+    return sv.len && vt_str_is_numeric_z(sv.ptr, sv.len);
+}
+
+vt_vec_t *vt_strview_split(vt_vec_t *vs, const vt_strview_t sv, const char *const sep) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(sep != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    VT_DEBUG_ASSERT(vs == NULL || vs->elsize == sizeof(vt_strview_t), "%s\n", vt_status_to_str(VT_STATUS_ERROR_INCOMPATIBLE_DATATYPE));
+
+    // create a vt_vec_t instance
+    vt_vec_t *v = (vs == NULL)
+        ? vt_vec_create(VT_ARRAY_DEFAULT_INIT_ELEMENTS, sizeof(vt_strview_t), NULL)
+        : vs;
+    if (v == NULL) {
+        VT_DEBUG_PRINTF("%s\n", vt_status_to_str(VT_STATUS_ERROR_ALLOCATION));
+        return NULL;
+    }
+
+    // clear
+    vt_vec_clear(v);
+
+    // collect tokens
+    vt_strview_t token;
+    vt_strview_split_iter_t it = vt_strview_split_iter(sv, sep);
+    while (vt_strview_split_next(&it, &token)) {
+        vt_vec_push_back(v, &token);
+    }
+
+    return v;
+}
+
+vt_strview_split_iter_t vt_strview_split_iter(const vt_strview_t sv, const char *const sep) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(sep != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    return (vt_strview_split_iter_t) {
+        .rest = sv,
+        .sep = sep,
+        .sepLen = strlen(sep),
+        .done = false,
+    };
+}
+
+bool vt_strview_split_next(vt_strview_split_iter_t *const it, vt_strview_t *const token) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(it != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    VT_DEBUG_ASSERT(token != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    while (!it->done) {
+        // find the next separator; the last token ends with the data
+        const char *const p = it->sepLen
+            ? vt_search_substr(it->rest.ptr, it->rest.len, it->sep, it->sepLen)
+            : NULL;
+        vt_strview_t current = it->rest;
+        if (p == NULL) {
+            it->done = true;
+        } else {
+            current.len = (size_t)(p - it->rest.ptr);
+            it->rest.ptr = p + it->sepLen;
+            it->rest.len -= current.len + it->sepLen;
+        }
+
+        // skip empty tokens
+        if (current.len) {
+            *token = current;
+            return true;
+        }
+    }
+
+    return false;
+}
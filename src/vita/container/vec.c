@@ -18,6 +18,25 @@ vt_vec_t *vt_vec_create(const size_t n, const size_t elsize, struct VitaBaseAllo
     return v;
 }
 
+vt_vec_t *vt_vec_create_aligned(const size_t n, const size_t elsize, const size_t alignment, struct VitaBaseAllocatorType *const alloctr) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(n > 0, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    VT_DEBUG_ASSERT(elsize > 0, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    VT_DEBUG_ASSERT(alloctr != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    // allocate a new vt_vec_t instance
+    vt_vec_t *v = vt_array_new(alloctr);
+    *v = (vt_vec_t) {
+        .alloctr = alloctr,
+        .ptr = VT_ALLOCATOR_ALLOC_ALIGNED(alloctr, n * elsize, alignment),
+        .len = 0,
+        .capacity = n,
+        .elsize = elsize,
+    };
+
+    return v;
+}
+
 void vt_vec_destroy(vt_vec_t *v) {
     // check for invalid input
     VT_DEBUG_ASSERT(vt_array_is_valid_object(v), "%s\n", vt_status_to_str(VT_STATUS_ERROR_IS_INVALID_OBJECT));
@@ -66,6 +85,10 @@ bool vt_vec_is_empty(const vt_vec_t *const v) {
     return !vt_array_len(v);
 }
 
+void vt_vec_set_growth_policy(vt_vec_t *const v, const enum VitaGrowthPolicy policy) {
+    vt_array_set_growth_policy(v, policy);
+}
+
 void vt_vec_shrink(vt_vec_t *const v) {
     // check for invalid input
     VT_DEBUG_ASSERT(vt_array_is_valid_object(v), "%s\n", vt_status_to_str(VT_STATUS_ERROR_IS_INVALID_OBJECT));
@@ -97,10 +120,13 @@ void vt_vec_reserve(vt_vec_t *const v, const size_t n) {
     VT_DEBUG_ASSERT(vt_array_is_valid_object(v), "%s\n", vt_status_to_str(VT_STATUS_ERROR_IS_INVALID_OBJECT));
     VT_DEBUG_ASSERT(n > 0, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
 
-    // reserve memory for additional n elements
-    v->ptr = v->alloctr 
-        ? VT_ALLOCATOR_REALLOC(v->alloctr, v->ptr, (v->capacity + n) * v->elsize) 
-        : VT_REALLOC(v->ptr, (v->capacity + n) * v->elsize);
+    // reserve memory for additional n elements, growing in place if the allocator supports it
+    const size_t bytes = (v->capacity + n) * v->elsize;
+    if (!v->alloctr || !VT_ALLOCATOR_EXPAND(v->alloctr, v->ptr, bytes)) {
+        v->ptr = v->alloctr 
+            ? VT_ALLOCATOR_REALLOC(v->alloctr, v->ptr, bytes) 
+            : VT_REALLOC(v->ptr, bytes);
+    }
 
     // update
     v->capacity += n;
@@ -159,7 +185,7 @@ void vt_vec_push_back(vt_vec_t *const v, const void *const val) {
 
     // check if new memory needs to be allocated
     if (!vt_vec_has_space(v)) {
-        vt_vec_reserve(v, v->capacity * VT_ARRAY_DEFAULT_GROWTH_RATE);
+        vt_vec_reserve(v, vt_array_growth(v, 1));
     }
 
     // copy val to vt_vec_t
@@ -301,7 +327,7 @@ void vt_vec_insert(vt_vec_t *const v, const void *const val, const size_t at) {
 
     // check if new memory needs to be allocated
     if (!vt_vec_has_space(v)) {
-        vt_vec_reserve(v, v->capacity * VT_ARRAY_DEFAULT_GROWTH_RATE);
+        vt_vec_reserve(v, vt_array_growth(v, 1));
     }
 
     // shift values by one value to the end of the vt_vec_t
@@ -1,5 +1,9 @@
 #include "vita/core/core.h"
 
+#if defined(_WIN32) || defined(_WIN64)
+    #include <malloc.h>
+#endif
+
 // generate vita error strings
 #define X(a) VT_STRING_OF(a),
 static const char *const vt_error_str[] = {
@@ -56,6 +60,40 @@ void vt_free(void *ptr) {
     free(ptr);
 }
 
+void *vt_calloc_aligned(const size_t bytes, const size_t alignment, const char *const file, const char *const func, const size_t line) {
+    assert(bytes > 0);
+    assert(alignment > 0 && (alignment & (alignment - 1)) == 0);
+
+    // allocate and error checking
+    void *ptr = NULL;
+    const size_t align = alignment < sizeof(void*) ? sizeof(void*) : alignment;
+#if defined(_WIN32) || defined(_WIN64)
+    ptr = _aligned_malloc(bytes, align);
+#else
+    if (posix_memalign(&ptr, align, bytes) != 0) {
+        ptr = NULL;
+    }
+#endif
+    if (ptr == NULL) {
+        fprintf(stderr, "%s %s:%s:%zu: %s\n", "MEMORY ALLOCATION FAILURE", file, func, line, "Aborting...");
+        exit(EXIT_FAILURE);
+    }
+
+    return memset(ptr, 0, bytes);
+}
+
+void vt_free_aligned(void *ptr) {
+    if (ptr == NULL) {
+        return;
+    }
+
+#if defined(_WIN32) || defined(_WIN64)
+    _aligned_free(ptr);
+#else
+    free(ptr);
+#endif
+}
+
 void *vt_memmove(void *dest, const void *const src, const size_t bytes) {
     assert(src != NULL);
     assert(dest != NULL);
@@ -147,3 +185,17 @@ const char *vt_status_to_str(const enum VitaStatus e) {
 
     return NULL;
 }
+
+int8_t vt_cpu_simd_level(void) {
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    static int8_t cpu_level = -1;
+    if (cpu_level < 0) {
+        __builtin_cpu_init();
+        cpu_level = __builtin_cpu_supports("avx512bw") ? 2 : __builtin_cpu_supports("avx2") ? 1 : 0;
+    }
+
+    return cpu_level;
+#else
+    return 0;
+#endif
+}
@@ -1,4 +1,614 @@
 #include "vita/experimental/hashmap.h"
 
-// ...
+// no slot
+#define VT_HASHMAP_NONE SIZE_MAX
 
+// metadata layout: probe distance + 1 in the low byte, hash bits in the rest
+#define VT_HASHMAP_DIST_MASK 0xffu
+#define VT_HASHMAP_TAG(h) ((uint32_t)((h) >> 32) & ~VT_HASHMAP_DIST_MASK)
+
+static size_t vt_hashmap_align(const size_t size);
+static size_t vt_hashmap_capacity_for(const size_t n, const double max_load);
+static void vt_hashmap_alloc_table(vt_hashmap_t *const map, const size_t capacity);
+static void vt_hashmap_free_keys(vt_hashmap_t *const map);
+static uint64_t vt_hashmap_hash(const vt_hashmap_t *const map, const void *const kp, const size_t kn);
+static uint64_t vt_hashmap_hash_slot(const vt_hashmap_t *const map, const uint8_t *const slot);
+static void vt_hashmap_copy(void *const dst, const void *const src, const size_t n);
+static void vt_hashmap_write(vt_hashmap_t *const map, uint8_t *const dst, const void *const kp, const size_t kn, const void *const val);
+static bool vt_hashmap_key_equals(const vt_hashmap_t *const map, const uint8_t *const slot, const void *const kp, const size_t kn);
+static size_t vt_hashmap_find(const vt_hashmap_t *const map, const void *const kp, const size_t kn, const uint64_t h);
+static bool vt_hashmap_place(vt_hashmap_t *const map, const size_t i, const uint32_t m, const uint8_t *const src);
+static size_t vt_hashmap_place_new(vt_hashmap_t *const map, const uint64_t h, const uint8_t *const src);
+static void vt_hashmap_overflow(vt_hashmap_t *const map, const uint8_t *const pending);
+static void vt_hashmap_rehash(vt_hashmap_t *const map, const size_t capacity, const uint8_t *const pending);
+static void *vt_hashmap_insert_kn(vt_hashmap_t *const map, const void *const kp, const size_t kn, const void *const val);
+static bool vt_hashmap_remove_kn(vt_hashmap_t *const map, const void *const kp, const size_t kn);
+
+vt_hashmap_t *vt_hashmap_create(const size_t n, const size_t key_size, const size_t val_size, struct VitaBaseAllocatorType *const alloctr) {
+    // slot layout: key, then value at its natural alignment
+    const size_t key_bytes = key_size == VT_HASHMAP_KEY_STR ? sizeof(vt_str_t*) : key_size;
+    const size_t val_align = vt_hashmap_align(val_size);
+    const size_t slot_align = vt_hashmap_align(key_bytes) > val_align ? vt_hashmap_align(key_bytes) : val_align;
+    const size_t val_offset = (key_bytes + val_align - 1) & ~(val_align - 1);
+
+    // allocate a new vt_hashmap_t instance
+    vt_hashmap_t *map = VT_ALLOCATOR_ALLOC_OR_DEFAULT(alloctr, sizeof(vt_hashmap_t));
+    *map = (vt_hashmap_t) {
+        .alloctr = alloctr,
+        .max_load = VT_HASHMAP_DEFAULT_MAX_LOAD,
+        .key_size = key_size,
+        .val_size = val_size,
+        .val_offset = val_offset,
+        .slot_size = (val_offset + val_size + slot_align - 1) & ~(slot_align - 1),
+    };
+
+    // a seed per map: entries copied from one map to another do not arrive in clustered order
+    map->seed = vt_hash_u64((uint64_t)(uintptr_t)map, (uint64_t)(uintptr_t)&vt_hashmap_create);
+
+    // allocate slots
+    vt_hashmap_alloc_table(map, vt_hashmap_capacity_for(n, map->max_load));
+
+    return map;
+}
+
+void vt_hashmap_destroy(vt_hashmap_t *map) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(map != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    // free keys and slots
+    vt_hashmap_free_keys(map);
+    VT_ALLOCATOR_FREE_OR_DEFAULT(map->alloctr, map->meta);
+    VT_ALLOCATOR_FREE_OR_DEFAULT(map->alloctr, map->slots);
+
+    // free vt_hashmap_t instance itself
+    VT_ALLOCATOR_FREE_OR_DEFAULT(map->alloctr, map);
+    map = NULL;
+}
+
+size_t vt_hashmap_len(const vt_hashmap_t *const map) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(map != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    return map->len;
+}
+
+size_t vt_hashmap_capacity(const vt_hashmap_t *const map) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(map != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    return map->capacity;
+}
+
+bool vt_hashmap_is_empty(const vt_hashmap_t *const map) {
+    return !vt_hashmap_len(map);
+}
+
+void vt_hashmap_clear(vt_hashmap_t *const map) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(map != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    vt_hashmap_free_keys(map);
+    memset(map->meta, 0, map->capacity * sizeof(uint32_t));
+    map->len = 0;
+}
+
+void vt_hashmap_reserve(vt_hashmap_t *const map, const size_t n) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(map != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    const size_t capacity = vt_hashmap_capacity_for(n, map->max_load);
+    if (capacity > map->capacity) {
+        vt_hashmap_rehash(map, capacity, NULL);
+    }
+}
+
+void vt_hashmap_set_max_load(vt_hashmap_t *const map, const double max_load) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(map != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    VT_DEBUG_ASSERT(max_load >= 0.25 && max_load <= 0.95, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    map->max_load = max_load;
+    map->max_len = (size_t)((double)map->capacity * max_load);
+    if (map->len > map->max_len) {
+        vt_hashmap_rehash(map, vt_hashmap_capacity_for(map->len, max_load), NULL);
+    }
+}
+
+void *vt_hashmap_insert(vt_hashmap_t *const map, const void *const key, const void *const val) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(map != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    VT_DEBUG_ASSERT(key != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    if (map->key_size == VT_HASHMAP_KEY_STR) {
+        return vt_hashmap_insert_kn(map, vt_str_z(key), vt_str_len(key), val);
+    }
+    return vt_hashmap_insert_kn(map, key, map->key_size, val);
+}
+
+void *vt_hashmap_get(const vt_hashmap_t *const map, const void *const key) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(map != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    VT_DEBUG_ASSERT(key != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    const void *const kp = map->key_size == VT_HASHMAP_KEY_STR ? vt_str_z(key) : key;
+    const size_t kn = map->key_size == VT_HASHMAP_KEY_STR ? vt_str_len(key) : map->key_size;
+    const size_t i = vt_hashmap_find(map, kp, kn, vt_hashmap_hash(map, kp, kn));
+
+    return i == VT_HASHMAP_NONE ? NULL : map->slots + i * map->slot_size + map->val_offset;
+}
+
+bool vt_hashmap_has(const vt_hashmap_t *const map, const void *const key) {
+    return vt_hashmap_get(map, key) != NULL;
+}
+
+bool vt_hashmap_remove(vt_hashmap_t *const map, const void *const key) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(map != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    VT_DEBUG_ASSERT(key != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    if (map->key_size == VT_HASHMAP_KEY_STR) {
+        return vt_hashmap_remove_kn(map, vt_str_z(key), vt_str_len(key));
+    }
+    return vt_hashmap_remove_kn(map, key, map->key_size);
+}
+
+void *vt_hashmap_insert_z(vt_hashmap_t *const map, const char *const z, const void *const val) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(map != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    VT_DEBUG_ASSERT(map->key_size == VT_HASHMAP_KEY_STR, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INCOMPATIBLE_DATATYPE));
+    VT_DEBUG_ASSERT(z != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    return vt_hashmap_insert_kn(map, z, strlen(z), val);
+}
+
+void *vt_hashmap_get_z(const vt_hashmap_t *const map, const char *const z) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(map != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    VT_DEBUG_ASSERT(map->key_size == VT_HASHMAP_KEY_STR, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INCOMPATIBLE_DATATYPE));
+    VT_DEBUG_ASSERT(z != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    const size_t kn = strlen(z);
+    const size_t i = vt_hashmap_find(map, z, kn, vt_hashmap_hash(map, z, kn));
+
+    return i == VT_HASHMAP_NONE ? NULL : map->slots + i * map->slot_size + map->val_offset;
+}
+
+bool vt_hashmap_remove_z(vt_hashmap_t *const map, const char *const z) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(map != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    VT_DEBUG_ASSERT(map->key_size == VT_HASHMAP_KEY_STR, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INCOMPATIBLE_DATATYPE));
+    VT_DEBUG_ASSERT(z != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    return vt_hashmap_remove_kn(map, z, strlen(z));
+}
+
+vt_hashmap_iter_t vt_hashmap_iter(const vt_hashmap_t *const map) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(map != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    return (vt_hashmap_iter_t) {
+        .map = map,
+        .idx = 0,
+    };
+}
+
+bool vt_hashmap_next(vt_hashmap_iter_t *const it, const void **const key, void **const val) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(it != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    const vt_hashmap_t *const map = it->map;
+    while (it->idx < map->capacity && !map->meta[it->idx]) {
+        it->idx++;
+    }
+    if (it->idx == map->capacity) {
+        return false;
+    }
+
+    // string keys are stored as pointers
+    uint8_t *const slot = map->slots + it->idx * map->slot_size;
+    if (key) {
+        *key = map->key_size == VT_HASHMAP_KEY_STR ? *(const vt_str_t**)slot : (const void*)slot;
+    }
+    if (val) {
+        *val = slot + map->val_offset;
+    }
+    it->idx++;
+
+    return true;
+}
+
+/* ---------------------- PRIVATE FUNCTIONS ---------------------- */
+
+/** Returns the alignment of an object of the given size: its largest power of 2 divisor, up to the fundamental alignment
+    @param size size in bytes
+    @returns alignment
+*/
+static size_t vt_hashmap_align(const size_t size) {
+    if (!size) {
+        return 1;
+    }
+
+    size_t align = 1;
+    while (align < _Alignof(max_align_t) && size % (align * 2) == 0) {
+        align *= 2;
+    }
+
+    return align;
+}
+
+/** Returns the smallest capacity that holds n entries without exceeding the load factor
+    @param n number of entries
+    @param max_load load factor
+    @returns power of 2
+*/
+static size_t vt_hashmap_capacity_for(const size_t n, const double max_load) {
+    size_t capacity = VT_HASHMAP_MIN_CAPACITY;
+    while ((size_t)((double)capacity * max_load) < n) {
+        capacity *= 2;
+    }
+
+    return capacity;
+}
+
+/** Allocates empty slots
+    @param map vt_hashmap_t instance
+    @param capacity number of slots, power of 2
+*/
+static void vt_hashmap_alloc_table(vt_hashmap_t *const map, const size_t capacity) {
+    map->meta = VT_ALLOCATOR_ALLOC_OR_DEFAULT(map->alloctr, capacity * sizeof(uint32_t));
+    map->slots = VT_ALLOCATOR_ALLOC_OR_DEFAULT(map->alloctr, (capacity + 1) * map->slot_size);
+    map->capacity = capacity;
+    map->max_len = (size_t)((double)capacity * map->max_load);
+}
+
+/** Frees the copies of string keys
+    @param map vt_hashmap_t instance
+*/
+static void vt_hashmap_free_keys(vt_hashmap_t *const map) {
+    if (map->key_size != VT_HASHMAP_KEY_STR) {
+        return;
+    }
+
+    VT_FOREACH(i, 0, map->capacity) {
+        if (map->meta[i]) {
+            VT_ALLOCATOR_FREE_OR_DEFAULT(map->alloctr, *(vt_str_t**)(map->slots + i * map->slot_size));
+        }
+    }
+}
+
+/** Hashes a key
+    @param map vt_hashmap_t instance
+    @param kp key bytes
+    @param kn key length
+    @returns 64-bit hash
+*/
+static uint64_t vt_hashmap_hash(const vt_hashmap_t *const map, const void *const kp, const size_t kn) {
+    // integer-sized keys are mixed without a loop
+    if (kn == sizeof(uint64_t) && map->key_size == sizeof(uint64_t)) {
+        uint64_t v;
+        memcpy(&v, kp, sizeof(v));
+        return vt_hash_u64(v, map->seed);
+    } else if (kn == sizeof(uint32_t) && map->key_size == sizeof(uint32_t)) {
+        uint32_t v;
+        memcpy(&v, kp, sizeof(v));
+        return vt_hash_u32(v, map->seed);
+    }
+
+    return vt_hash(kp, kn, map->seed);
+}
+
+/** Hashes the key stored in a slot
+    @param map vt_hashmap_t instance
+    @param slot slot
+    @returns 64-bit hash
+*/
+static uint64_t vt_hashmap_hash_slot(const vt_hashmap_t *const map, const uint8_t *const slot) {
+    if (map->key_size == VT_HASHMAP_KEY_STR) {
+        const vt_str_t *const s = *(const vt_str_t *const*)slot;
+        return vt_hashmap_hash(map, s->ptr, s->len);
+    }
+
+    return vt_hashmap_hash(map, slot, map->key_size);
+}
+
+/** Copies memory, sizes of integer keys and values are copied inline
+    @param dst destination
+    @param src source
+    @param n number of bytes
+*/
+static void vt_hashmap_copy(void *const dst, const void *const src, const size_t n) {
+    switch (n) {
+        case 4:
+            memcpy(dst, src, 4);
+            break;
+        case 8:
+            memcpy(dst, src, 8);
+            break;
+        case 16:
+            memcpy(dst, src, 16);
+            break;
+        default:
+            memcpy(dst, src, n);
+            break;
+    }
+}
+
+/** Writes a new entry into a slot, string keys are copied with their contents following the header
+    @param map vt_hashmap_t instance
+    @param dst slot
+    @param kp key bytes
+    @param kn key length
+    @param val value, or `NULL` for zeroes
+*/
+static void vt_hashmap_write(vt_hashmap_t *const map, uint8_t *const dst, const void *const kp, const size_t kn, const void *const val) {
+    if (map->key_size == VT_HASHMAP_KEY_STR) {
+        vt_str_t *const s = VT_ALLOCATOR_ALLOC_OR_DEFAULT(map->alloctr, sizeof(vt_str_t) + kn + 1);
+        char *const data = (char*)(s + 1);
+        if (kn) {
+            memcpy(data, kp, kn);
+        }
+        *s = (vt_str_t) {
+            .ptr = data,
+            .len = kn,
+            .capacity = kn,
+            .elsize = sizeof(char),
+            .is_view = true,
+        };
+        memcpy(dst, &s, sizeof(s));
+    } else {
+        vt_hashmap_copy(dst, kp, kn);
+    }
+
+    if (val) {
+        vt_hashmap_copy(dst + map->val_offset, val, map->val_size);
+    } else {
+        memset(dst + map->val_offset, 0, map->val_size);
+    }
+}
+
+/** Compares the key stored in a slot with a key
+    @param map vt_hashmap_t instance
+    @param slot slot
+    @param kp key bytes
+    @param kn key length
+    @returns `true` if equal
+*/
+static bool vt_hashmap_key_equals(const vt_hashmap_t *const map, const uint8_t *const slot, const void *const kp, const size_t kn) {
+    // integer-sized keys are compared without a call
+    if (map->key_size == sizeof(uint64_t)) {
+        uint64_t a, b;
+        memcpy(&a, slot, sizeof(a));
+        memcpy(&b, kp, sizeof(b));
+        return a == b;
+    } else if (map->key_size == sizeof(uint32_t)) {
+        uint32_t a, b;
+        memcpy(&a, slot, sizeof(a));
+        memcpy(&b, kp, sizeof(b));
+        return a == b;
+    } else if (map->key_size == VT_HASHMAP_KEY_STR) {
+        const vt_str_t *const s = *(const vt_str_t *const*)slot;
+        return s->len == kn && (!kn || !memcmp(s->ptr, kp, kn));
+    }
+
+    return !memcmp(slot, kp, kn);
+}
+
+/** Finds the slot of a key
+    @param map vt_hashmap_t instance
+    @param kp key bytes
+    @param kn key length
+    @param h key hash
+
+    @returns slot index, VT_HASHMAP_NONE if not found
+*/
+static size_t vt_hashmap_find(const vt_hashmap_t *const map, const void *const kp, const size_t kn, const uint64_t h) {
+    const size_t mask = map->capacity - 1;
+
+    // entries are ordered by probe distance: stop at the first one closer to its home than the key would be
+    uint32_t expected = VT_HASHMAP_TAG(h) | 1;
+    for (size_t i = (size_t)h & mask;; i = (i + 1) & mask, expected++) {
+        const uint32_t m = map->meta[i];
+        if (m == expected && vt_hashmap_key_equals(map, map->slots + i * map->slot_size, kp, kn)) {
+            return i;
+        }
+        if ((m & VT_HASHMAP_DIST_MASK) < (expected & VT_HASHMAP_DIST_MASK) || (expected & VT_HASHMAP_DIST_MASK) == VT_HASHMAP_MAX_DISTANCE) {
+            return VT_HASHMAP_NONE;
+        }
+    }
+}
+
+/** Puts an entry into a slot, shifting the rest of the cluster one slot forward
+    @param map vt_hashmap_t instance
+    @param i slot index: empty, or holding an entry closer to its home than the new one
+    @param m metadata of the new entry in that slot
+    @param src entry to copy, outside of the table slots
+
+    @returns `false` if a shifted entry would exceed the probe distance limit; the map is rehashed with the entry
+*/
+static bool vt_hashmap_place(vt_hashmap_t *const map, const size_t i, const uint32_t m, const uint8_t *const src) {
+    const size_t mask = map->capacity - 1;
+    const size_t ss = map->slot_size;
+    uint8_t *const slots = map->slots;
+    uint32_t *const meta = map->meta;
+
+    // find the end of the cluster; the entries in between move one slot further from their home
+    size_t e = i;
+    for (; meta[e]; e = (e + 1) & mask) {
+        if ((meta[e] & VT_HASHMAP_DIST_MASK) == VT_HASHMAP_MAX_DISTANCE) {
+            vt_hashmap_overflow(map, src);
+            return false;
+        }
+        meta[e]++;
+    }
+
+    // shift [i, e) by one slot, the cluster may wrap around the end of the table
+    if (e == i) {
+        // nothing to shift
+    } else if (e > i) {
+        memmove(slots + (i + 1) * ss, slots + i * ss, (e - i) * ss);
+        memmove(meta + i + 1, meta + i, (e - i) * sizeof(uint32_t));
+    } else {
+        memmove(slots + ss, slots, e * ss);
+        memmove(meta + 1, meta, e * sizeof(uint32_t));
+        memcpy(slots, slots + mask * ss, ss);
+        meta[0] = meta[mask];
+        memmove(slots + (i + 1) * ss, slots + i * ss, (mask - i) * ss);
+        memmove(meta + i + 1, meta + i, (mask - i) * sizeof(uint32_t));
+    }
+
+    // put the entry
+    meta[i] = m;
+    vt_hashmap_copy(slots + i * ss, src, ss);
+
+    return true;
+}
+
+/** Inserts an entry whose key is not in the map
+    @param map vt_hashmap_t instance
+    @param h key hash
+    @param src entry to copy, outside of the table slots
+
+    @returns slot index of the entry, VT_HASHMAP_NONE if the map was rehashed on the way
+*/
+static size_t vt_hashmap_place_new(vt_hashmap_t *const map, const uint64_t h, const uint8_t *const src) {
+    const size_t mask = map->capacity - 1;
+
+    // skip entries farther from their home than the new one
+    size_t i = (size_t)h & mask;
+    uint32_t m = VT_HASHMAP_TAG(h) | 1;
+    while ((map->meta[i] & VT_HASHMAP_DIST_MASK) >= (m & VT_HASHMAP_DIST_MASK)) {
+        if ((m & VT_HASHMAP_DIST_MASK) == VT_HASHMAP_MAX_DISTANCE) {
+            vt_hashmap_overflow(map, src);
+            return VT_HASHMAP_NONE;
+        }
+        i = (i + 1) & mask;
+        m++;
+    }
+
+    return vt_hashmap_place(map, i, m, src) ? i : VT_HASHMAP_NONE;
+}
+
+/** Rehashes the map when the probe distance limit is reached
+    @param map vt_hashmap_t instance
+    @param pending entry to insert as well
+*/
+static void vt_hashmap_overflow(vt_hashmap_t *const map, const uint8_t *const pending) {
+    // if the table is sparse, growing would not help, the keys are clustered by the seed
+    if (map->len * 8 < map->capacity) {
+        map->seed = vt_hash_u64(map->seed, map->capacity);
+        vt_hashmap_rehash(map, map->capacity, pending);
+    } else {
+        vt_hashmap_rehash(map, map->capacity * 2, pending);
+    }
+}
+
+/** Moves all entries into a new table
+    @param map vt_hashmap_t instance
+    @param capacity number of slots, power of 2
+    @param pending entry to insert as well, or `NULL`
+*/
+static void vt_hashmap_rehash(vt_hashmap_t *const map, const size_t capacity, const uint8_t *const pending) {
+    const size_t old_capacity = map->capacity;
+    uint32_t *const old_meta = map->meta;
+    uint8_t *const old_slots = map->slots;
+
+    // reinsert entries
+    vt_hashmap_alloc_table(map, capacity);
+    VT_FOREACH(i, 0, old_capacity) {
+        if (old_meta[i]) {
+            const uint8_t *const slot = old_slots + i * map->slot_size;
+            vt_hashmap_place_new(map, vt_hashmap_hash_slot(map, slot), slot);
+        }
+    }
+    if (pending) {
+        vt_hashmap_place_new(map, vt_hashmap_hash_slot(map, pending), pending);
+    }
+
+    VT_ALLOCATOR_FREE_OR_DEFAULT(map->alloctr, old_meta);
+    VT_ALLOCATOR_FREE_OR_DEFAULT(map->alloctr, old_slots);
+}
+
+/** Inserts an entry or overwrites the value of an existing key
+    @param map vt_hashmap_t instance
+    @param kp key bytes
+    @param kn key length
+    @param val value, or `NULL`
+
+    @returns pointer to the value in the map
+*/
+static void *vt_hashmap_insert_kn(vt_hashmap_t *const map, const void *const kp, const size_t kn, const void *const val) {
+    const uint64_t h = vt_hashmap_hash(map, kp, kn);
+
+    // look for the key, stop where it would be inserted
+    const size_t mask = map->capacity - 1;
+    size_t i = (size_t)h & mask;
+    uint32_t m = VT_HASHMAP_TAG(h) | 1;
+    for (;; i = (i + 1) & mask, m++) {
+        const uint32_t mi = map->meta[i];
+        if (mi == m && vt_hashmap_key_equals(map, map->slots + i * map->slot_size, kp, kn)) {
+            // overwrite
+            uint8_t *const v = map->slots + i * map->slot_size + map->val_offset;
+            if (val) {
+                vt_hashmap_copy(v, val, map->val_size);
+            }
+            return v;
+        }
+        if ((mi & VT_HASHMAP_DIST_MASK) < (m & VT_HASHMAP_DIST_MASK) || (m & VT_HASHMAP_DIST_MASK) == VT_HASHMAP_MAX_DISTANCE) {
+            break;
+        }
+    }
+
+    // an empty slot is written in place
+    map->len++;
+    if (!map->meta[i] && map->len <= map->max_len) {
+        map->meta[i] = m;
+        vt_hashmap_write(map, map->slots + i * map->slot_size, kp, kn, val);
+        return map->slots + i * map->slot_size + map->val_offset;
+    }
+
+    // otherwise the entry is prepared in the scratch slot; grow first if needed
+    uint8_t *const carry = map->slots + map->capacity * map->slot_size;
+    vt_hashmap_write(map, carry, kp, kn, val);
+    if (map->len > map->max_len) {
+        vt_hashmap_rehash(map, map->capacity * 2, carry);
+        i = VT_HASHMAP_NONE;
+    } else if ((map->meta[i] & VT_HASHMAP_DIST_MASK) >= (m & VT_HASHMAP_DIST_MASK)) {
+        vt_hashmap_overflow(map, carry);
+        i = VT_HASHMAP_NONE;
+    } else if (!vt_hashmap_place(map, i, m, carry)) {
+        i = VT_HASHMAP_NONE;
+    }
+    if (i == VT_HASHMAP_NONE) {
+        i = vt_hashmap_find(map, kp, kn, vt_hashmap_hash(map, kp, kn));
+    }
+
+    return map->slots + i * map->slot_size + map->val_offset;
+}
+
+/** Removes an entry, shifting the following entries of the cluster back
+    @param map vt_hashmap_t instance
+    @param kp key bytes
+    @param kn key length
+
+    @returns `true` if the key was found
+*/
+static bool vt_hashmap_remove_kn(vt_hashmap_t *const map, const void *const kp, const size_t kn) {
+    size_t i = vt_hashmap_find(map, kp, kn, vt_hashmap_hash(map, kp, kn));
+    if (i == VT_HASHMAP_NONE) {
+        return false;
+    }
+
+    // free the key copy
+    if (map->key_size == VT_HASHMAP_KEY_STR) {
+        VT_ALLOCATOR_FREE_OR_DEFAULT(map->alloctr, *(vt_str_t**)(map->slots + i * map->slot_size));
+    }
+
+    // shift back until an empty slot or an entry at its home
+    const size_t mask = map->capacity - 1;
+    for (size_t j = (i + 1) & mask; (map->meta[j] & VT_HASHMAP_DIST_MASK) > 1; i = j, j = (j + 1) & mask) {
+        map->meta[i] = map->meta[j] - 1;
+        vt_hashmap_copy(map->slots + i * map->slot_size, map->slots + j * map->slot_size, map->slot_size);
+    }
+    map->meta[i] = 0;
+    map->len--;
+
+    return true;
+}
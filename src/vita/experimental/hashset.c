@@ -0,0 +1,218 @@
+#include "vita/experimental/hashset.h"
+
+vt_hashset_t *vt_hashset_create(const size_t n, const size_t elsize, struct VitaBaseAllocatorType *const alloctr) {
+    // allocate a new vt_hashset_t instance
+    vt_hashset_t *set = alloctr ? VT_ALLOCATOR_ALLOC(alloctr, sizeof(vt_hashset_t)) : VT_CALLOC(sizeof(vt_hashset_t));
+    set->map = vt_hashmap_create(n, elsize, 0, alloctr);
+
+    return set;
+}
+
+void vt_hashset_destroy(vt_hashset_t *set) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(set != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    // free the table
+    struct VitaBaseAllocatorType *const alloctr = set->map->alloctr;
+    vt_hashmap_destroy(set->map);
+
+    // free vt_hashset_t instance itself
+    if (alloctr) {
+        VT_ALLOCATOR_FREE(alloctr, set);
+    } else {
+        VT_FREE(set);
+    }
+    set = NULL;
+}
+
+size_t vt_hashset_len(const vt_hashset_t *const set) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(set != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    return vt_hashmap_len(set->map);
+}
+
+bool vt_hashset_is_empty(const vt_hashset_t *const set) {
+    return !vt_hashset_len(set);
+}
+
+void vt_hashset_clear(vt_hashset_t *const set) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(set != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    vt_hashmap_clear(set->map);
+}
+
+void vt_hashset_reserve(vt_hashset_t *const set, const size_t n) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(set != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    vt_hashmap_reserve(set->map, n);
+}
+
+void vt_hashset_set_max_load(vt_hashset_t *const set, const double max_load) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(set != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    vt_hashmap_set_max_load(set->map, max_load);
+}
+
+bool vt_hashset_insert(vt_hashset_t *const set, const void *const el) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(set != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    const size_t len = vt_hashmap_len(set->map);
+    vt_hashmap_insert(set->map, el, NULL);
+
+    return vt_hashmap_len(set->map) > len;
+}
+
+bool vt_hashset_has(const vt_hashset_t *const set, const void *const el) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(set != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    return vt_hashmap_has(set->map, el);
+}
+
+bool vt_hashset_remove(vt_hashset_t *const set, const void *const el) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(set != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    return vt_hashmap_remove(set->map, el);
+}
+
+bool vt_hashset_insert_z(vt_hashset_t *const set, const char *const z) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(set != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    const size_t len = vt_hashmap_len(set->map);
+    vt_hashmap_insert_z(set->map, z, NULL);
+
+    return vt_hashmap_len(set->map) > len;
+}
+
+bool vt_hashset_has_z(const vt_hashset_t *const set, const char *const z) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(set != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    return vt_hashmap_get_z(set->map, z) != NULL;
+}
+
+bool vt_hashset_remove_z(vt_hashset_t *const set, const char *const z) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(set != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    return vt_hashmap_remove_z(set->map, z);
+}
+
+size_t vt_hashset_insert_vec(vt_hashset_t *const set, const vt_vec_t *const v) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(set != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    VT_DEBUG_ASSERT(vt_array_is_valid_object(v), "%s\n", vt_status_to_str(VT_STATUS_ERROR_IS_INVALID_OBJECT));
+    VT_DEBUG_ASSERT(v->elsize == set->map->key_size, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INCOMPATIBLE_DATATYPE));
+
+    // no room is reserved upfront: with duplicates it would be too much
+    const size_t len = vt_hashmap_len(set->map);
+    const size_t vlen = vt_vec_len(v);
+    const uint8_t *el = v->ptr;
+    VT_FOREACH(i, 0, vlen) {
+        vt_hashmap_insert(set->map, el, NULL);
+        el += v->elsize;
+    }
+
+    return vt_hashmap_len(set->map) - len;
+}
+
+size_t vt_hashset_insert_plist(vt_hashset_t *const set, const vt_plist_t *const p) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(set != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    VT_DEBUG_ASSERT(vt_array_is_valid_object(p), "%s\n", vt_status_to_str(VT_STATUS_ERROR_IS_INVALID_OBJECT));
+    VT_DEBUG_ASSERT(set->map->key_size == VT_HASHSET_STR, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INCOMPATIBLE_DATATYPE));
+
+    // insert
+    const size_t len = vt_hashmap_len(set->map);
+    const size_t plen = vt_plist_len(p);
+    VT_FOREACH(i, 0, plen) {
+        vt_hashmap_insert(set->map, vt_plist_get(p, i), NULL);
+    }
+
+    return vt_hashmap_len(set->map) - len;
+}
+
+void vt_hashset_union(vt_hashset_t *const dst, const vt_hashset_t *const src) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(dst != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    VT_DEBUG_ASSERT(src != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    VT_DEBUG_ASSERT(dst->map->key_size == src->map->key_size, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INCOMPATIBLE_DATATYPE));
+
+    // nothing to add to itself
+    if (dst == src) {
+        return;
+    }
+
+    // the union is at least as large as either set
+    const void *el = NULL;
+    if (vt_hashmap_len(src->map) > vt_hashmap_len(dst->map)) {
+        vt_hashmap_reserve(dst->map, vt_hashmap_len(src->map));
+    }
+    vt_hashmap_iter_t it = vt_hashmap_iter(src->map);
+    while (vt_hashmap_next(&it, &el, NULL)) {
+        vt_hashmap_insert(dst->map, el, NULL);
+    }
+}
+
+void vt_hashset_intersect(vt_hashset_t *const dst, const vt_hashset_t *const src) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(dst != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    VT_DEBUG_ASSERT(src != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    VT_DEBUG_ASSERT(dst->map->key_size == src->map->key_size, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INCOMPATIBLE_DATATYPE));
+
+    // removal shifts the following entries back into the current slot, so it is checked again;
+    // an entry wrapping around from the start of the table was checked already and is kept
+    vt_hashmap_t *const map = dst->map;
+    size_t i = 0;
+    while (i < map->capacity) {
+        if (!map->meta[i]) {
+            i++;
+            continue;
+        }
+
+        // string elements are stored as pointers
+        const uint8_t *const slot = map->slots + i * map->slot_size;
+        const void *const el = map->key_size == VT_HASHSET_STR ? *(const vt_str_t *const*)slot : (const void*)slot;
+        if (vt_hashmap_has(src->map, el)) {
+            i++;
+        } else {
+            vt_hashmap_remove(map, el);
+        }
+    }
+}
+
+vt_hashset_iter_t vt_hashset_iter(const vt_hashset_t *const set) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(set != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    return vt_hashmap_iter(set->map);
+}
+
+bool vt_hashset_next(vt_hashset_iter_t *const it, const void **const el) {
+    return vt_hashmap_next(it, el, NULL);
+}
+
+size_t vt_hashset_memory(const vt_hashset_t *const set) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(set != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    // table: metadata, slots and the scratch slot
+    const vt_hashmap_t *const map = set->map;
+    size_t bytes = sizeof(vt_hashset_t) + sizeof(vt_hashmap_t)
+        + map->capacity * sizeof(uint32_t)
+        + (map->capacity + 1) * map->slot_size;
+
+    // copies of strings: header and characters
+    if (map->key_size == VT_HASHSET_STR) {
+        const void *el = NULL;
+        vt_hashmap_iter_t it = vt_hashmap_iter(map);
+        while (vt_hashmap_next(&it, &el, NULL)) {
+            bytes += sizeof(vt_str_t) + vt_str_len(el) + 1;
+        }
+    }
+
+    return bytes;
+}
+
+double vt_hashset_bytes_per_element(const vt_hashset_t *const set) {
+    const size_t len = vt_hashset_len(set);
+    return len ? (double)vt_hashset_memory(set) / (double)len : 0;
+}
@@ -1,4 +1,417 @@
 #include "vita/experimental/sllist.h"
 
-// ...
+// node links, followed by the element
+struct VitaSllistNode {
+    uint32_t next;
+    uint32_t prev;
+};
 
+static struct VitaSllistNode *vt_sllist_node(const vt_sllist_t *const list, const size_t idx);
+static void *vt_sllist_node_value(struct VitaSllistNode *const node);
+static void vt_sllist_grow(vt_sllist_t *const list);
+static struct VitaSllistNode *vt_sllist_node_alloc(vt_sllist_t *const list, const void *const val, uint32_t *const idx);
+static uint32_t vt_sllist_link(vt_sllist_t *const list, const void *const val, const uint32_t prev, const uint32_t next);
+static struct VitaSllistNode *vt_sllist_unlink(vt_sllist_t *const list, const uint32_t idx);
+static size_t vt_sllist_floor_log2(const size_t x);
+
+vt_sllist_t *vt_sllist_create(const size_t n, const size_t elsize, struct VitaBaseAllocatorType *const alloctr) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(elsize > 0, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    // allocate a new vt_sllist_t instance
+    vt_sllist_t *list = alloctr ? VT_ALLOCATOR_ALLOC(alloctr, sizeof(vt_sllist_t)) : VT_CALLOC(sizeof(vt_sllist_t));
+
+    // elements keep their natural alignment (up to 8 bytes) after the 8-byte links
+    const size_t alignment = elsize % 8 == 0 ? 8 : 4;
+    *list = (vt_sllist_t) {
+        .alloctr = alloctr,
+        .block_shift = VT_SLLIST_MIN_BLOCK_SHIFT,
+        .elsize = elsize,
+        .node_size = (sizeof(struct VitaSllistNode) + elsize + alignment - 1) / alignment * alignment,
+        .head = VT_SLLIST_NIL,
+        .tail = VT_SLLIST_NIL,
+        .free_list = VT_SLLIST_NIL,
+    };
+
+    // the first block holds n nodes rounded up to a power of 2
+    while (((size_t)1 << list->block_shift) < n) {
+        list->block_shift++;
+    }
+    if (n > 0) {
+        vt_sllist_grow(list);
+    }
+
+    return list;
+}
+
+void vt_sllist_destroy(vt_sllist_t *list) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(list != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    // free node blocks
+    struct VitaBaseAllocatorType *const alloctr = list->alloctr;
+    VT_FOREACH(b, 0, list->count_blocks) {
+        if (alloctr) {
+            VT_ALLOCATOR_FREE(alloctr, list->blocks[b]);
+        } else {
+            VT_FREE(list->blocks[b]);
+        }
+    }
+
+    // free vt_sllist_t instance itself
+    if (alloctr) {
+        VT_ALLOCATOR_FREE(alloctr, list);
+    } else {
+        VT_FREE(list);
+    }
+    list = NULL;
+}
+
+size_t vt_sllist_len(const vt_sllist_t *const list) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(list != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    return list->len;
+}
+
+size_t vt_sllist_capacity(const vt_sllist_t *const list) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(list != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    // blocks hold 1, 2, 4, ... times the first block
+    return (((size_t)1 << list->count_blocks) - 1) << list->block_shift;
+}
+
+bool vt_sllist_is_empty(const vt_sllist_t *const list) {
+    return !vt_sllist_len(list);
+}
+
+void vt_sllist_clear(vt_sllist_t *const list) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(list != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    // nodes are carved from the start of the first block again
+    list->len = 0;
+    list->count_nodes = 0;
+    list->head = list->tail = list->free_list = VT_SLLIST_NIL;
+}
+
+void vt_sllist_reserve(vt_sllist_t *const list, const size_t n) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(list != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    // removed nodes are reused, so the blocks must hold n nodes
+    while (vt_sllist_capacity(list) < n) {
+        vt_sllist_grow(list);
+    }
+}
+
+size_t vt_sllist_head(const vt_sllist_t *const list) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(list != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    return list->head;
+}
+
+size_t vt_sllist_tail(const vt_sllist_t *const list) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(list != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    return list->tail;
+}
+
+size_t vt_sllist_next(const vt_sllist_t *const list, const size_t node) {
+    return vt_sllist_node(list, node)->next;
+}
+
+size_t vt_sllist_prev(const vt_sllist_t *const list, const size_t node) {
+    return vt_sllist_node(list, node)->prev;
+}
+
+size_t vt_sllist_at(const vt_sllist_t *const list, const size_t at) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(list != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    VT_ENFORCE(at < list->len, "%s\n", vt_status_to_str(VT_STATUS_ERROR_OUT_OF_BOUNDS_ACCESS));
+
+    // walk from the nearest end
+    size_t node = 0;
+    if (at < list->len / 2) {
+        node = list->head;
+        VT_FOREACH(i, 0, at) {
+            node = vt_sllist_node(list, node)->next;
+        }
+    } else {
+        node = list->tail;
+        VT_FOREACH(i, at + 1, list->len) {
+            node = vt_sllist_node(list, node)->prev;
+        }
+    }
+
+    return node;
+}
+
+void vt_sllist_set(vt_sllist_t *const list, const void *const val, const size_t node) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(val != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    memcpy(vt_sllist_get(list, node), val, list->elsize);
+}
+
+void *vt_sllist_get(const vt_sllist_t *const list, const size_t node) {
+    return vt_sllist_node_value(vt_sllist_node(list, node));
+}
+
+size_t vt_sllist_push_front(vt_sllist_t *const list, const void *const val) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(list != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    return vt_sllist_link(list, val, VT_SLLIST_NIL, list->head);
+}
+
+size_t vt_sllist_push_back(vt_sllist_t *const list, const void *const val) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(list != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    return vt_sllist_link(list, val, list->tail, VT_SLLIST_NIL);
+}
+
+size_t vt_sllist_insert_before(vt_sllist_t *const list, const void *const val, const size_t node) {
+    return vt_sllist_link(list, val, vt_sllist_node(list, node)->prev, (uint32_t)node);
+}
+
+size_t vt_sllist_insert_after(vt_sllist_t *const list, const void *const val, const size_t node) {
+    return vt_sllist_link(list, val, (uint32_t)node, vt_sllist_node(list, node)->next);
+}
+
+void vt_sllist_pop_front(vt_sllist_t *const list) {
+    vt_sllist_pop_get_front(list);
+}
+
+void vt_sllist_pop_back(vt_sllist_t *const list) {
+    vt_sllist_pop_get_back(list);
+}
+
+void *vt_sllist_pop_get_front(vt_sllist_t *const list) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(list != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    // the element stays in place until the node is reused
+    if (list->len > 0) {
+        return vt_sllist_node_value(vt_sllist_unlink(list, list->head));
+    }
+
+    return NULL;
+}
+
+void *vt_sllist_pop_get_back(vt_sllist_t *const list) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(list != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    // the element stays in place until the node is reused
+    if (list->len > 0) {
+        return vt_sllist_node_value(vt_sllist_unlink(list, list->tail));
+    }
+
+    return NULL;
+}
+
+void vt_sllist_remove(vt_sllist_t *const list, const size_t node) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(list != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    VT_DEBUG_ASSERT(list->len > 0, "%s\n", vt_status_to_str(VT_STATUS_ERROR_OUT_OF_BOUNDS_ACCESS));
+    vt_sllist_unlink(list, (uint32_t)node);
+}
+
+bool vt_sllist_remove_element(vt_sllist_t *const list, const void *const val) {
+    const size_t node = vt_sllist_find(list, val);
+    if (node == VT_SLLIST_NIL) {
+        return false;
+    }
+
+    vt_sllist_unlink(list, (uint32_t)node);
+    return true;
+}
+
+size_t vt_sllist_find(const vt_sllist_t *const list, const void *const val) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(list != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    VT_DEBUG_ASSERT(val != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    // compare elements as bytes
+    uint32_t idx = list->head;
+    while (idx != VT_SLLIST_NIL) {
+        struct VitaSllistNode *const node = vt_sllist_node(list, idx);
+        if (memcmp(vt_sllist_node_value(node), val, list->elsize) == 0) {
+            return idx;
+        }
+        idx = node->next;
+    }
+
+    return VT_SLLIST_NIL;
+}
+
+void vt_sllist_apply(const vt_sllist_t *const list, void (*func)(void*, size_t)) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(list != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    VT_DEBUG_ASSERT(func != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    size_t i = 0;
+    for (uint32_t idx = list->head; idx != VT_SLLIST_NIL; i++) {
+        struct VitaSllistNode *const node = vt_sllist_node(list, idx);
+        idx = node->next;
+        func(vt_sllist_node_value(node), i);
+    }
+}
+
+/* ---------------------- PRIVATE FUNCTIONS ---------------------- */
+
+/** Returns a node by its index
+    @param list vt_sllist_t instance
+    @param idx node index
+    @returns pointer to the node
+*/
+static struct VitaSllistNode *vt_sllist_node(const vt_sllist_t *const list, const size_t idx) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(list != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+    VT_DEBUG_ASSERT(idx < list->count_nodes, "%s\n", vt_status_to_str(VT_STATUS_ERROR_OUT_OF_BOUNDS_ACCESS));
+
+    // block `b` starts at node `(2^b - 1) << block_shift`
+    const size_t b = vt_sllist_floor_log2((idx >> list->block_shift) + 1);
+    const size_t offset = idx - ((((size_t)1 << b) - 1) << list->block_shift);
+
+    return (struct VitaSllistNode*)(list->blocks[b] + offset * list->node_size);
+}
+
+/** Returns the element of a node
+    @param node node
+    @returns pointer to the element
+*/
+static void *vt_sllist_node_value(struct VitaSllistNode *const node) {
+    return node + 1;
+}
+
+/** Allocates the next node block, twice as big as the previous one
+    @param list vt_sllist_t instance
+*/
+static void vt_sllist_grow(vt_sllist_t *const list) {
+    // node indices are 32-bit
+    VT_ENFORCE(
+        list->count_blocks < VT_SLLIST_MAX_BLOCKS && vt_sllist_capacity(list) < VT_SLLIST_NIL,
+        "%s\n", vt_status_to_str(VT_STATUS_ERROR_OUT_OF_MEMORY)
+    );
+
+    // allocate
+    const size_t bytes = ((size_t)1 << (list->block_shift + list->count_blocks)) * list->node_size;
+    list->blocks[list->count_blocks++] = list->alloctr
+        ? VT_ALLOCATOR_ALLOC(list->alloctr, bytes)
+        : VT_CALLOC(bytes);
+}
+
+/** Takes a node from the free list or carves a new one, and copies the element into it
+    @param list vt_sllist_t instance
+    @param val value
+    @param idx node index (output)
+
+    @returns pointer to the node
+*/
+static struct VitaSllistNode *vt_sllist_node_alloc(vt_sllist_t *const list, const void *const val, uint32_t *const idx) {
+    // check for invalid input
+    VT_DEBUG_ASSERT(val != NULL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_INVALID_ARGUMENTS));
+
+    // reuse a removed node
+    struct VitaSllistNode *node = NULL;
+    *idx = list->free_list;
+    if (*idx != VT_SLLIST_NIL) {
+        node = vt_sllist_node(list, *idx);
+        list->free_list = node->next;
+    } else {
+        if (list->count_nodes == vt_sllist_capacity(list)) {
+            vt_sllist_grow(list);
+            VT_ENFORCE(list->count_nodes < VT_SLLIST_NIL, "%s\n", vt_status_to_str(VT_STATUS_ERROR_OUT_OF_MEMORY));
+        }
+        *idx = (uint32_t)list->count_nodes++;
+        node = vt_sllist_node(list, *idx);
+    }
+
+    // integer-sized elements are copied inline
+    void *const dst = vt_sllist_node_value(node);
+    switch (list->elsize) {
+        case 4:
+            memcpy(dst, val, 4);
+            break;
+        case 8:
+            memcpy(dst, val, 8);
+            break;
+        default:
+            memcpy(dst, val, list->elsize);
+            break;
+    }
+
+    return node;
+}
+
+/** Inserts an element between two adjacent nodes
+    @param list vt_sllist_t instance
+    @param val value
+    @param prev node before, VT_SLLIST_NIL at the front
+    @param next node after, VT_SLLIST_NIL at the back
+
+    @returns node index
+*/
+static uint32_t vt_sllist_link(vt_sllist_t *const list, const void *const val, const uint32_t prev, const uint32_t next) {
+    uint32_t idx = 0;
+    struct VitaSllistNode *const node = vt_sllist_node_alloc(list, val, &idx);
+
+    // link
+    node->prev = prev;
+    node->next = next;
+    if (prev == VT_SLLIST_NIL) {
+        list->head = idx;
+    } else {
+        vt_sllist_node(list, prev)->next = idx;
+    }
+    if (next == VT_SLLIST_NIL) {
+        list->tail = idx;
+    } else {
+        vt_sllist_node(list, next)->prev = idx;
+    }
+    list->len++;
+
+    return idx;
+}
+
+/** Unlinks a node and puts it on the free list, the element is kept
+    @param list vt_sllist_t instance
+    @param idx node index
+    @returns pointer to the node
+*/
+static struct VitaSllistNode *vt_sllist_unlink(vt_sllist_t *const list, const uint32_t idx) {
+    struct VitaSllistNode *const node = vt_sllist_node(list, idx);
+
+    // unlink
+    if (node->prev == VT_SLLIST_NIL) {
+        list->head = node->next;
+    } else {
+        vt_sllist_node(list, node->prev)->next = node->next;
+    }
+    if (node->next == VT_SLLIST_NIL) {
+        list->tail = node->prev;
+    } else {
+        vt_sllist_node(list, node->next)->prev = node->prev;
+    }
+    list->len--;
+
+    // recycle
+    node->next = list->free_list;
+    list->free_list = idx;
+
+    return node;
+}
+
+/** Returns the index of the highest set bit
+    @param x non-zero value
+    @returns floor(log2(x))
+*/
+static size_t vt_sllist_floor_log2(const size_t x) {
+#if defined(_MSC_VER)
+    unsigned long idx = 0;
+    _BitScanReverse64(&idx, (unsigned long long)x);
+    return (size_t)idx;
+#else
+    return (size_t)(63 - __builtin_clzll((unsigned long long)x));
+#endif
+}
@@ -7,9 +7,22 @@ rm -rf bin;
 declare -a tests=( \
     "test_core" \
     "test_mallocator" \
+    "test_arena" "test_pool" "test_tcallocator" "test_hpallocator" "test_stackallocator" \
     "test_vec" \
     "test_str" \
+    "test_search" \
+    "test_ascii" \
+    "test_matcher" \
+    "test_hash" \
+    "test_strview" \
+    "test_strbuilder" \
+    "test_intern" \
     "test_plist" \
+    "test_deque" \
+    "test_heap" \
+    "test_hashmap" \
+    "test_hashset" \
+    "test_sllist" \
     "test_span" \
     "test_path" \
     "test_fileio" \
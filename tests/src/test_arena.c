@@ -0,0 +1,101 @@
+#include <assert.h>
+#include "vita/allocator/arena.h"
+#include "vita/container/str.h"
+#include "vita/container/vec.h"
+
+int32_t main(void) {
+    vt_arena_t *arena = vt_arena_create(256, NULL);
+    struct VitaBaseAllocatorType *alloctr = &arena->base;
+
+    // allocations are zero-initialized and aligned
+    char *zbuf = VT_ALLOCATOR_ALLOC(alloctr, 10);
+    assert(((uintptr_t)zbuf % VT_ARENA_ALIGNMENT) == 0);
+    VT_FOREACH(i, 0, 10) {
+        assert(zbuf[i] == 0);
+    }
+    strcpy(zbuf, "hello");
+
+    // the last allocation is resized in place
+    char *zbuf2 = VT_ALLOCATOR_REALLOC(alloctr, zbuf, 100);
+    assert(zbuf2 == zbuf);
+    assert(vt_str_equals_z(zbuf2, "hello"));
+    assert(zbuf2[99] == 0);
+
+    // older allocations are moved
+    int32_t *val = VT_ALLOCATOR_ALLOC(alloctr, sizeof(int32_t));
+    *val = 42;
+    char *zbuf3 = VT_ALLOCATOR_REALLOC(alloctr, zbuf2, 120);
+    assert(zbuf3 != zbuf2);
+    assert(vt_str_equals_z(zbuf3, "hello"));
+    assert(*val == 42);
+
+    // free is a no-op
+    VT_ALLOCATOR_FREE(alloctr, val);
+    assert(*val == 42);
+
+    // allocations bigger than the chunk size get their own chunk
+    char *big = VT_ALLOCATOR_ALLOC(alloctr, 1024);
+    big[1023] = 'x';
+    assert(vt_arena_capacity(arena) > 1024);
+    assert(alloctr->stats.count_allocs == 3);
+    assert(alloctr->stats.count_reallocs == 2);
+    assert(alloctr->stats.count_frees == 1);
+    assert(alloctr->stats.count_bytes_allocated == 120 + 4 + 1024);
+
+    // aligned allocations keep their alignment when moved
+    char *abuf = VT_ALLOCATOR_ALLOC_ALIGNED(alloctr, 8, 64);
+    assert(((uintptr_t)abuf % 64) == 0);
+    abuf[0] = 'a';
+    VT_ALLOCATOR_ALLOC(alloctr, 1);
+    abuf = VT_ALLOCATOR_REALLOC(alloctr, abuf, 512);
+    assert(((uintptr_t)abuf % 64) == 0);
+    assert(abuf[0] == 'a' && abuf[511] == 0);
+
+    // containers can use the arena
+    const size_t capacity = vt_arena_capacity(arena);
+    VT_FOREACH(cycle, 0, 3) {
+        vt_str_t *s = vt_str_create("hello", alloctr);
+        vt_str_append(s, ", world!");
+        assert(vt_str_equals_z(vt_str_z(s), "hello, world!"));
+
+        vt_vec_t *v = vt_vec_create(4, sizeof(int32_t), alloctr);
+        VT_FOREACH(i, 0, 100) {
+            vt_vec_push_backi32(v, i);
+        }
+        assert(vt_vec_geti32(v, 99) == 99);
+
+        vt_str_destroy(s);
+        vt_vec_destroy(v);
+
+        // chunks are merged upon reset
+        vt_arena_reset(arena);
+        assert(arena->chunk->next == NULL);
+        assert(arena->chunk->offset == 0);
+        assert(alloctr->stats.count_bytes_allocated == 0);
+    }
+    assert(vt_arena_capacity(arena) >= capacity);
+
+    // containers that outlive a reset can still be freed
+    {
+        vt_str_t *s = vt_str_create("outlives the reset", alloctr);
+        vt_arena_reset(arena);
+        assert(alloctr->stats.count_objects_live == 0);
+        const size_t count_frees = alloctr->stats.count_frees;
+        vt_str_destroy(s);
+        assert(alloctr->stats.count_objects_live == 0);
+        assert(alloctr->stats.count_frees == count_frees + 1);
+
+        // stats of blocks allocated after the reset are not affected
+        void *old = VT_ALLOCATOR_ALLOC(alloctr, 32);
+        vt_arena_reset(arena);
+        VT_ALLOCATOR_ALLOC(alloctr, 8);
+        VT_ALLOCATOR_FREE(alloctr, old);
+        assert(alloctr->stats.count_objects_live == 1);
+        assert(alloctr->stats.count_bytes_allocated == 8);
+    }
+
+    vt_mallocator_print_stats(alloctr->stats);
+    vt_arena_destroy(arena);
+
+    return 0;
+}
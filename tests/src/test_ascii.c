@@ -0,0 +1,103 @@
+#include <assert.h>
+#include "vita/algorithm/ascii.h"
+
+// reference implementations
+static size_t naive_span(const char *z, size_t len, const char *chars) {
+    size_t i = 0;
+    while (i < len && z[i] && strchr(chars, z[i])) i++;
+    return i;
+}
+
+static size_t naive_span_last(const char *z, size_t len, const char *chars) {
+    size_t i = len;
+    while (i > 0 && z[i - 1] && strchr(chars, z[i - 1])) i--;
+    return len - i;
+}
+
+static size_t naive_remove(char *z, size_t len, const char *chars) {
+    size_t n = 0;
+    for (size_t i = 0; i < len; i++) {
+        if (!z[i] || !strchr(chars, z[i])) z[n++] = z[i];
+    }
+    return n;
+}
+
+int32_t main(void) {
+    // case mapping leaves everything but letters as is
+    char text[] = "Hello, World! [@`{] 0123 \xc0\xe0 abcxyz ABCXYZ";
+    vt_ascii_to_upper(text, sizeof(text) - 1);
+    assert(!strcmp(text, "HELLO, WORLD! [@`{] 0123 \xc0\xe0 ABCXYZ ABCXYZ"));
+    vt_ascii_to_lower(text, sizeof(text) - 1);
+    assert(!strcmp(text, "hello, world! [@`{] 0123 \xc0\xe0 abcxyz abcxyz"));
+
+    // sets
+    vt_ascii_set_t set;
+    vt_ascii_set_init(&set, "");
+    assert(set.count_ranges == 0);
+    assert(!vt_ascii_set_has(&set, 'a'));
+    vt_ascii_set_init(&set, "cabba\xff");
+    assert(set.count_ranges == 2);
+    assert(set.lo[0] == 'a' && set.width[0] == 2);
+    assert(vt_ascii_set_has(&set, 'c') && vt_ascii_set_has(&set, '\xff') && !vt_ascii_set_has(&set, 'd'));
+
+    // predefined sets are the same as the initialized ones
+    vt_ascii_set_init(&set, VT_ASCII_SPACE);
+    assert(!memcmp(&set, vt_ascii_set_space(), sizeof(set)));
+    vt_ascii_set_init(&set, VT_ASCII_SPACE VT_ASCII_PUNCT);
+    assert(!memcmp(&set, vt_ascii_set_space_punct(), sizeof(set)));
+    VT_FOREACH(c, 1, 256) {
+        assert(vt_ascii_set_has(vt_ascii_set_space(), (char)c) == !!isspace((int32_t)c));
+        assert(vt_ascii_set_has(vt_ascii_set_space_punct(), (char)c) == (isspace((int32_t)c) || ispunct((int32_t)c)));
+    }
+
+    // random data of every length up to a few blocks, compared with the reference implementations
+    const char *const sets[] = { " ", VT_ASCII_SPACE, VT_ASCII_SPACE VT_ASCII_PUNCT, "abcdefghijklmnopqrstuvwxyz", "aceg-ikmoqsuwy0", "\x80\xff" };
+    const char alphabet[] = " \t\n.,;!-aAbBzZ{}@`[]09\x80\xff";
+    char buf[200], expected[200];
+    srand(17);
+    VT_FOREACH(iter, 0, 20000) {
+        const char *const chars = sets[rand() % (sizeof(sets)/sizeof(sets[0]))];
+        const size_t len = (size_t)(rand() % 130);
+        const size_t offset = (size_t)(rand() % 16);
+        char *const z = buf + offset;
+
+        // runs of members at both ends, so spans cross block boundaries
+        const size_t lead = (size_t)(rand() % (len + 1));
+        const size_t trail = (size_t)(rand() % (len - lead + 1));
+        VT_FOREACH(i, 0, len) {
+            const bool edge = i < lead || i >= len - trail;
+            z[i] = edge ? chars[rand() % strlen(chars)] : alphabet[rand() % (sizeof(alphabet) - 1)];
+        }
+
+        vt_ascii_set_init(&set, chars);
+        assert(vt_ascii_span(z, len, &set) == naive_span(z, len, chars));
+        assert(vt_ascii_span_last(z, len, &set) == naive_span_last(z, len, chars));
+
+        // remove
+        memcpy(expected, z, len);
+        const size_t n = naive_remove(expected, len, chars);
+        z[len] = '#';
+        assert(vt_ascii_remove(z, len, &set) == n);
+        assert(!memcmp(z, expected, n));
+
+        // replace with the next byte value
+        char map[256];
+        VT_FOREACH(c, 0, 256) map[c] = (char)(c + 1);
+        memcpy(expected, z, n);
+        VT_FOREACH(i, 0, n) if (vt_ascii_set_has(&set, expected[i])) expected[i] = map[(uint8_t)expected[i]];
+        vt_ascii_replace(z, n, &set, map);
+        assert(!memcmp(z, expected, n));
+
+        // case mapping
+        memcpy(expected, z, n);
+        VT_FOREACH(i, 0, n) if (expected[i] >= 'a' && expected[i] <= 'z') expected[i] -= 32;
+        vt_ascii_to_upper(z, n);
+        assert(!memcmp(z, expected, n));
+        VT_FOREACH(i, 0, n) if (expected[i] >= 'A' && expected[i] <= 'Z') expected[i] += 32;
+        vt_ascii_to_lower(z, n);
+        assert(!memcmp(z, expected, n));
+        assert(z[len] == '#');
+    }
+
+    return 0;
+}
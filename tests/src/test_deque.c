@@ -0,0 +1,123 @@
+#include <assert.h>
+#include "vita/container/vec.h"
+#include "vita/container/deque.h"
+
+static int32_t sum = 0;
+static void add(void *ptr, size_t i) {
+    sum += *(int32_t*)ptr * (int32_t)(i + 1);
+}
+
+int32_t main(void) {
+    vt_mallocator_t *alloctr = vt_mallocator_create();
+
+    // push and pop at both ends
+    {
+        vt_deque_t *d = vt_deque_create(3, sizeof(int32_t), alloctr);
+        assert(vt_deque_is_empty(d));
+        assert(vt_deque_capacity(d) == 4);
+        assert(vt_deque_pop_get_front(d) == NULL && vt_deque_pop_get_back(d) == NULL);
+
+        // 2 1 0 | 0 1 2: the front wraps around to the end of the buffer
+        VT_FOREACH(i, 0, 3) {
+            vt_deque_push_fronti32(d, (int32_t)i);
+            vt_deque_push_backi32(d, (int32_t)i);
+        }
+        assert(vt_deque_len(d) == 6);
+        assert(vt_deque_capacity(d) == 8);
+        assert(vt_deque_geti32(d, 0) == 2 && vt_deque_geti32(d, 2) == 0 && vt_deque_geti32(d, 5) == 2);
+
+        // apply: 2*1 + 1*2 + 0*3 + 0*4 + 1*5 + 2*6
+        vt_deque_apply(d, add);
+        assert(sum == 21);
+
+        // set
+        vt_deque_seti32(d, 7, 2);
+        assert(*(int32_t*)vt_deque_get(d, 2) == 7);
+
+        assert(vt_deque_pop_get_fronti32(d) == 2);
+        assert(vt_deque_pop_get_backi32(d) == 2);
+        vt_deque_pop_front(d);
+        vt_deque_pop_back(d);
+        assert(vt_deque_len(d) == 2);
+        assert(vt_deque_pop_get_fronti32(d) == 7);
+        assert(vt_deque_pop_get_backi32(d) == 0);
+        assert(vt_deque_is_empty(d));
+        assert(vt_deque_pop_get_fronti32(d) == 0);
+
+        vt_deque_destroy(d);
+    }
+
+    // FIFO churn with growth while wrapped around; compare against a vector
+    {
+        vt_deque_t *d = vt_deque_create(1, sizeof(double), alloctr);
+        vt_vec_t *v = vt_vec_create(16, sizeof(double), alloctr);
+        uint32_t seed = 1;
+        VT_FOREACH(i, 0, 100000) {
+            seed = seed * 1103515245 + 12345;
+            const size_t op = (seed >> 16) % 5;
+            if (op < 3 || vt_vec_len(v) == 0) {
+                vt_deque_push_backd(d, (double)i);
+                vt_vec_push_backd(v, (double)i);
+            } else if (op == 3) {
+                assert(vt_deque_pop_get_frontd(d) == vt_vec_getd(v, 0));
+                vt_vec_remove(v, 0, VT_REMOVE_STRATEGY_STABLE);
+            } else {
+                assert(vt_deque_pop_get_backd(d) == vt_vec_pop_getd(v));
+            }
+            assert(vt_deque_len(d) == vt_vec_len(v));
+        }
+        VT_FOREACH(i, 0, vt_vec_len(v)) {
+            assert(vt_deque_getd(d, i) == vt_vec_getd(v, i));
+        }
+
+        vt_vec_destroy(v);
+        vt_deque_destroy(d);
+    }
+
+    // bulk copies and spans
+    {
+        vt_deque_t *d = vt_deque_create(8, sizeof(int32_t), alloctr);
+        const int32_t a[6] = { 0, 1, 2, 3, 4, 5 };
+
+        // wrap around: 4 5 | 0 1 2 3 at buffer index 6
+        vt_deque_push_back_n(d, a, 6);
+        assert(vt_deque_pop_front_n(d, NULL, 6) == 6);
+        vt_deque_push_back_n(d, a, 6);
+        assert(d->head == 6 && vt_deque_capacity(d) == 8);
+
+        vt_span_t first, second;
+        vt_deque_spans(d, &first, &second);
+        assert(vt_span_len(first) == 2 && vt_span_len(second) == 4);
+        assert(vt_span_geti32(first, 0) == 0 && vt_span_geti32(second, 0) == 2);
+
+        // pop into an array across the wrap
+        int32_t out[16] = {0};
+        assert(vt_deque_pop_front_n(d, out, 4) == 4);
+        assert(memcmp(out, a, 4 * sizeof(int32_t)) == 0);
+
+        // grow while wrapped: 4 5 + 0..5 twice
+        vt_deque_push_back_n(d, a, 6);
+        vt_deque_push_back_n(d, a, 6);
+        assert(vt_deque_len(d) == 14 && vt_deque_capacity(d) == 16);
+        assert(vt_deque_geti32(d, 0) == 4 && vt_deque_geti32(d, 2) == 0 && vt_deque_geti32(d, 13) == 5);
+        assert(vt_deque_pop_front_n(d, out, 100) == 14);
+        assert(vt_deque_is_empty(d));
+
+        // empty spans
+        vt_deque_spans(d, &first, &second);
+        assert(vt_span_len(first) == 0 && vt_span_len(second) == 0);
+
+        // clear and reserve
+        vt_deque_push_fronti32(d, 1);
+        vt_deque_clear(d);
+        assert(vt_deque_is_empty(d));
+        vt_deque_reserve(d, 20);
+        assert(vt_deque_capacity(d) == 64);
+
+        vt_deque_destroy(d);
+    }
+
+    assert(alloctr->stats.count_allocs == alloctr->stats.count_frees);
+    vt_mallocator_destroy(alloctr);
+    return 0;
+}
@@ -0,0 +1,67 @@
+#include <assert.h>
+#include "vita/algorithm/hash.h"
+
+int32_t main(void) {
+    // reference XXH64 values
+    assert(vt_hash("", 0, 0) == 0xef46db3751d8e999ULL);
+    assert(vt_hash("a", 1, 0) == 0xd24ec4f1a98c6e5bULL);
+    assert(vt_hash("abc", 3, 0) == 0x44bc2cf5ad770999ULL);
+    assert(vt_hash("xxhash", 6, 0) == 0x32dd38952c4bc720ULL);
+    assert(vt_hash("xxhash", 6, 20141025) == 0xb559b98d844e0635ULL);
+    assert(vt_hash_z("Nobody inspects the spammish repetition", 0) == 0xfbcea83c8a378bf1ULL);
+
+    // strings
+    vt_str_t *s = vt_str_create("Nobody inspects the spammish repetition", NULL);
+    {
+        assert(vt_hash_str(s, 0) == 0xfbcea83c8a378bf1ULL);
+        assert(vt_hash_str(s, 1) != vt_hash_str(s, 0));
+
+        vt_str_t sv = vt_str_create_static("xxhash");
+        assert(vt_hash_str(&sv, 20141025) == 0xb559b98d844e0635ULL);
+    }
+    vt_str_destroy(s);
+
+    // incremental hashing gives the same values for any chunking
+    {
+        uint8_t data[1000];
+        VT_FOREACH(i, 0, sizeof(data)) {
+            data[i] = (uint8_t)(rand() & 0xff);
+        }
+
+        VT_FOREACH(round, 0, 500) {
+            const size_t len = (size_t)rand() % sizeof(data);
+            const uint64_t seed = (uint64_t)rand();
+
+            vt_hash_state_t state;
+            vt_hash_init(&state, seed);
+            for (size_t at = 0; at < len;) {
+                size_t n = (size_t)(rand() % 70);
+                n = n < len - at ? n : len - at;
+                vt_hash_update(&state, data + at, n);
+                at += n;
+
+                // digest does not end the stream
+                assert(vt_hash_digest(&state) == vt_hash(data, at, seed));
+            }
+            assert(vt_hash_digest(&state) == vt_hash(data, len, seed));
+        }
+    }
+
+    // integers: consecutive values spread evenly over the low bits
+    {
+        enum { BUCKETS = 256, COUNT = 256 * 1000 };
+        size_t buckets32[BUCKETS] = {0}, buckets64[BUCKETS] = {0};
+        VT_FOREACH(i, 0, COUNT) {
+            buckets32[vt_hash_u32((uint32_t)i, 0) % BUCKETS]++;
+            buckets64[vt_hash_u64((uint64_t)i << 32, 0) % BUCKETS]++;
+        }
+        VT_FOREACH(i, 0, BUCKETS) {
+            assert(buckets32[i] > 850 && buckets32[i] < 1150);
+            assert(buckets64[i] > 850 && buckets64[i] < 1150);
+        }
+        assert(vt_hash_u64(42, 0) != vt_hash_u64(42, 1));
+        assert(vt_hash_u32(42, 7) == vt_hash_u32(42, 7));
+    }
+
+    return 0;
+}
@@ -0,0 +1,167 @@
+#include <assert.h>
+#include "vita/experimental/hashmap.h"
+
+// 12-byte key, compared as bytes
+typedef struct Point {
+    int32_t x, y, z;
+} point_t;
+
+int32_t main(void) {
+    vt_mallocator_t *alloctr = vt_mallocator_create();
+
+    // integer keys against a plain array of values
+    {
+        enum { N = 20000 };
+        static int64_t ref[N];
+        static bool present[N];
+
+        vt_hashmap_t *map = vt_hashmap_create(1, sizeof(uint64_t), sizeof(int64_t), alloctr);
+        assert(vt_hashmap_is_empty(map));
+        assert(vt_hashmap_capacity(map) == VT_HASHMAP_MIN_CAPACITY);
+
+        size_t count = 0;
+        VT_FOREACH(round, 0, 200000) {
+            const uint64_t key = (uint64_t)rand() % N;
+            const int64_t val = rand();
+            switch (rand() % 3) {
+                case 0: {
+                    const int64_t *v = vt_hashmap_insert(map, &key, &val);
+                    assert(*v == val);
+                    count += !present[key];
+                    present[key] = true;
+                    ref[key] = val;
+                    break;
+                }
+                case 1: {
+                    assert(vt_hashmap_remove(map, &key) == present[key]);
+                    count -= present[key];
+                    present[key] = false;
+                    break;
+                }
+                default: {
+                    const int64_t *v = vt_hashmap_get(map, &key);
+                    assert((v != NULL) == present[key]);
+                    assert(v == NULL || *v == ref[key]);
+                    break;
+                }
+            }
+            assert(vt_hashmap_len(map) == count);
+        }
+
+        // iterate
+        size_t seen = 0;
+        const uint64_t *key;
+        int64_t *val;
+        vt_hashmap_iter_t it = vt_hashmap_iter(map);
+        while (vt_hashmap_next(&it, (const void**)&key, (void**)&val)) {
+            assert(present[*key] && ref[*key] == *val);
+            seen++;
+        }
+        assert(seen == count);
+
+        // all the same after a rehash at a higher load factor
+        vt_hashmap_set_max_load(map, 0.95);
+        vt_hashmap_reserve(map, 4 * N);
+        assert(vt_hashmap_len(map) == count);
+        VT_FOREACH(k, 0, N) {
+            const uint64_t kk = k;
+            assert(vt_hashmap_has(map, &kk) == present[k]);
+        }
+
+        // clear
+        vt_hashmap_clear(map);
+        assert(vt_hashmap_is_empty(map));
+        it = vt_hashmap_iter(map);
+        assert(!vt_hashmap_next(&it, NULL, NULL));
+
+        vt_hashmap_destroy(map);
+    }
+
+    // byte keys, NULL values
+    {
+        vt_hashmap_t *map = vt_hashmap_create(100, sizeof(point_t), sizeof(double), alloctr);
+        VT_FOREACH(i, 0, 1000) {
+            const point_t p = { (int32_t)i, -(int32_t)i, 7 };
+            double *v = vt_hashmap_insert(map, &p, NULL);
+            assert(*v == 0);
+            *v = (double)i / 2;
+        }
+        assert(vt_hashmap_len(map) == 1000);
+
+        const point_t p = { 10, -10, 7 }, q = { 10, 10, 7 };
+        assert(*(double*)vt_hashmap_get(map, &p) == 5);
+        assert(vt_hashmap_get(map, &q) == NULL);
+        assert(*(double*)vt_hashmap_insert(map, &p, NULL) == 5);
+        vt_hashmap_destroy(map);
+    }
+
+    // string keys
+    {
+        vt_hashmap_t *map = vt_hashmap_create(8, VT_HASHMAP_KEY_STR, sizeof(size_t), alloctr);
+
+        // word count
+        vt_str_t *text = vt_str_create("the cat and the dog and the bird", alloctr);
+        vt_plist_t *words = vt_str_split(NULL, text, " ");
+        const size_t one = 1;
+        VT_FOREACH(i, 0, vt_plist_len(words)) {
+            vt_str_t *w = vt_plist_get(words, i);
+            size_t *c = vt_hashmap_get(map, w);
+            if (c) {
+                (*c)++;
+            } else {
+                vt_hashmap_insert(map, w, &one);
+            }
+            vt_str_destroy(w);
+        }
+        vt_plist_destroy(words);
+        vt_str_destroy(text);
+
+        assert(vt_hashmap_len(map) == 5);
+        assert(*(size_t*)vt_hashmap_get_z(map, "the") == 3);
+        assert(*(size_t*)vt_hashmap_get_z(map, "and") == 2);
+        assert(*(size_t*)vt_hashmap_get_z(map, "bird") == 1);
+        assert(vt_hashmap_get_z(map, "fish") == NULL);
+
+        // keys are copies
+        const vt_str_t *key;
+        vt_hashmap_iter_t it = vt_hashmap_iter(map);
+        size_t total = 0;
+        while (vt_hashmap_next(&it, (const void**)&key, NULL)) {
+            total += *(size_t*)vt_hashmap_get(map, key);
+            assert(vt_str_len(key) == strlen(vt_str_z(key)));
+        }
+        assert(total == 8);
+
+        // the empty string is a key too
+        vt_hashmap_insert_z(map, "", &one);
+        assert(vt_hashmap_get_z(map, "") != NULL);
+        assert(vt_hashmap_remove_z(map, "the"));
+        assert(!vt_hashmap_remove_z(map, "the"));
+        assert(vt_hashmap_len(map) == 5);
+
+        // many keys, half of them removed
+        char buf[32];
+        VT_FOREACH(i, 0, 10000) {
+            snprintf(buf, sizeof(buf), "key-%zu", i);
+            vt_hashmap_insert_z(map, buf, &i);
+        }
+        VT_FOREACH(i, 0, 10000) {
+            if (i % 2) {
+                snprintf(buf, sizeof(buf), "key-%zu", i);
+                assert(vt_hashmap_remove_z(map, buf));
+            }
+        }
+        VT_FOREACH(i, 0, 10000) {
+            snprintf(buf, sizeof(buf), "key-%zu", i);
+            const size_t *v = vt_hashmap_get_z(map, buf);
+            assert(i % 2 ? v == NULL : *v == i);
+        }
+        assert(vt_hashmap_len(map) == 5 + 5000);
+
+        vt_hashmap_destroy(map);
+    }
+
+    assert(alloctr->stats.count_allocs == alloctr->stats.count_frees);
+    vt_mallocator_destroy(alloctr);
+    return 0;
+}
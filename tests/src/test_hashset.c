@@ -0,0 +1,135 @@
+#include <assert.h>
+#include "vita/experimental/hashset.h"
+
+int32_t main(void) {
+    vt_mallocator_t *alloctr = vt_mallocator_create();
+
+    // integers
+    {
+        vt_hashset_t *set = vt_hashset_create(0, sizeof(int32_t), alloctr);
+        assert(vt_hashset_is_empty(set));
+        assert(vt_hashset_bytes_per_element(set) == 0);
+
+        const int32_t a = 1, b = 2;
+        assert(vt_hashset_insert(set, &a));
+        assert(!vt_hashset_insert(set, &a));
+        assert(vt_hashset_has(set, &a));
+        assert(!vt_hashset_has(set, &b));
+        assert(vt_hashset_len(set) == 1);
+        assert(vt_hashset_remove(set, &a));
+        assert(!vt_hashset_remove(set, &a));
+        assert(vt_hashset_is_empty(set));
+
+        // bulk insert with duplicates: 0..9999, each twice
+        vt_vec_t *v = vt_vec_create(20000, sizeof(int32_t), alloctr);
+        VT_FOREACH(i, 0, 20000) {
+            const int32_t x = (int32_t)(i % 10000);
+            vt_vec_push_back(v, &x);
+        }
+        assert(vt_hashset_insert_vec(set, v) == 10000);
+        assert(vt_hashset_insert_vec(set, v) == 0);
+        assert(vt_hashset_len(set) == 10000);
+
+        // a slot is 4 bytes of element and 4 of metadata
+        const double bpe = vt_hashset_bytes_per_element(set);
+        assert(bpe >= 8 / VT_HASHMAP_DEFAULT_MAX_LOAD && bpe <= 2 * 8 / VT_HASHMAP_DEFAULT_MAX_LOAD + 1);
+
+        // iterate
+        size_t sum = 0;
+        const int32_t *el;
+        vt_hashset_iter_t it = vt_hashset_iter(set);
+        while (vt_hashset_next(&it, (const void**)&el)) {
+            sum += (size_t)*el;
+        }
+        assert(sum == 9999 * 10000 / 2);
+
+        // odd numbers and multiples of 3
+        vt_hashset_t *odd = vt_hashset_create(0, sizeof(int32_t), alloctr);
+        vt_hashset_t *three = vt_hashset_create(0, sizeof(int32_t), alloctr);
+        VT_FOREACH(i, 0, 10000) {
+            const int32_t x = (int32_t)i;
+            if (x % 2) {
+                vt_hashset_insert(odd, &x);
+            }
+            if (x % 3 == 0) {
+                vt_hashset_insert(three, &x);
+            }
+        }
+
+        // intersection
+        vt_hashset_intersect(set, odd);
+        assert(vt_hashset_len(set) == 5000);
+        vt_hashset_intersect(set, three);
+        assert(vt_hashset_len(set) == 1667);
+        VT_FOREACH(i, 0, 10000) {
+            const int32_t x = (int32_t)i;
+            assert(vt_hashset_has(set, &x) == (x % 2 && x % 3 == 0));
+        }
+
+        // union
+        vt_hashset_union(set, three);
+        vt_hashset_union(set, set);
+        assert(vt_hashset_len(set) == 3334);
+        VT_FOREACH(i, 0, 10000) {
+            const int32_t x = (int32_t)i;
+            assert(vt_hashset_has(set, &x) == (x % 3 == 0));
+        }
+
+        // clear
+        vt_hashset_clear(set);
+        assert(vt_hashset_is_empty(set));
+        vt_hashset_intersect(set, odd);
+        assert(vt_hashset_is_empty(set));
+
+        vt_hashset_destroy(three);
+        vt_hashset_destroy(odd);
+        vt_vec_destroy(v);
+        vt_hashset_destroy(set);
+    }
+
+    // strings
+    {
+        vt_hashset_t *set = vt_hashset_create(8, VT_HASHSET_STR, alloctr);
+
+        vt_str_t *line = vt_str_create("red green blue red red blue", alloctr);
+        vt_plist_t *words = vt_str_split(NULL, line, " ");
+        assert(vt_hashset_insert_plist(set, words) == 3);
+        VT_FOREACH(i, 0, vt_plist_len(words)) {
+            vt_str_destroy(vt_plist_get(words, i));
+        }
+        vt_plist_destroy(words);
+        vt_str_destroy(line);
+
+        assert(vt_hashset_has_z(set, "green"));
+        assert(!vt_hashset_has_z(set, "yellow"));
+        assert(vt_hashset_insert_z(set, "yellow"));
+        assert(!vt_hashset_insert_z(set, "red"));
+        vt_str_t s = vt_str_create_static("blue");
+        assert(vt_hashset_has(set, &s));
+
+        // table plus 4 strings
+        assert(vt_hashset_memory(set) > 4 * sizeof(vt_str_t) + strlen("redgreenblueyellow"));
+
+        // warm colors
+        vt_hashset_t *warm = vt_hashset_create(8, VT_HASHSET_STR, alloctr);
+        vt_hashset_insert_z(warm, "red");
+        vt_hashset_insert_z(warm, "yellow");
+        vt_hashset_insert_z(warm, "orange");
+
+        vt_hashset_intersect(set, warm);
+        assert(vt_hashset_len(set) == 2);
+        assert(vt_hashset_has_z(set, "red") && vt_hashset_has_z(set, "yellow"));
+
+        vt_hashset_union(set, warm);
+        assert(vt_hashset_len(set) == 3);
+        assert(vt_hashset_remove_z(set, "orange"));
+        assert(!vt_hashset_has_z(set, "orange"));
+
+        vt_hashset_destroy(warm);
+        vt_hashset_destroy(set);
+    }
+
+    assert(alloctr->stats.count_allocs == alloctr->stats.count_frees);
+    vt_mallocator_destroy(alloctr);
+    return 0;
+}
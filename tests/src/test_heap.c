@@ -0,0 +1,184 @@
+#include <assert.h>
+#include "vita/container/vec.h"
+#include "vita/container/heap.h"
+
+struct Timer {
+    int64_t deadline;
+    int32_t id;
+};
+
+static int32_t timer_cmp(const void *a, const void *b) {
+    const int64_t x = ((const struct Timer*)a)->deadline;
+    const int64_t y = ((const struct Timer*)b)->deadline;
+    return (x > y) - (x < y);
+}
+
+static int32_t cmp_i32(const void *a, const void *b) {
+    const int32_t x = *(const int32_t*)a;
+    const int32_t y = *(const int32_t*)b;
+    return (x > y) - (x < y);
+}
+
+int32_t main(void) {
+    vt_mallocator_t *alloctr = vt_mallocator_create();
+
+    // numeric heaps: pop in sorted order
+    {
+        vt_heap_t *hmin = vt_heap_createi32(0, VT_HEAP_ORDER_MIN, alloctr);
+        vt_heap_t *hmax = vt_heap_createi32(4, VT_HEAP_ORDER_MAX, alloctr);
+        assert(vt_heap_is_empty(hmin));
+        assert(vt_heap_peek(hmin) == NULL && vt_heap_pop_get(hmin) == NULL);
+        assert(vt_heap_peeki32(hmax) == 0);
+
+        uint32_t seed = 7;
+        VT_FOREACH(i, 0, 1000) {
+            seed = seed * 1103515245 + 12345;
+            const int32_t val = (int32_t)((seed >> 16) % 500) - 250;
+            assert(vt_heap_pushi32(hmin, val) == VT_HEAP_NO_HANDLE);
+            vt_heap_pushi32(hmax, val);
+        }
+        assert(vt_heap_len(hmin) == 1000 && vt_heap_len(hmax) == 1000);
+
+        int32_t prev_min = INT32_MIN, prev_max = INT32_MAX;
+        VT_FOREACH(i, 0, 1000) {
+            assert(vt_heap_peeki32(hmin) >= prev_min);
+            prev_min = vt_heap_pop_geti32(hmin);
+            const int32_t val = vt_heap_pop_geti32(hmax);
+            assert(val <= prev_max);
+            prev_max = val;
+        }
+        assert(vt_heap_is_empty(hmin) && vt_heap_is_empty(hmax));
+
+        vt_heap_destroy(hmin);
+        vt_heap_destroy(hmax);
+    }
+
+    // heapify and top-k with replace
+    {
+        vt_vec_t *v = vt_vec_create(100, sizeof(double), alloctr);
+        VT_FOREACH(i, 0, 100) {
+            vt_vec_push_backd(v, (double)((i * 37) % 100));
+        }
+
+        vt_heap_t *h = vt_heap_created(1, VT_HEAP_ORDER_MAX, alloctr);
+        vt_heap_heapify(h, v);
+        assert(vt_heap_len(h) == 100);
+        VT_FOREACH(i, 0, 100) {
+            assert(vt_heap_pop_getd(h) == (double)(99 - i));
+        }
+
+        // keep the 5 largest values, the smallest of them on top
+        vt_heap_t *top = vt_heap_created(5, VT_HEAP_ORDER_MIN, alloctr);
+        VT_FOREACH(i, 0, vt_vec_len(v)) {
+            const double val = vt_vec_getd(v, i);
+            if (vt_heap_len(top) < 5) {
+                vt_heap_pushd(top, val);
+            } else if (val > vt_heap_peekd(top)) {
+                vt_heap_replace(top, &val);
+            }
+        }
+        VT_FOREACH(i, 0, 5) {
+            assert(vt_heap_pop_getd(top) == (double)(95 + i));
+        }
+
+        vt_heap_destroy(top);
+        vt_heap_destroy(h);
+        vt_vec_destroy(v);
+    }
+
+    // comparator heap of structs with handles
+    {
+        vt_heap_t *timers = vt_heap_create(2, sizeof(struct Timer), timer_cmp, alloctr);
+        vt_heap_enable_handles(timers);
+
+        size_t handles[10] = {0};
+        VT_FOREACH(i, 0, 10) {
+            const struct Timer t = { .deadline = (int64_t)(i * 10), .id = (int32_t)i };
+            handles[i] = vt_heap_push(timers, &t);
+            assert(handles[i] == i);
+        }
+        assert(((struct Timer*)vt_heap_peek(timers))->id == 0);
+        assert(((struct Timer*)vt_heap_get(timers, handles[7]))->deadline == 70);
+
+        // reschedule: 9 goes first, 0 goes last
+        struct Timer t = { .deadline = -1, .id = 9 };
+        vt_heap_update(timers, handles[9], &t);
+        t = (struct Timer) { .deadline = 1000, .id = 0 };
+        vt_heap_update(timers, handles[0], &t);
+        assert(((struct Timer*)vt_heap_peek(timers))->id == 9);
+
+        // cancel 5
+        vt_heap_remove(timers, handles[5]);
+        assert(vt_heap_len(timers) == 9);
+
+        // handles stay valid while other elements move
+        VT_FOREACH(i, 0, 10) {
+            if (i != 5) {
+                assert(((struct Timer*)vt_heap_get(timers, handles[i]))->id == (int32_t)i);
+            }
+        }
+
+        // released handles are reused
+        assert(((struct Timer*)vt_heap_pop_get(timers))->id == 9);
+        t = (struct Timer) { .deadline = 15, .id = 42 };
+        const size_t handle = vt_heap_push(timers, &t);
+        assert(handle == handles[9] || handle == handles[5]);
+
+        const int32_t expected[] = { 1, 42, 2, 3, 4, 6, 7, 8, 0 };
+        VT_FOREACH(i, 0, 9) {
+            assert(((struct Timer*)vt_heap_pop_get(timers))->id == expected[i]);
+        }
+        assert(vt_heap_is_empty(timers));
+
+        vt_heap_destroy(timers);
+    }
+
+    // random updates and removals with handles against the sorted order
+    {
+        vt_heap_t *h = vt_heap_createi32(0, VT_HEAP_ORDER_MIN, alloctr);
+        vt_heap_enable_handles(h);
+
+        vt_vec_t *v = vt_vec_create(500, sizeof(int32_t), alloctr);
+        VT_FOREACH(i, 0, 500) {
+            vt_vec_push_backi32(v, (int32_t)((i * 7919) % 1000));
+        }
+        vt_heap_heapify(h, v);
+
+        uint32_t seed = 3;
+        VT_FOREACH(i, 0, 200) {
+            seed = seed * 1103515245 + 12345;
+            const size_t handle = (seed >> 16) % 500;
+            const int32_t val = (int32_t)((seed >> 8) % 1000);
+            vt_heap_update(h, handle, &val);
+            vt_vec_seti32(v, val, handle);
+        }
+        VT_FOREACH(i, 0, 100) {
+            vt_heap_remove(h, i * 5);
+            vt_vec_seti32(v, INT32_MAX, i * 5);
+        }
+        VT_FOREACH(i, 0, 500) {
+            if (i % 5) {
+                assert(*(int32_t*)vt_heap_get(h, i) == vt_vec_geti32(v, i));
+            }
+        }
+
+        qsort(v->ptr, vt_vec_len(v), sizeof(int32_t), cmp_i32);
+        VT_FOREACH(i, 0, 400) {
+            assert(vt_heap_pop_geti32(h) == vt_vec_geti32(v, i));
+        }
+        assert(vt_heap_is_empty(h));
+
+        // clear releases all handles
+        vt_heap_pushi32(h, 1);
+        vt_heap_clear(h);
+        assert(vt_heap_pushi32(h, 2) == 0);
+        vt_heap_reserve(h, 100);
+
+        vt_vec_destroy(v);
+        vt_heap_destroy(h);
+    }
+
+    assert(alloctr->stats.count_allocs == alloctr->stats.count_frees);
+    vt_mallocator_destroy(alloctr);
+    return 0;
+}
@@ -0,0 +1,95 @@
+#include <assert.h>
+#include "vita/allocator/hpallocator.h"
+#include "vita/container/str.h"
+#include "vita/container/vec.h"
+
+#define MB (1024 * 1024)
+
+int32_t main(void) {
+    vt_hpallocator_t *hp = vt_hpallocator_create(VT_HPALLOCATOR_DEFAULT_THRESHOLD);
+    struct VitaBaseAllocatorType *alloctr = &hp->base;
+
+    // small blocks come from the heap and are aligned
+    char *small = VT_ALLOCATOR_ALLOC(alloctr, 100);
+    assert(((uintptr_t)small % VT_HPALLOCATOR_ALIGNMENT) == 0);
+    assert(small[99] == 0);
+    assert(hp->blocks->map_len == 0);
+    strcpy(small, "hello");
+
+    // large blocks are mapped and aligned
+    char *big = VT_ALLOCATOR_ALLOC_ALIGNED(alloctr, 4 * MB, 32);
+    assert(((uintptr_t)big % VT_HPALLOCATOR_ALIGNMENT) == 0);
+    assert(hp->blocks->map_len >= 4 * MB);
+    assert(big[0] == 0 && big[4 * MB - 1] == 0);
+    big[0] = 'a';
+    big[4 * MB - 1] = 'z';
+
+    // grow and shrink the mapping
+    big = VT_ALLOCATOR_REALLOC(alloctr, big, 9 * MB);
+    assert(big[0] == 'a' && big[4 * MB - 1] == 'z');
+    assert(big[4 * MB] == 0 && big[9 * MB - 1] == 0);
+    big = VT_ALLOCATOR_REALLOC(alloctr, big, 3 * MB);
+    assert(big[0] == 'a');
+    big[3 * MB - 1] = 'x';
+    big = VT_ALLOCATOR_REALLOC(alloctr, big, 3 * MB + 1);
+    assert(big[3 * MB - 1] == 'x' && big[3 * MB] == 0);
+
+    // mappings grow in place within their pages, heap blocks do not
+    assert(!VT_ALLOCATOR_EXPAND(alloctr, small, 200));
+    assert(VT_ALLOCATOR_EXPAND(alloctr, big, 3 * MB + 2));
+    assert(big[3 * MB - 1] == 'x' && big[3 * MB + 1] == 0);
+    big = VT_ALLOCATOR_REALLOC(alloctr, big, 3 * MB + 1);
+
+    // heap blocks move to a mapping when they cross the threshold
+    small = VT_ALLOCATOR_REALLOC(alloctr, small, 3 * MB);
+    assert(vt_str_equals_z(small, "hello"));
+    assert(((uintptr_t)small % VT_HPALLOCATOR_ALIGNMENT) == 0);
+
+    // stats
+    assert(alloctr->stats.count_allocs == 2);
+    assert(alloctr->stats.count_reallocs == 6);
+    assert(alloctr->stats.count_bytes_allocated == 6 * MB + 1);
+    assert(alloctr->stats.count_bytes_peak == 9 * MB + 100);
+
+    VT_ALLOCATOR_FREE(alloctr, big);
+    VT_ALLOCATOR_FREE(alloctr, small);
+    assert(hp->blocks == NULL);
+    assert(alloctr->stats.count_bytes_allocated == 0);
+
+    // mappings stay aligned to the huge page size when they move to grow
+    {
+        char *grown = VT_ALLOCATOR_ALLOC(alloctr, 3 * MB);
+        void *blockers[8] = {0};
+        VT_FOREACH(i, 0, 8) {
+            // take the address range after the mapping, so it cannot grow in place
+            blockers[i] = VT_ALLOCATOR_ALLOC(alloctr, 3 * MB);
+            grown[(3 + i) * MB - 1] = (char)('a' + i);
+            grown = VT_ALLOCATOR_REALLOC(alloctr, grown, (4 + i) * MB + 4096 * i);
+            assert(((uintptr_t)(grown - VT_HPALLOCATOR_ALIGNMENT) % VT_HPALLOCATOR_HUGE_PAGE_SIZE) == 0);
+            VT_FOREACH(j, 0, i + 1) {
+                assert(grown[(3 + j) * MB - 1] == (char)('a' + j));
+            }
+        }
+        VT_ALLOCATOR_FREE(alloctr, grown);
+        VT_FOREACH(i, 0, 8) {
+            VT_ALLOCATOR_FREE(alloctr, blockers[i]);
+        }
+        assert(hp->blocks == NULL);
+    }
+
+    // aligned vector keeps its alignment while growing past the threshold
+    vt_vec_t *v = vt_vec_create_aligned(16, sizeof(float), 64, alloctr);
+    VT_FOREACH(i, 0, 1024 * 1024) {
+        vt_vec_push_backf(v, (float)i);
+        assert(((uintptr_t)v->ptr % 64) == 0);
+    }
+    assert(vt_vec_getf(v, 1024 * 1024 - 1) == (float)(1024 * 1024 - 1));
+    vt_vec_destroy(v);
+
+    // blocks left allocated are freed upon destruction
+    VT_ALLOCATOR_ALLOC(alloctr, 3 * MB);
+    VT_ALLOCATOR_ALLOC(alloctr, 10);
+    vt_hpallocator_destroy(hp);
+
+    return 0;
+}
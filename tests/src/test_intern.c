@@ -0,0 +1,97 @@
+#include <assert.h>
+#include "vita/container/intern.h"
+
+int32_t main(void) {
+    vt_mallocator_t *alloctr = vt_mallocator_create();
+
+    // same contents, same pointer
+    vt_intern_t *in = vt_intern_create(alloctr);
+    assert(alloctr->stats.count_bytes_allocated > VT_INTERN_CHUNK_SIZE);
+    {
+        const vt_str_t *a = vt_intern(in, "user_id");
+        const vt_str_t *b = vt_intern_n(in, "user_id,name", 7);
+        const vt_str_t *c = vt_intern(in, "name");
+        assert(a == b);
+        assert(a != c);
+        assert(vt_str_len(a) == 7);
+        assert(vt_str_equals_z(vt_str_z(a), "user_id"));
+        assert(vt_array_is_view(a));
+        assert(vt_intern_len(in) == 2);
+
+        // strings and views
+        vt_str_t sc = vt_str_create_static("name");
+        assert(vt_intern_str(in, &sc) == c);
+        assert(vt_intern_view(in, vt_strview_from_z("user_id")) == a);
+
+        // empty string
+        const vt_str_t *e = vt_intern_n(in, "", 0);
+        assert(vt_str_len(e) == 0 && vt_str_z(e)[0] == '\0');
+        assert(vt_intern(in, "") == e);
+
+        // lookup only
+        assert(vt_intern_find_n(in, "name", 4) == c);
+        assert(vt_intern_find_n(in, "nam", 3) == NULL);
+
+        // statistics
+        assert(in->stats.count_lookups == 7);
+        assert(in->stats.count_hits == 4);
+        assert(in->stats.bytes_stored == 11);
+        assert(in->stats.bytes_saved == 7 + 4 + 7);
+        assert(vt_intern_hit_rate(in) > 0.57 && vt_intern_hit_rate(in) < 0.58);
+
+        // clear
+        vt_intern_clear(in);
+        assert(vt_intern_len(in) == 0);
+        assert(vt_intern_hit_rate(in) == 0);
+        assert(vt_intern_find_n(in, "name", 4) == NULL);
+    }
+
+    // many strings: grows and keeps all of them
+    {
+        char buf[32];
+        const vt_str_t *first[5000];
+        VT_FOREACH(i, 0, 5000) {
+            const int n = snprintf(buf, sizeof(buf), "field_%zu", i * 7919);
+            first[i] = vt_intern_n(in, buf, (size_t)n);
+        }
+        assert(vt_intern_len(in) == 5000);
+        VT_FOREACH(i, 0, 5000) {
+            const int n = snprintf(buf, sizeof(buf), "field_%zu", i * 7919);
+            assert(vt_intern_n(in, buf, (size_t)n) == first[i]);
+            assert(vt_str_equals_z(vt_str_z(first[i]), buf));
+        }
+        assert(vt_intern_len(in) == 5000);
+        assert(in->stats.count_hits == 5000);
+    }
+    vt_intern_clear(in);
+
+    // split
+    {
+        vt_str_t *line = vt_str_create("GET,/index,200,,GET,/about,200", alloctr);
+        vt_plist_t *tokens = vt_intern_split(in, NULL, line, ",");
+        assert(vt_plist_len(tokens) == 6);
+        assert(vt_plist_get(tokens, 0) == vt_plist_get(tokens, 3));
+        assert(vt_plist_get(tokens, 2) == vt_plist_get(tokens, 5));
+        assert(vt_str_equals_z(vt_str_z(vt_plist_get(tokens, 4)), "/about"));
+        assert(vt_intern_len(in) == 4);
+
+        // vt_str_split results map to the same strings
+        vt_plist_t *copies = vt_str_split(NULL, line, ",");
+        assert(vt_plist_len(copies) == vt_plist_len(tokens));
+        VT_FOREACH(i, 0, vt_plist_len(copies)) {
+            vt_str_t *s = vt_plist_get(copies, i);
+            assert(vt_intern_str(in, s) == vt_plist_get(tokens, i));
+            vt_str_destroy(s);
+        }
+        assert(vt_intern_len(in) == 4);
+
+        vt_plist_destroy(copies);
+        vt_plist_destroy(tokens);
+        vt_str_destroy(line);
+    }
+    vt_intern_destroy(in);
+
+    assert(alloctr->stats.count_allocs == alloctr->stats.count_frees);
+    vt_mallocator_destroy(alloctr);
+    return 0;
+}
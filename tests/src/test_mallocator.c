@@ -1,5 +1,7 @@
 #include <assert.h>
 #include "vita/allocator/mallocator.h"
+#include "vita/container/str.h"
+#include "vita/container/vec.h"
 
 int32_t main(void) {
     vt_mallocator_t *alloctr = vt_mallocator_create();
@@ -11,11 +13,142 @@ int32_t main(void) {
     zbuf = VT_ALLOCATOR_ALLOC(alloctr, 210);
     // vt_mallocator_print_stats(alloctr->stats);
 
+    // peak, live objects and histogram
+    struct VitaAllocatorStats stats = vt_allocator_get_stats(alloctr);
+    assert(stats.count_objects_live == 2);
+    assert(stats.count_objects_peak == 2);
+    assert(stats.count_bytes_allocated == sizeof(int) + 210);
+    assert(stats.count_bytes_peak == sizeof(int) + 210);
+    assert(stats.count_size_hist[vt_allocator_stats_hist_bin(sizeof(int))] == 1);
+    assert(stats.count_size_hist[6] == 1);  // 100 is in [64; 128)
+    assert(stats.count_size_hist[7] == 1);  // 210 is in [128; 256)
+
+    // reallocations
+    zbuf = VT_ALLOCATOR_REALLOC(alloctr, zbuf, 300);
+    zbuf = VT_ALLOCATOR_REALLOC(alloctr, zbuf, 50);
+    stats = vt_allocator_get_stats(alloctr);
+    assert(stats.count_reallocs == 2);
+    assert(stats.count_reallocs_grow == 1);
+    assert(stats.count_reallocs_shrink == 1);
+    assert(stats.count_bytes_peak == sizeof(int) + 300);
+    assert(stats.count_bytes_freed == 100 + 250);
+
     VT_ALLOCATOR_FREE(alloctr, val);
     VT_ALLOCATOR_FREE(alloctr, zbuf);
+    stats = vt_allocator_get_stats(alloctr);
+    assert(stats.count_objects_live == 0);
+    assert(stats.count_bytes_allocated == 0);
+    assert(stats.count_bytes_freed == 100 + 300 + sizeof(int));
 
     vt_mallocator_print_stats(alloctr->stats);
     vt_mallocator_destroy(alloctr);
 
+    // many live objects: the object list is resized and freed out of order
+    alloctr = vt_mallocator_create(); {
+        enum { N = 10000 };
+        void *ptrs[N] = {0};
+        VT_FOREACH(i, 0, N) {
+            ptrs[i] = VT_ALLOCATOR_ALLOC(alloctr, i % 64 + 1);
+        }
+        assert(alloctr->obj_list_len == N);
+        assert(alloctr->stats.count_allocs == N);
+
+        // free every other object, then reallocate the rest
+        VT_FOREACH_STEP(i, 0, N, 2) {
+            VT_ALLOCATOR_FREE(alloctr, ptrs[i]);
+        }
+        assert(alloctr->obj_list_len == N / 2);
+        VT_FOREACH_STEP(i, 1, N, 2) {
+            ptrs[i] = VT_ALLOCATOR_REALLOC(alloctr, ptrs[i], 128);
+        }
+        assert(alloctr->obj_list_len == N / 2);
+        assert(alloctr->stats.count_bytes_allocated == N / 2 * 128);
+
+        // free remaining objects in reverse order
+        VT_FOREACH_STEP(i, 1, N, 2) {
+            VT_ALLOCATOR_FREE(alloctr, ptrs[N - i]);
+        }
+        assert(alloctr->obj_list_len == 0);
+        assert(alloctr->stats.count_frees == N);
+        assert(alloctr->stats.count_bytes_allocated == 0);
+    } vt_mallocator_destroy(alloctr);
+
+    // aligned allocations keep their alignment upon reallocation
+    alloctr = vt_mallocator_create(); {
+        double *buf = VT_ALLOCATOR_ALLOC_ALIGNED(alloctr, 10 * sizeof(double), 64);
+        assert(((uintptr_t)buf % 64) == 0);
+        assert(buf[9] == 0);
+        buf[0] = 3.14;
+        buf = VT_ALLOCATOR_REALLOC(alloctr, buf, 1000 * sizeof(double));
+        assert(((uintptr_t)buf % 64) == 0);
+        assert(buf[0] == 3.14);
+
+        // the default alignment falls back to alloc
+        char *zbuf = VT_ALLOCATOR_ALLOC_ALIGNED(alloctr, 10, 8);
+        VT_ALLOCATOR_FREE(alloctr, zbuf);
+
+        // aligned vector
+        vt_vec_t *v = vt_vec_create_aligned(2, sizeof(float), 32, alloctr);
+        VT_FOREACH(i, 0, 1000) {
+            vt_vec_push_backf(v, (float)i);
+        }
+        assert(((uintptr_t)v->ptr % 32) == 0);
+        vt_vec_destroy(v);
+
+        // left for destroy to free
+        (void)buf;
+    } vt_mallocator_destroy(alloctr);
+
+    // call site profiling
+    alloctr = vt_mallocator_create(); {
+        void *before = VT_ALLOCATOR_ALLOC(alloctr, 8);
+        vt_mallocator_profile_enable(alloctr);
+
+        // the same site is aggregated
+        void *ptrs[10] = {0};
+        VT_FOREACH(i, 0, 10) {
+            ptrs[i] = VT_ALLOCATOR_ALLOC(alloctr, 16);
+        }
+        assert(alloctr->profile->sites_len == 1);
+        assert(alloctr->profile->sites[0].count_allocs == 10);
+        assert(alloctr->profile->sites[0].bytes_live == 160);
+
+        // reallocation moves ownership to the reallocating site
+        ptrs[0] = VT_ALLOCATOR_REALLOC(alloctr, ptrs[0], 64);
+        assert(alloctr->profile->sites_len == 2);
+        assert(alloctr->profile->sites[0].bytes_live == 144);
+        assert(alloctr->profile->sites[1].count_reallocs == 1);
+        assert(alloctr->profile->sites[1].bytes_allocated == 48);
+        assert(alloctr->profile->sites[1].bytes_live == 64);
+
+        // frees are attributed to the owning site, peak is kept
+        VT_FOREACH(i, 0, 10) {
+            VT_ALLOCATOR_FREE(alloctr, ptrs[i]);
+        }
+        VT_ALLOCATOR_FREE(alloctr, before);
+        assert(alloctr->profile->sites_len == 2);
+        assert(alloctr->profile->sites[0].count_frees == 9);
+        assert(alloctr->profile->sites[0].bytes_live == 0);
+        assert(alloctr->profile->sites[0].bytes_live_peak == 160);
+        assert(alloctr->profile->sites[1].count_frees == 1);
+        assert(alloctr->profile->sites[1].bytes_live == 0);
+
+        // containers report their internal sites
+        vt_str_t *s = vt_str_create("hello", alloctr);
+        vt_vec_t *v = vt_vec_create(2, sizeof(int32_t), alloctr);
+        VT_FOREACH(i, 0, 100) {
+            vt_str_append(s, "!");
+            vt_vec_push_backi32(v, i);
+        }
+        vt_str_destroy(s);
+        vt_vec_destroy(v);
+
+        vt_mallocator_profile_dump(alloctr, stdout, VT_MALLOCATOR_PROFILE_FORMAT_TEXT);
+        vt_mallocator_profile_dump(alloctr, stdout, VT_MALLOCATOR_PROFILE_FORMAT_CSV);
+        VT_FOREACH(i, 0, alloctr->profile->sites_len) {
+            assert(alloctr->profile->sites[i].bytes_live == 0);
+        }
+    } vt_mallocator_destroy(alloctr);
+
     return 0;
 }
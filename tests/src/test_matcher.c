@@ -0,0 +1,129 @@
+#include <assert.h>
+#include "vita/algorithm/matcher.h"
+
+// reference implementation: by end position, longer needles first, then by index
+static size_t naive_find_all(const vt_plist_t *needles, const char *z, size_t len, vt_matcher_match_t *out) {
+    size_t count = 0;
+    for (size_t end = 1; end <= len; end++) {
+        for (size_t l = end; l > 0; l--) {
+            VT_FOREACH(id, 0, vt_plist_len(needles)) {
+                const char *const sub = vt_plist_get(needles, id);
+                if (strlen(sub) == l && !memcmp(z + end - l, sub, l)) {
+                    out[count++] = (vt_matcher_match_t) { .id = id, .offset = end - l };
+                }
+            }
+        }
+    }
+    return count;
+}
+
+static void check_equal(const vt_vec_t *v, const vt_matcher_match_t *expected, size_t count) {
+    assert(vt_vec_len(v) == count);
+    VT_FOREACH(i, 0, count) {
+        const vt_matcher_match_t *const m = vt_vec_get(v, i);
+        assert(m->id == expected[i].id && m->offset == expected[i].offset);
+    }
+}
+
+int32_t main(void) {
+    vt_mallocator_t *alloctr = vt_mallocator_create();
+
+    // classic example
+    vt_plist_t *needles = vt_plist_create(4, alloctr);
+    vt_plist_push_back(needles, "he");
+    vt_plist_push_back(needles, "she");
+    vt_plist_push_back(needles, "his");
+    vt_plist_push_back(needles, "hers");
+    vt_matcher_t *m = vt_matcher_create(needles, alloctr);
+    {
+        assert(vt_matcher_count_patterns(m) == 4);
+
+        vt_str_t *s = vt_str_create("ushers and his", alloctr);
+        vt_vec_t *v = vt_matcher_find_all_str(m, NULL, s);
+        const vt_matcher_match_t expected[] = { {1, 1}, {0, 2}, {3, 2}, {2, 11} };
+        check_equal(v, expected, 4);
+
+        // the first one to end
+        vt_matcher_match_t first;
+        assert(vt_matcher_find_first(m, vt_str_z(s), vt_str_len(s), &first));
+        assert(first.id == 1 && first.offset == 1);
+        assert(!vt_matcher_find_first(m, "no match", 8, &first));
+        assert(!vt_matcher_find_first(m, "", 0, NULL));
+
+        // a match across chunks
+        vt_vec_clear(v);
+        vt_matcher_reset(m);
+        vt_matcher_feed(m, v, "xxxh", 4);
+        assert(vt_vec_len(v) == 0);
+        vt_matcher_feed(m, v, "ersxx", 5);
+        const vt_matcher_match_t expected_chunks[] = { {0, 3}, {3, 3} };
+        check_equal(v, expected_chunks, 2);
+
+        vt_vec_destroy(v);
+        vt_str_destroy(s);
+    }
+    vt_matcher_destroy(m);
+
+    // nothing to find: empty needles are ignored
+    vt_plist_clear(needles);
+    vt_plist_push_back(needles, "");
+    m = vt_matcher_create(needles, alloctr);
+    {
+        vt_vec_t *v = vt_matcher_find_all(m, NULL, "abc", 3);
+        assert(vt_vec_len(v) == 0);
+        vt_vec_destroy(v);
+    }
+    vt_matcher_destroy(m);
+
+    // random needles over a small alphabet, including duplicates and needles inside other needles
+    char needle_buf[40][8];
+    char text[512];
+    vt_matcher_match_t expected[512 * 40];
+    vt_vec_t *v = vt_vec_create(VT_ARRAY_DEFAULT_INIT_ELEMENTS, sizeof(vt_matcher_match_t), alloctr);
+    srand(18);
+    VT_FOREACH(iter, 0, 200) {
+        const char alphabet[] = "abc\xff";
+        const size_t count_needles = (size_t)(1 + rand() % 40);
+        vt_plist_clear(needles);
+        VT_FOREACH(i, 0, count_needles) {
+            const size_t len = (size_t)(1 + rand() % 6);
+            VT_FOREACH(j, 0, len) needle_buf[i][j] = alphabet[rand() % 4];
+            needle_buf[i][len] = '\0';
+            vt_plist_push_back(needles, needle_buf[i]);
+        }
+        const size_t len = (size_t)(rand() % sizeof(text));
+        VT_FOREACH(i, 0, len) text[i] = alphabet[rand() % 4];
+
+        m = vt_matcher_create(needles, alloctr);
+        {
+            const size_t count = naive_find_all(needles, text, len, expected);
+            vt_matcher_find_all(m, v, text, len);
+            check_equal(v, expected, count);
+
+            // random chunks give the same result
+            vt_vec_clear(v);
+            vt_matcher_reset(m);
+            for (size_t at = 0; at < len;) {
+                size_t n = (size_t)(rand() % 20);
+                n = n < len - at ? n : len - at;
+                vt_matcher_feed(m, v, text + at, n);
+                at += n;
+            }
+            check_equal(v, expected, count);
+
+            // the first one
+            vt_matcher_match_t first;
+            assert(vt_matcher_find_first(m, text, len, &first) == (count > 0));
+            if (count) {
+                assert(first.id == expected[0].id && first.offset == expected[0].offset);
+            }
+        }
+        vt_matcher_destroy(m);
+    }
+    vt_vec_destroy(v);
+
+    vt_plist_destroy(needles);
+    assert(alloctr->stats.count_allocs == alloctr->stats.count_frees);
+    vt_mallocator_destroy(alloctr);
+    return 0;
+}
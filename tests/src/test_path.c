@@ -1,7 +1,7 @@
 #include <assert.h>
 #include "vita/system/path.h"
 
-#define FILES_IN_DIR 18
+#define FILES_IN_DIR 35
 
 // helper functions
 void free_str(void *ptr, size_t i);
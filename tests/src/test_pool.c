@@ -0,0 +1,93 @@
+#include <assert.h>
+#include "vita/allocator/pool.h"
+#include "vita/container/str.h"
+#include "vita/container/vec.h"
+
+int32_t main(void) {
+    vt_pool_t *pool = vt_pool_create();
+    struct VitaBaseAllocatorType *alloctr = &pool->base;
+
+    // allocations are zero-initialized and aligned
+    char *zbuf = VT_ALLOCATOR_ALLOC(alloctr, 10);
+    assert(((uintptr_t)zbuf % 16) == 0);
+    VT_FOREACH(i, 0, 10) {
+        assert(zbuf[i] == 0);
+    }
+    strcpy(zbuf, "hello");
+    assert(alloctr->stats.count_class_misses[0] == 1);
+
+    // freed blocks are reused by the same size class and zeroed again
+    VT_ALLOCATOR_FREE(alloctr, zbuf);
+    char *zbuf2 = VT_ALLOCATOR_ALLOC(alloctr, 16);
+    assert(zbuf2 == zbuf);
+    assert(zbuf2[0] == 0);
+    assert(alloctr->stats.count_class_hits[0] == 1);
+    strcpy(zbuf2, "hello");
+
+    // blocks are resized in place within the size class, and moved otherwise
+    zbuf2 = VT_ALLOCATOR_REALLOC(alloctr, zbuf2, 12);
+    assert(zbuf2 == zbuf);
+    zbuf2 = VT_ALLOCATOR_REALLOC(alloctr, zbuf2, 100);
+    assert(zbuf2 != zbuf);
+    assert(vt_str_equals_z(zbuf2, "hello"));
+    assert(zbuf2[99] == 0);
+    assert(alloctr->stats.count_class_misses[3] == 1);
+
+    // large allocations bypass size classes
+    char *big = VT_ALLOCATOR_ALLOC(alloctr, 10000);
+    big[9999] = 'x';
+    big = VT_ALLOCATOR_REALLOC(alloctr, big, 20000);
+    assert(big[9999] == 'x');
+    assert(big[19999] == 0);
+    char *big2 = VT_ALLOCATOR_ALLOC(alloctr, 5000);
+    VT_ALLOCATOR_FREE(alloctr, big);
+    assert(pool->large != NULL && pool->large->next == NULL);
+
+    // stats
+    assert(alloctr->stats.count_allocs == 4);
+    assert(alloctr->stats.count_reallocs == 3);
+    assert(alloctr->stats.count_frees == 2);
+    assert(alloctr->stats.count_bytes_allocated == 100 + 5000);
+    assert(alloctr->stats.count_objects_live == 2);
+    assert(alloctr->stats.count_bytes_peak == 100 + 20000 + 5000);
+
+    // many blocks of the same size span multiple slabs
+    const size_t count = 1000;
+    void **ptrs = VT_CALLOC(count * sizeof(void*));
+    VT_FOREACH(cycle, 0, 2) {
+        VT_FOREACH(i, 0, count) {
+            ptrs[i] = VT_ALLOCATOR_ALLOC(alloctr, 200);
+        }
+        VT_FOREACH(i, 0, count) {
+            VT_ALLOCATOR_FREE(alloctr, ptrs[i]);
+        }
+    }
+    assert(alloctr->stats.count_class_misses[4] == count);
+    assert(alloctr->stats.count_class_hits[4] == count);
+    VT_FREE(ptrs);
+
+    // containers can use the pool
+    VT_FOREACH(cycle, 0, 3) {
+        vt_str_t *s = vt_str_create("hello", alloctr);
+        vt_str_append(s, ", world!");
+        assert(vt_str_equals_z(vt_str_z(s), "hello, world!"));
+
+        vt_vec_t *v = vt_vec_create(4, sizeof(int32_t), alloctr);
+        VT_FOREACH(i, 0, 2000) {
+            vt_vec_push_backi32(v, i);
+        }
+        assert(vt_vec_geti32(v, 1999) == 1999);
+
+        vt_str_destroy(s);
+        vt_vec_destroy(v);
+    }
+    VT_ALLOCATOR_FREE(alloctr, zbuf2);
+    VT_ALLOCATOR_FREE(alloctr, big2);
+    assert(alloctr->stats.count_bytes_allocated == 0);
+
+    vt_mallocator_print_stats(alloctr->stats);
+    vt_pool_print_stats(alloctr->stats);
+    vt_pool_destroy(pool);
+
+    return 0;
+}
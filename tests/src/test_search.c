@@ -0,0 +1,79 @@
+#include <assert.h>
+#include "vita/algorithm/search.h"
+
+// reference implementations
+static const char *naive_find(const char *z, size_t zLen, const char *sub, size_t subLen) {
+    if (subLen > zLen) return NULL;
+    for (size_t i = 0; i + subLen <= zLen; i++) {
+        if (!memcmp(z + i, sub, subLen)) return z + i;
+    }
+    return NULL;
+}
+
+static const char *naive_find_last(const char *z, size_t zLen, const char *sub, size_t subLen) {
+    if (subLen > zLen) return NULL;
+    for (size_t i = zLen - subLen + 1; i-- > 0;) {
+        if (!memcmp(z + i, sub, subLen)) return z + i;
+    }
+    return NULL;
+}
+
+int32_t main(void) {
+    // edge cases
+    const char *z = "hello, world! hello!";
+    const size_t zLen = strlen(z);
+    assert(vt_search_substr(z, zLen, "", 0) == z);
+    assert(vt_search_substr_last(z, zLen, "", 0) == z + zLen);
+    assert(vt_search_substr(z, zLen, "hello", 5) == z);
+    assert(vt_search_substr_last(z, zLen, "hello", 5) == z + 14);
+    assert(vt_search_substr(z, zLen, "!", 1) == z + 12);
+    assert(vt_search_substr_last(z, zLen, "!", 1) == z + 19);
+    assert(vt_search_substr(z, zLen, "world!!", 7) == NULL);
+    assert(vt_search_substr(z, 5, "hello, world", 12) == NULL);
+    assert(vt_search_substr(z, zLen, z, zLen) == z);
+
+    // the length is respected, not the zero terminator
+    const char bin[] = "ab\0cd\0ab\0cd";
+    assert(vt_search_substr(bin, sizeof(bin) - 1, "\0cd", 3) == bin + 2);
+    assert(vt_search_substr_last(bin, sizeof(bin) - 1, "\0cd", 3) == bin + 8);
+    assert(vt_search_substr(bin, 4, "cd", 2) == NULL);
+
+    // random inputs over a small alphabet (many partial matches), short and long needles
+    srand(42);
+    char hay[1024], needle[128];
+    VT_FOREACH(iter, 0, 20000) {
+        const size_t hLen = (size_t)rand() % sizeof(hay);
+        const size_t nLen = 1 + (size_t)rand() % (iter % 2 ? 8 : sizeof(needle));
+        const int alphabet = 2 + rand() % 3;
+        VT_FOREACH(i, 0, hLen) hay[i] = (char)('a' + rand() % alphabet);
+        VT_FOREACH(i, 0, nLen) needle[i] = (char)('a' + rand() % alphabet);
+
+        // plant the needle sometimes
+        if (nLen <= hLen && rand() % 2) {
+            memcpy(hay + (size_t)rand() % (hLen - nLen + 1), needle, nLen);
+        }
+
+        assert(vt_search_substr(hay, hLen, needle, nLen) == naive_find(hay, hLen, needle, nLen));
+        assert(vt_search_substr_last(hay, hLen, needle, nLen) == naive_find_last(hay, hLen, needle, nLen));
+    }
+
+    // periodic needles
+    VT_FOREACH(i, 0, sizeof(hay)) hay[i] = (i % 7 == 6) ? 'b' : 'a';
+    VT_FOREACH(nLen, 1, sizeof(needle)) {
+        VT_FOREACH(i, 0, nLen) needle[i] = (i % 7 == 6) ? 'b' : 'a';
+        assert(vt_search_substr(hay, sizeof(hay), needle, nLen) == naive_find(hay, sizeof(hay), needle, nLen));
+        needle[nLen - 1] = 'c';
+        assert(vt_search_substr(hay, sizeof(hay), needle, nLen) == NULL);
+    }
+
+    // needle bytes matching at every other position, the search must give up filtering and still be correct
+    VT_FOREACH(i, 0, sizeof(hay)) hay[i] = (i % 2) ? 'b' : 'a';
+    VT_FOREACH(i, 0, 64) needle[i] = (i % 2) ? 'b' : 'a';
+    needle[41] = 'a';
+    assert(vt_search_substr(hay, sizeof(hay), needle, 64) == NULL);
+    memcpy(hay + 901, needle, 64);
+    assert(vt_search_substr(hay, sizeof(hay), needle, 64) == naive_find(hay, sizeof(hay), needle, 64));
+    assert(vt_search_substr(hay, sizeof(hay), needle, 64) == hay + 901);
+
+    return 0;
+}
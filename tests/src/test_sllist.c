@@ -0,0 +1,138 @@
+#include <assert.h>
+#include "vita/container/vec.h"
+#include "vita/experimental/sllist.h"
+
+static int32_t sum = 0;
+static void add(void *ptr, size_t i) {
+    sum += *(int32_t*)ptr * (int32_t)(i + 1);
+}
+
+int32_t main(void) {
+    vt_mallocator_t *alloctr = vt_mallocator_create();
+
+    // push and pop at both ends
+    {
+        vt_sllist_t *list = vt_sllist_create(0, sizeof(int32_t), alloctr);
+        assert(vt_sllist_is_empty(list));
+        assert(vt_sllist_capacity(list) == 0);
+        assert(vt_sllist_head(list) == VT_SLLIST_NIL && vt_sllist_tail(list) == VT_SLLIST_NIL);
+        assert(vt_sllist_pop_get_front(list) == NULL && vt_sllist_pop_get_back(list) == NULL);
+
+        // 2 1 0 | 0 1 2
+        VT_FOREACH(i, 0, 3) {
+            const int32_t x = (int32_t)i;
+            vt_sllist_push_front(list, &x);
+            vt_sllist_push_back(list, &x);
+        }
+        assert(vt_sllist_len(list) == 6);
+        assert(*(int32_t*)vt_sllist_get(list, vt_sllist_head(list)) == 2);
+        assert(*(int32_t*)vt_sllist_get(list, vt_sllist_tail(list)) == 2);
+        assert(*(int32_t*)vt_sllist_get(list, vt_sllist_at(list, 2)) == 0);
+        assert(*(int32_t*)vt_sllist_get(list, vt_sllist_at(list, 4)) == 1);
+
+        // apply: 2*1 + 1*2 + 0*3 + 0*4 + 1*5 + 2*6
+        vt_sllist_apply(list, add);
+        assert(sum == 21);
+
+        assert(*(int32_t*)vt_sllist_pop_get_front(list) == 2);
+        assert(*(int32_t*)vt_sllist_pop_get_back(list) == 2);
+        vt_sllist_pop_front(list);
+        vt_sllist_pop_back(list);
+        assert(vt_sllist_len(list) == 2);
+        vt_sllist_pop_back(list);
+        vt_sllist_pop_back(list);
+        assert(vt_sllist_is_empty(list));
+        assert(vt_sllist_head(list) == VT_SLLIST_NIL && vt_sllist_tail(list) == VT_SLLIST_NIL);
+
+        vt_sllist_destroy(list);
+    }
+
+    // handles: insert and remove in the middle
+    {
+        vt_sllist_t *list = vt_sllist_create(4, sizeof(double), alloctr);
+        assert(vt_sllist_capacity(list) == 16);
+
+        const double a = 1, b = 2, c = 3, d = 4;
+        const size_t nb = vt_sllist_push_back(list, &b);
+        const size_t nd = vt_sllist_push_back(list, &d);
+        const size_t na = vt_sllist_insert_before(list, &a, nb);
+        const size_t nc = vt_sllist_insert_after(list, &c, nb);
+        assert(vt_sllist_head(list) == na && vt_sllist_tail(list) == nd);
+        assert(vt_sllist_next(list, nb) == nc && vt_sllist_prev(list, nc) == nb);
+        assert(vt_sllist_find(list, &c) == nc);
+
+        // 1 3 4
+        vt_sllist_remove(list, nb);
+        assert(vt_sllist_next(list, na) == nc && vt_sllist_prev(list, nc) == na);
+        assert(vt_sllist_find(list, &b) == VT_SLLIST_NIL);
+
+        // 1 3 9
+        const double e = 9;
+        vt_sllist_set(list, &e, nd);
+        assert(vt_sllist_remove_element(list, &a));
+        assert(!vt_sllist_remove_element(list, &a));
+        assert(vt_sllist_head(list) == nc && vt_sllist_prev(list, nc) == VT_SLLIST_NIL);
+        assert(*(double*)vt_sllist_get(list, vt_sllist_tail(list)) == 9);
+
+        // removed nodes are reused
+        assert(vt_sllist_push_front(list, &a) == na);
+        assert(vt_sllist_push_front(list, &b) == nb);
+
+        // clear
+        vt_sllist_clear(list);
+        assert(vt_sllist_is_empty(list));
+        assert(vt_sllist_capacity(list) == 16);
+
+        vt_sllist_destroy(list);
+    }
+
+    // queue churn does not grow the list; compare against a vector
+    {
+        vt_sllist_t *list = vt_sllist_create(0, 3, alloctr);
+        vt_sllist_reserve(list, 100);
+        const size_t capacity = vt_sllist_capacity(list);
+        assert(capacity >= 100);
+
+        vt_vec_t *v = vt_vec_create(100, 3, alloctr);
+        uint32_t seed = 1;
+        VT_FOREACH(i, 0, 100000) {
+            seed = seed * 1103515245 + 12345;
+            const uint8_t x[3] = { (uint8_t)i, (uint8_t)(i >> 8), (uint8_t)(i >> 16) };
+            if (vt_vec_len(v) < 100 && (seed >> 16) % 2) {
+                vt_sllist_push_back(list, x);
+                vt_vec_push_back(v, x);
+            } else if (vt_vec_len(v) > 0) {
+                assert(memcmp(vt_sllist_pop_get_front(list), vt_vec_get(v, 0), 3) == 0);
+                vt_vec_remove(v, 0, VT_REMOVE_STRATEGY_STABLE);
+            }
+            assert(vt_sllist_len(list) == vt_vec_len(v));
+        }
+        assert(vt_sllist_capacity(list) == capacity);
+
+        vt_vec_destroy(v);
+        vt_sllist_destroy(list);
+    }
+
+    // grow over several blocks
+    {
+        vt_sllist_t *list = vt_sllist_create(0, sizeof(uint64_t), alloctr);
+        VT_FOREACH(i, 0, 10000) {
+            const uint64_t x = i;
+            vt_sllist_push_front(list, &x);
+        }
+        assert(list->count_blocks > 1);
+
+        uint64_t expected = 10000;
+        for (size_t node = vt_sllist_head(list); node != VT_SLLIST_NIL; node = vt_sllist_next(list, node)) {
+            assert(*(uint64_t*)vt_sllist_get(list, node) == --expected);
+        }
+        assert(expected == 0);
+        assert(*(uint64_t*)vt_sllist_get(list, vt_sllist_at(list, 7500)) == 2499);
+
+        vt_sllist_destroy(list);
+    }
+
+    assert(alloctr->stats.count_allocs == alloctr->stats.count_frees);
+    vt_mallocator_destroy(alloctr);
+    return 0;
+}
@@ -0,0 +1,119 @@
+#include <assert.h>
+#include "vita/allocator/stackallocator.h"
+#include "vita/container/str.h"
+#include "vita/container/plist.h"
+
+int32_t main(void) {
+    char buf[VT_STACKALLOCATOR_DEFAULT_SIZE];
+    vt_stackallocator_t sa = vt_stackallocator_create(buf, sizeof(buf));
+    struct VitaBaseAllocatorType *alloctr = &sa.base;
+
+    // allocations come from the buffer, are zero-initialized and aligned
+    char *a = VT_ALLOCATOR_ALLOC(alloctr, 10);
+    assert(a >= buf && a < buf + sizeof(buf));
+    assert(((uintptr_t)a % VT_STACKALLOCATOR_ALIGNMENT) == 0);
+    assert(a[9] == 0);
+    strcpy(a, "hello");
+
+    // the last block grows in place, others move
+    char *b = VT_ALLOCATOR_ALLOC(alloctr, 20);
+    char *b2 = VT_ALLOCATOR_REALLOC(alloctr, b, 200);
+    assert(b2 == b);
+    assert(b[199] == 0);
+    a = VT_ALLOCATOR_REALLOC(alloctr, a, 100);
+    assert(vt_str_equals_z(a, "hello"));
+    assert(a > b);
+
+    // freeing the top block rewinds the buffer, including blocks freed before it
+    const size_t offset = sa.offset;
+    char *c = VT_ALLOCATOR_ALLOC(alloctr, 50);
+    VT_ALLOCATOR_FREE(alloctr, c);
+    assert(sa.offset == offset);
+    VT_ALLOCATOR_FREE(alloctr, b);
+    assert(sa.offset == offset);
+    VT_ALLOCATOR_FREE(alloctr, a);
+    assert(sa.offset == 0 && sa.top == NULL);
+
+    // the buffer spills to the heap on overflow
+    char *big = VT_ALLOCATOR_ALLOC(alloctr, 2 * VT_STACKALLOCATOR_DEFAULT_SIZE);
+    assert(!(big >= buf && big < buf + sizeof(buf)));
+    assert(sa.count_spills == 1 && sa.spills != NULL);
+    big[0] = 'x';
+    char *small = VT_ALLOCATOR_ALLOC(alloctr, 100);
+    assert(small >= buf && small < buf + sizeof(buf));
+    small = VT_ALLOCATOR_REALLOC(alloctr, small, VT_STACKALLOCATOR_DEFAULT_SIZE);
+    assert(sa.count_spills == 2 && sa.offset == 0);
+    big = VT_ALLOCATOR_REALLOC(alloctr, big, 3 * VT_STACKALLOCATOR_DEFAULT_SIZE);
+    assert(big[0] == 'x' && big[3 * VT_STACKALLOCATOR_DEFAULT_SIZE - 1] == 0);
+    VT_ALLOCATOR_FREE(alloctr, big);
+    VT_ALLOCATOR_FREE(alloctr, small);
+    assert(sa.spills == NULL);
+
+    // aligned allocations
+    char *aligned = VT_ALLOCATOR_ALLOC_ALIGNED(alloctr, 64, 64);
+    assert(((uintptr_t)aligned % 64) == 0);
+    aligned = VT_ALLOCATOR_REALLOC(alloctr, aligned, 2 * VT_STACKALLOCATOR_DEFAULT_SIZE);
+    assert(((uintptr_t)aligned % 64) == 0);
+    VT_ALLOCATOR_FREE(alloctr, aligned);
+    assert(sa.count_spills == 4);
+
+    // stats
+    assert(alloctr->stats.count_allocs == 6);
+    assert(alloctr->stats.count_reallocs == 5);
+    assert(alloctr->stats.count_frees == 6);
+    assert(alloctr->stats.count_bytes_allocated == 0);
+    assert(alloctr->stats.count_objects_live == 0);
+
+    // temporary containers stay within the buffer
+    const size_t count_spills = sa.count_spills;
+    VT_FOREACH(cycle, 0, 3) {
+        vt_str_t *s = vt_str_create("hello", alloctr);
+        vt_str_append(s, ", world!");
+        assert(vt_str_equals_z(vt_str_z(s), "hello, world!"));
+
+        vt_plist_t *p = vt_plist_create(4, alloctr);
+        VT_FOREACH(i, 0, 32) {
+            vt_plist_push_back(p, s);
+        }
+        assert(vt_plist_get(p, 31) == s);
+
+        vt_plist_destroy(p);
+        vt_str_destroy(s);
+        assert(sa.offset == 0);
+    }
+    assert(sa.count_spills == count_spills);
+
+    // blocks left allocated are released upon reset and destruction
+    VT_ALLOCATOR_ALLOC(alloctr, 10);
+    VT_ALLOCATOR_ALLOC(alloctr, 10000);
+    vt_stackallocator_reset(&sa);
+    assert(sa.offset == 0 && sa.spills == NULL);
+    assert(alloctr->stats.count_bytes_allocated == 0);
+
+    // blocks allocated before a reset can be freed afterwards, stats of newer blocks are kept
+    {
+        VT_ALLOCATOR_ALLOC(alloctr, 10);
+        char *stale = VT_ALLOCATOR_ALLOC(alloctr, 10);
+        char *stale_big = VT_ALLOCATOR_ALLOC(alloctr, 10000);
+        vt_stackallocator_reset(&sa);
+
+        char *fresh = VT_ALLOCATOR_ALLOC(alloctr, 100);
+        memset(fresh, 'x', 100);
+        const size_t offset_fresh = sa.offset;
+        const size_t count_frees = alloctr->stats.count_frees;
+        VT_ALLOCATOR_FREE(alloctr, stale);
+        VT_ALLOCATOR_FREE(alloctr, stale_big);
+        assert(alloctr->stats.count_frees == count_frees + 2);
+        assert(alloctr->stats.count_objects_live == 1);
+        assert(alloctr->stats.count_bytes_allocated == 100);
+        assert(sa.offset == offset_fresh && fresh[99] == 'x');
+
+        VT_ALLOCATOR_FREE(alloctr, fresh);
+        assert(alloctr->stats.count_objects_live == 0 && sa.offset == 0);
+    }
+
+    VT_ALLOCATOR_ALLOC(alloctr, 10000);
+    vt_stackallocator_destroy(&sa);
+
+    return 0;
+}
@@ -1,5 +1,6 @@
 #include <assert.h>
 #include <stdint.h>
+#include <inttypes.h>
 
 #include "vita/container/str.h"
 
@@ -215,6 +216,41 @@ int32_t main(void) {
     assert(vt_str_len(s_strip) == 10);
     assert(vt_str_equals_z(vt_str_z(s_strip), "helloworld"));
     vt_str_destroy(s_strip);
+
+    // strings made of stripped characters only become empty
+    s_strip = vt_str_create(" \t\n\r  ", alloctr);
+    vt_str_strip(s_strip);
+    assert(vt_str_len(s_strip) == 0);
+    assert(vt_str_equals_z(vt_str_z(s_strip), ""));
+    vt_str_destroy(s_strip);
+    s_strip = vt_str_create("-- ,, !! --", alloctr);
+    vt_str_strip_punct(s_strip);
+    assert(vt_str_len(s_strip) == 0);
+    vt_str_destroy(s_strip);
+
+    // long strings go through the SIMD kernels
+    s_strip = vt_str_create("\t\t\t\t                                                  The Quick, Brown Fox; jumps over the lazy dog!  \n\n\n\n\n\n\n\n\n\n\n\n\n\n\n\n\n\n\n\n\n\n\n\n\n\n\n\n\n\n\n\n\n", alloctr);
+    vt_str_strip(s_strip);
+    assert(vt_str_equals_z(vt_str_z(s_strip), "The Quick, Brown Fox; jumps over the lazy dog!"));
+    vt_str_to_lowercase(s_strip);
+    assert(vt_str_equals_z(vt_str_z(s_strip), "the quick, brown fox; jumps over the lazy dog!"));
+    vt_str_to_uppercase(s_strip);
+    assert(vt_str_equals_z(vt_str_z(s_strip), "THE QUICK, BROWN FOX; JUMPS OVER THE LAZY DOG!"));
+    vt_str_remove_c(s_strip, " ,;!");
+    assert(vt_str_equals_z(vt_str_z(s_strip), "THEQUICKBROWNFOXJUMPSOVERTHELAZYDOG"));
+    vt_str_replace_c(s_strip, "OEUO", "0E");
+    assert(vt_str_equals_z(vt_str_z(s_strip), "THEQEICKBR0WNF0XJEMPS0VERTHELAZYD0G"));
+    vt_str_destroy(s_strip);
+
+    // short strings are handled one character at a time, long strings by the kernels: both give the same result
+    s_strip = vt_str_create("--THE FOX, UP!--", alloctr);
+    vt_str_replace_c(s_strip, "OEUO", "0E");
+    assert(vt_str_equals_z(vt_str_z(s_strip), "--THE F0X, EP!--"));
+    vt_str_destroy(s_strip);
+    s_strip = vt_str_create("-!-!-!-!-!-!-!-!-!-!-!-!-!-!-!-!-!-!The Fox!-!-!-!-!-!-!-!-!-!-!-!-!-!-!-!-!-!-!", alloctr);
+    vt_str_strip_c(s_strip, "!-");
+    assert(vt_str_equals_z(vt_str_z(s_strip), "The Fox"));
+    vt_str_destroy(s_strip);
     
     s_strip = vt_str_create("Here is a shopping list: apples and oranges, milk and sugar, and vinegar.", alloctr);
     vt_str_remove_all(s_strip, " and");
@@ -343,6 +379,33 @@ int32_t main(void) {
     }
     vt_str_destroy(text);
 
+    // replace all: shorter, longer (inline and on the heap), matches at both ends
+    text = vt_str_create("ab--ab--ab", alloctr);
+    {
+        vt_str_replace(text, "ab", "x");
+        assert(vt_str_equals_z(vt_str_z(text), "x--x--x"));
+        assert(vt_str_len(text) == 7);
+
+        vt_str_replace(text, "x", "yz");
+        assert(vt_str_equals_z(vt_str_z(text), "yz--yz--yz"));
+        assert(vt_str_is_sso(text));
+
+        vt_str_replace(text, "--", "<---------->");
+        assert(vt_str_equals_z(vt_str_z(text), "yz<---------->yz<---------->yz"));
+        assert(vt_str_len(text) == 30);
+        assert(!vt_str_is_sso(text));
+
+        vt_str_replace(text, "-", "");
+        assert(vt_str_len(text) == 30);
+        vt_str_replace(text, "---------", "");
+        assert(vt_str_len(text) == 30);
+        vt_str_replace(text, "<----------", "[");
+        assert(vt_str_equals_z(vt_str_z(text), "yz[>yz[>yz"));
+        vt_str_replace(text, "nothing", "something");
+        assert(vt_str_equals_z(vt_str_z(text), "yz[>yz[>yz"));
+    }
+    vt_str_destroy(text);
+
     // vt_str_set_at and vt_str_set_c
     text = vt_str_create("hello, world", NULL); 
     {
@@ -357,6 +420,129 @@ int32_t main(void) {
     }
     vt_str_destroy(text);
 
+    // small-string optimization: a single allocation for short strings
+    const size_t count_allocs = alloctr->stats.count_allocs;
+    text = vt_str_create("key", alloctr);
+    {
+        assert(vt_str_is_sso(text));
+        assert(vt_str_capacity(text) == 3);
+        assert(alloctr->stats.count_allocs == count_allocs + 1);
+
+        // stays inline while it fits
+        vt_str_append(text, "-value-0123456789");
+        assert(vt_str_is_sso(text));
+        assert(vt_str_equals_z(vt_str_z(text), "key-value-0123456789"));
+
+        // promoted to the heap on overflow
+        vt_str_insert(text, "long:", 0);
+        assert(!vt_str_is_sso(text));
+        assert(vt_str_len(text) == 25);
+        assert(vt_str_equals_z(vt_str_z(text), "long:key-value-0123456789"));
+        vt_str_append(text, "!");
+        assert(vt_str_equals_z(vt_str_z(text), "long:key-value-0123456789!"));
+
+        // moved back inline on shrink
+        vt_str_remove(text, 0, 16);
+        vt_str_shrink(text);
+        assert(vt_str_is_sso(text));
+        assert(vt_str_capacity(text) == 10);
+        assert(vt_str_equals_z(vt_str_z(text), "123456789!"));
+
+        // capacity semantics are kept
+        vt_str_reserve(text, 5);
+        assert(vt_str_is_sso(text));
+        assert(vt_str_capacity(text) == 15);
+        vt_str_resize(text, 100);
+        assert(!vt_str_is_sso(text));
+        assert(vt_str_capacity(text) == 100);
+        assert(vt_str_equals_z(vt_str_z(text), "123456789!"));
+    }
+    vt_str_destroy(text);
+    assert(!vt_str_is_sso(&static_s));
+
+    // growth policies: str grows exactly by default
+    text = vt_str_create_capacity(VT_STR_SSO_CAPACITY + 1, alloctr);
+    {
+        vt_str_set_growth_policy(text, VT_GROWTH_POLICY_FACTOR_2);
+        const size_t count_reallocs = alloctr->stats.count_reallocs;
+        VT_FOREACH(i, 0, 1000) {
+            vt_str_append(text, "abc");
+        }
+        assert(vt_str_len(text) == 3000);
+        assert(vt_str_capacity(text) == 3072);
+        assert(alloctr->stats.count_reallocs - count_reallocs == 7);
+    }
+    vt_str_destroy(text);
+
+    // formatting prints into the spare capacity, growing only when the output does not fit
+    text = vt_str_create_capacity(8, alloctr);
+    {
+        vt_str_clear(text);
+        assert(vt_str_appendf(text, "%d-%s", 42, "ab") == VT_STATUS_OPERATION_SUCCESS);
+        assert(vt_str_capacity(text) == 8);
+        assert(vt_str_equals_z(vt_str_z(text), "42-ab"));
+
+        // SSO -> heap
+        vt_str_appendf(text, "|%032d|", 7);
+        assert(!vt_str_is_sso(text));
+        assert(vt_str_equals_z(vt_str_z(text), "42-ab|00000000000000000000000000000007|"));
+
+        // insertf: a short output through the stack buffer, a long one straight into the string
+        vt_str_insertf(text, 2, "%c", '!');
+        assert(vt_str_equals_z(vt_str_z(text), "42!-ab|00000000000000000000000000000007|"));
+        vt_str_insertf(text, 1, "%*s", VT_STR_TMP_BUFFER_SIZE + 10, "x");
+        assert(vt_str_len(text) == 40 + VT_STR_TMP_BUFFER_SIZE + 10);
+        assert(vt_str_starts_with(text, "4   "));
+        assert(vt_str_z(text)[VT_STR_TMP_BUFFER_SIZE + 10] == 'x');
+        assert(vt_str_ends_with(text, "x2!-ab|00000000000000000000000000000007|"));
+    }
+    vt_str_destroy(text);
+
+    // typed appends match printf
+    text = vt_str_create_capacity(VT_STR_TMP_BUFFER_SIZE, alloctr);
+    {
+        char buf[VT_STR_TMP_BUFFER_SIZE];
+        const int64_t ints[] = { 0, 1, -1, 9, 10, 99, 100, -12345, 1000000007, INT64_MAX, INT64_MIN };
+        VT_FOREACH(i, 0, sizeof(ints)/sizeof(ints[0])) {
+            vt_str_clear(text);
+            vt_str_append_i64(text, ints[i]);
+            vt_str_append(text, " ");
+            vt_str_append_u64(text, (uint64_t)ints[i]);
+            vt_str_append(text, " ");
+            vt_str_append_hex(text, (uint64_t)ints[i]);
+            snprintf(buf, sizeof(buf), "%" PRId64 " %" PRIu64 " %" PRIx64, ints[i], (uint64_t)ints[i], (uint64_t)ints[i]);
+            assert(vt_str_equals_z(vt_str_z(text), buf));
+        }
+
+        // exact halfway cases, negative zero, large values, inf and nan
+        const double doubles[] = { 0.0, -0.0, 0.5, 1.5, 2.5, 0.125, 1.005, -0.001, 3.14159265358979, 1e15, -1e300, 1e-300, 123456.789 };
+        VT_FOREACH(i, 0, sizeof(doubles)/sizeof(doubles[0])) {
+            VT_FOREACH(precision, 0, VT_STR_F64_MAX_PRECISION + 3) {
+                vt_str_clear(text);
+                vt_str_append_f64(text, doubles[i], precision);
+                snprintf(buf, sizeof(buf), "%.*f", (int32_t)precision, doubles[i]);
+                assert(vt_str_equals_z(vt_str_z(text), buf));
+            }
+        }
+        vt_str_clear(text);
+        vt_str_append_f64(text, INFINITY, 2);
+        vt_str_append_f64(text, -INFINITY, 2);
+        snprintf(buf, sizeof(buf), "%.2f%.2f", INFINITY, -INFINITY);
+        assert(vt_str_equals_z(vt_str_z(text), buf));
+
+        // random values of every magnitude
+        srand(16);
+        VT_FOREACH(i, 0, 100000) {
+            const double v = ((double)rand() / RAND_MAX - 0.5) * pow(10, rand() % 24 - 8);
+            const size_t precision = (size_t)(rand() % (VT_STR_F64_MAX_PRECISION + 1));
+            vt_str_clear(text);
+            vt_str_append_f64(text, v, precision);
+            snprintf(buf, sizeof(buf), "%.*f", (int32_t)precision, v);
+            assert(vt_str_equals_z(vt_str_z(text), buf));
+        }
+    }
+    vt_str_destroy(text);
+
     vt_mallocator_destroy(alloctr);
     return 0;
 }
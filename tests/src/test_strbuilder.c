@@ -0,0 +1,100 @@
+#include <assert.h>
+#include "vita/container/strbuilder.h"
+#include "vita/allocator/mallocator.h"
+
+int32_t main(void) {
+    vt_mallocator_t *alloctr = vt_mallocator_create();
+
+    // append and flatten
+    vt_strbuilder_t *sb = vt_strbuilder_create(alloctr);
+    {
+        assert(vt_strbuilder_len(sb) == 0);
+        vt_str_t *s = vt_strbuilder_to_str(sb, NULL);
+        assert(vt_str_len(s) == 0);
+        vt_str_destroy(s);
+
+        vt_strbuilder_append(sb, "hello");
+        vt_strbuilder_append_n(sb, ", world!!!", 7);
+        assert(vt_strbuilder_appendf(sb, " %d-%s", 42, "x") == VT_STATUS_OPERATION_SUCCESS);
+        assert(vt_strbuilder_len(sb) == 17);
+        assert(vt_strbuilder_count_chunks(sb) == 1);
+        assert(vt_strbuilder_get(sb, 7) == 'w');
+
+        // insert in the middle and at both ends
+        vt_strbuilder_insert(sb, "big ", 7);
+        vt_strbuilder_insert(sb, "<", 0);
+        vt_strbuilder_insert(sb, ">", vt_strbuilder_len(sb));
+        s = vt_strbuilder_to_str(sb, NULL);
+        assert(vt_str_equals_z(vt_str_z(s), "<hello, big world 42-x>"));
+        vt_str_destroy(s);
+    }
+    vt_strbuilder_destroy(sb);
+    assert(alloctr->stats.count_allocs == alloctr->stats.count_frees);
+
+    // large text spanning many chunks, compared against vt_str_t
+    sb = vt_strbuilder_create(alloctr);
+    vt_str_t *ref = vt_str_create_capacity(1, NULL);
+    {
+        char big[3 * VT_STRBUILDER_CHUNK_SIZE];
+        VT_FOREACH(i, 0, sizeof(big)) big[i] = (char)('a' + i % 26);
+
+        srand(7);
+        VT_FOREACH(i, 0, 2000) {
+            const int32_t op = rand() % 4;
+            if (op == 0) {
+                const size_t n = 1 + (size_t)rand() % 64;
+                vt_strbuilder_append_n(sb, big, n);
+                vt_str_append_n(ref, big, n);
+            } else if (op == 1) {
+                assert(vt_strbuilder_appendf(sb, "%zu;", i) == VT_STATUS_OPERATION_SUCCESS);
+                vt_str_appendf(ref, "%zu;", i);
+            } else if (op == 2 && i % 100 == 0) {
+                vt_strbuilder_append_n(sb, big, sizeof(big));
+                vt_str_append_n(ref, big, sizeof(big));
+            } else {
+                const size_t at = (size_t)rand() % (vt_str_len(ref) + 1);
+                const size_t n = 1 + (size_t)rand() % 16;
+                vt_strbuilder_insert_n(sb, big + i % 26, at, n);
+                if (at < vt_str_len(ref)) vt_str_insert_n(ref, big + i % 26, at, n);
+                else vt_str_append_n(ref, big + i % 26, n);
+            }
+            assert(vt_strbuilder_len(sb) == vt_str_len(ref));
+        }
+        assert(vt_strbuilder_count_chunks(sb) > 1);
+
+        // random access
+        VT_FOREACH(i, 0, 1000) {
+            const size_t at = (size_t)rand() % vt_str_len(ref);
+            assert(vt_strbuilder_get(sb, at) == vt_str_z(ref)[at]);
+        }
+
+        // flatten
+        vt_str_t *s = vt_strbuilder_to_str(sb, NULL);
+        assert(vt_str_equals(s, ref));
+        vt_str_destroy(s);
+
+        // write chunks to a file
+        FILE *fp = tmpfile();
+        assert(fp != NULL);
+        assert(vt_strbuilder_write(sb, fp));
+        assert((size_t)ftell(fp) == vt_str_len(ref));
+        rewind(fp);
+        char *buf = malloc(vt_str_len(ref));
+        assert(fread(buf, 1, vt_str_len(ref), fp) == vt_str_len(ref));
+        assert(!memcmp(buf, vt_str_z(ref), vt_str_len(ref)));
+        free(buf);
+        fclose(fp);
+
+        // clear and reuse
+        vt_strbuilder_clear(sb);
+        assert(vt_strbuilder_len(sb) == 0 && vt_strbuilder_count_chunks(sb) == 0);
+        vt_strbuilder_append(sb, "again");
+        assert(vt_strbuilder_len(sb) == 5);
+    }
+    vt_str_destroy(ref);
+    vt_strbuilder_destroy(sb);
+    assert(alloctr->stats.count_allocs == alloctr->stats.count_frees);
+
+    vt_mallocator_destroy(alloctr);
+    return 0;
+}
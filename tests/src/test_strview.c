@@ -0,0 +1,78 @@
+#include <assert.h>
+#include "vita/container/strview.h"
+
+int32_t main(void) {
+    // create
+    const char *const line = "GET /index.html HTTP/1.1\r\nHost: localhost\r\n\r\n";
+    vt_strview_t sv = vt_strview_from(line, 24);
+    assert(vt_strview_len(sv) == 24);
+    assert(vt_strview_len(vt_strview_from_z(line)) == strlen(line));
+
+    // query a buffer that is not zero-terminated
+    char buf[] = {' ', 'P', 'O', 'S', 'T', ' ', '/', 'a', '/', 'b', ' ', '4', '2', '.', '5', '\r', '\n'};
+    const vt_strview_t req = vt_strview_from(buf, sizeof(buf));
+    assert(!vt_strview_is_empty(req) && vt_strview_is_empty(vt_strview_from(NULL, 0)));
+    assert(vt_strview_get(req, 1) == 'P');
+    const vt_strview_t stripped = vt_strview_strip(req);
+    assert(stripped.ptr == buf + 1 && stripped.len == 14);
+    assert(vt_strview_starts_with(stripped, "POST ") && !vt_strview_starts_with(req, "POST"));
+    assert(vt_strview_ends_with(stripped, "42.5") && !vt_strview_ends_with(stripped, "42.5\r\n"));
+    assert(vt_strview_find(req, "/") == buf + 6 && vt_strview_find_last(req, "/") == buf + 8);
+    assert(vt_strview_find(req, "\n\n") == NULL);
+    assert(vt_strview_can_find(req, "/") == 2 && vt_strview_can_find(req, "x") == 0);
+    assert(vt_strview_index_of(req, 'a') == 7 && vt_strview_index_of(req, 'z') == -1);
+    assert(vt_strview_index_find(req, "/b") == 8 && vt_strview_index_find(req, "/c") == -1);
+    assert(vt_strview_equals_z(vt_strview_slice(req, 1, 5), "POST"));
+    assert(!vt_strview_equals_z(vt_strview_slice(req, 1, 5), "POS"));
+    assert(!vt_strview_equals(vt_strview_slice(req, 6, 8), vt_strview_from_z("/a/b")));
+    assert(vt_strview_equals(vt_strview_slice(req, 6, 10), vt_strview_from_z("/a/b")));
+    assert(vt_strview_is_numeric(vt_strview_slice(req, 11, 15)) && !vt_strview_is_numeric(stripped));
+    assert(!vt_strview_is_numeric(vt_strview_slice(req, 3, 3)));
+
+    vt_str_t *s = vt_str_create("a,b,,c,", NULL);
+    {
+        const vt_strview_t ssv = vt_strview_from_str(s);
+        assert(ssv.ptr == vt_str_z(s) && ssv.len == vt_str_len(s));
+    }
+
+    // lazy split: tokens point into the original data, empty tokens are skipped
+    vt_strview_t token;
+    vt_strview_split_iter_t it = vt_strview_split_iter(sv, " ");
+    assert(vt_strview_split_next(&it, &token) && token.ptr == line && token.len == 3);
+    assert(vt_strview_split_next(&it, &token) && token.ptr == line + 4 && token.len == 11);
+    assert(vt_strview_split_next(&it, &token) && token.ptr == line + 16 && token.len == 8);
+    assert(!vt_strview_split_next(&it, &token));
+    assert(!vt_strview_split_next(&it, &token));
+
+    // the data does not need to be zero-terminated
+    it = vt_strview_split_iter(vt_strview_from(line + 26, 15), ": ");
+    assert(vt_strview_split_next(&it, &token) && vt_str_equals_n(token.ptr, "Host", token.len) && token.len == 4);
+    assert(vt_strview_split_next(&it, &token) && vt_str_equals_n(token.ptr, "localhost", token.len) && token.len == 9);
+    assert(!vt_strview_split_next(&it, &token));
+
+    // no separator or empty data
+    it = vt_strview_split_iter(vt_strview_from_z("abc"), ";");
+    assert(vt_strview_split_next(&it, &token) && token.len == 3);
+    assert(!vt_strview_split_next(&it, &token));
+    it = vt_strview_split_iter(vt_strview_from_z(",,,"), ",");
+    assert(!vt_strview_split_next(&it, &token));
+
+    // split into a vector of views
+    vt_vec_t *v = vt_strview_split(NULL, vt_strview_from_str(s), ",");
+    {
+        assert(vt_vec_len(v) == 3);
+        const vt_strview_t *const tokens = v->ptr;
+        assert(tokens[0].ptr == vt_str_z(s) && tokens[0].len == 1);
+        assert(tokens[1].ptr == vt_str_z(s) + 2 && tokens[1].len == 1);
+        assert(tokens[2].ptr == vt_str_z(s) + 5 && tokens[2].len == 1);
+
+        // reuse the vector
+        vt_strview_split(v, vt_strview_from_z("1 2 3 4 5 6 7 8 9 10 11 12 13 14 15 16 17 18 19 20"), " ");
+        assert(vt_vec_len(v) == 20);
+        assert(((vt_strview_t*)vt_vec_get(v, 19))->len == 2);
+    }
+    vt_vec_destroy(v);
+    vt_str_destroy(s);
+
+    return 0;
+}
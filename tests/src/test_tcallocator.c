@@ -0,0 +1,183 @@
+#include <assert.h>
+#include <time.h>
+#include <pthread.h>
+#include "vita/allocator/tcallocator.h"
+#include "vita/container/vec.h"
+
+#define MAX_THREADS 32
+#define OPS_PER_THREAD 4000
+#define LIVE_BLOCKS 64
+#define HANDOFF_BLOCKS 16
+
+struct ThreadArgs {
+    vt_tcallocator_t *tc;
+    uint8_t id;
+    void **handoff;             // blocks allocated by the main thread to be freed by this thread
+};
+
+static void *worker(void *arg);
+static void *destroyer(void *arg);
+static double now_secs(void);
+
+int32_t main(void) {
+    // more allocators than thread caches: the extra ones go to the pool directly, stats are kept
+    {
+        vt_tcallocator_t *tcs[VT_TCALLOCATOR_THREAD_CACHES + 2] = {0};
+        void *ptrs[VT_TCALLOCATOR_THREAD_CACHES + 2] = {0};
+        const size_t count = sizeof(tcs)/sizeof(tcs[0]);
+        VT_FOREACH(i, 0, count) {
+            tcs[i] = vt_tcallocator_create();
+            ptrs[i] = VT_ALLOCATOR_ALLOC(&tcs[i]->base, 40);
+            ptrs[i] = VT_ALLOCATOR_REALLOC(&tcs[i]->base, ptrs[i], 4000);
+        }
+        VT_FOREACH(i, 0, count) {
+            VT_ALLOCATOR_FREE(&tcs[i]->base, ptrs[i]);
+        }
+        VT_FOREACH(i, 0, count) {
+            vt_tcallocator_flush(tcs[i]);
+        }
+        VT_FOREACH(i, 0, count) {
+            const struct VitaAllocatorStats stats = tcs[i]->base.stats;
+            assert(stats.count_allocs == 1 && stats.count_reallocs == 1 && stats.count_frees == 1);
+            assert(stats.count_objects_live == 0 && stats.count_bytes_allocated == 0);
+            vt_tcallocator_destroy(tcs[i]);
+        }
+    }
+
+    // caches of allocators destroyed by another thread are reused
+    {
+        vt_tcallocator_t *tcs[VT_TCALLOCATOR_THREAD_CACHES] = {0};
+        VT_FOREACH(i, 0, VT_TCALLOCATOR_THREAD_CACHES) {
+            tcs[i] = vt_tcallocator_create();
+            VT_ALLOCATOR_FREE(&tcs[i]->base, VT_ALLOCATOR_ALLOC(&tcs[i]->base, 40));
+        }
+
+        pthread_t thread;
+        const int32_t rc = pthread_create(&thread, NULL, destroyer, tcs);
+        assert(rc == 0);
+        (void)rc;
+        pthread_join(thread, NULL);
+
+        // the free stays in the thread cache until the stats are merged
+        vt_tcallocator_t *tc = vt_tcallocator_create();
+        VT_ALLOCATOR_FREE(&tc->base, VT_ALLOCATOR_ALLOC(&tc->base, 40));
+        assert(tc->base.stats.count_frees == 0);
+        assert(vt_tcallocator_get_stats(tc).count_frees == 1);
+        vt_tcallocator_destroy(tc);
+    }
+
+    const size_t thread_counts[] = { 1, 2, 4, 8, 16, 32 };
+    VT_FOREACH(t, 0, sizeof(thread_counts)/sizeof(thread_counts[0])) {
+        const size_t nthreads = thread_counts[t];
+        vt_tcallocator_t *tc = vt_tcallocator_create();
+
+        // blocks freed by other threads
+        void *handoff[MAX_THREADS][HANDOFF_BLOCKS] = {{0}};
+        VT_FOREACH(i, 0, nthreads) {
+            VT_FOREACH(j, 0, HANDOFF_BLOCKS) {
+                handoff[i][j] = VT_ALLOCATOR_ALLOC(&tc->base, 24 + j * 8);
+            }
+        }
+        vt_tcallocator_flush(tc);
+
+        // run workers
+        pthread_t threads[MAX_THREADS];
+        struct ThreadArgs args[MAX_THREADS];
+        const double start = now_secs();
+        VT_FOREACH(i, 0, nthreads) {
+            args[i] = (struct ThreadArgs) { .tc = tc, .id = (uint8_t)(i + 1), .handoff = handoff[i] };
+            const int32_t rc = pthread_create(&threads[i], NULL, worker, &args[i]);
+            assert(rc == 0);
+            (void)rc;
+        }
+        VT_FOREACH(i, 0, nthreads) {
+            pthread_join(threads[i], NULL);
+        }
+        const double elapsed = now_secs() - start;
+
+        // all threads flushed their caches, stats must balance
+        const struct VitaAllocatorStats stats = vt_tcallocator_get_stats(tc);
+        assert(stats.count_allocs == stats.count_frees);
+        assert(stats.count_bytes_allocated == 0);
+        assert(stats.count_objects_live == 0);
+        assert(stats.count_bytes_peak > 0);
+        assert(stats.count_allocs + stats.count_reallocs >= nthreads * (OPS_PER_THREAD + HANDOFF_BLOCKS));
+
+        printf("threads: %2zu | %10.0f ops/sec\n", nthreads, (double)(nthreads * OPS_PER_THREAD) / elapsed);
+        if (nthreads == MAX_THREADS) {
+            vt_pool_print_stats(stats);
+        }
+
+        vt_tcallocator_destroy(tc);
+    }
+
+    return 0;
+}
+
+static void *worker(void *arg) {
+    struct ThreadArgs *const args = arg;
+    struct VitaBaseAllocatorType *const alloctr = &args->tc->base;
+
+    // free blocks allocated by the main thread
+    VT_FOREACH(j, 0, HANDOFF_BLOCKS) {
+        VT_ALLOCATOR_FREE(alloctr, args->handoff[j]);
+    }
+
+    // keep a window of live blocks, each filled with the thread id
+    uint8_t *live[LIVE_BLOCKS] = {0};
+    size_t live_bytes[LIVE_BLOCKS] = {0};
+    uint32_t rng = args->id;
+    VT_FOREACH(i, 0, OPS_PER_THREAD) {
+        rng = rng * 1664525u + 1013904223u;
+        const size_t slot = (rng >> 8) % LIVE_BLOCKS;
+        const size_t bytes = (i % 512 == 0) ? 8000 : 1 + (rng >> 16) % 600;
+
+        if (live[slot] != NULL) {
+            VT_FOREACH(k, 0, live_bytes[slot]) {
+                assert(live[slot][k] == args->id);
+            }
+            if (i % 3 == 0) {
+                live[slot] = VT_ALLOCATOR_REALLOC(alloctr, live[slot], bytes);
+                memset(live[slot], args->id, bytes);
+                live_bytes[slot] = bytes;
+                continue;
+            }
+            VT_ALLOCATOR_FREE(alloctr, live[slot]);
+        }
+
+        live[slot] = VT_ALLOCATOR_ALLOC(alloctr, bytes);
+        assert(live[slot][bytes - 1] == 0);
+        memset(live[slot], args->id, bytes);
+        live_bytes[slot] = bytes;
+    }
+    VT_FOREACH(i, 0, LIVE_BLOCKS) {
+        if (live[i] != NULL) {
+            VT_ALLOCATOR_FREE(alloctr, live[i]);
+        }
+    }
+
+    // containers can use the allocator from multiple threads
+    vt_vec_t *v = vt_vec_create(4, sizeof(int32_t), alloctr);
+    VT_FOREACH(i, 0, 1000) {
+        vt_vec_push_backi32(v, (int32_t)i);
+    }
+    assert(vt_vec_geti32(v, 999) == 999);
+    vt_vec_destroy(v);
+
+    vt_tcallocator_flush(args->tc);
+    return NULL;
+}
+
+static void *destroyer(void *arg) {
+    vt_tcallocator_t **const tcs = arg;
+    VT_FOREACH(i, 0, VT_TCALLOCATOR_THREAD_CACHES) {
+        vt_tcallocator_destroy(tcs[i]);
+    }
+    return NULL;
+}
+
+static double now_secs(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
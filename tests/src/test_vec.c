@@ -93,6 +93,44 @@ int main(void) {
         assert(vt_vec_capacity(v) == 3);
         assert(vt_vec_has_space(v) == 1);
     } vt_vec_destroy(v);
+
+    // growth policies
+    v = vt_vec_create(10, sizeof(double), alloctr); {
+        vt_vec_resize(v, 10);
+
+        vt_vec_set_growth_policy(v, VT_GROWTH_POLICY_FACTOR_2);
+        vt_vec_push_backd(v, 1);
+        assert(vt_vec_capacity(v) == 20);
+
+        vt_vec_resize(v, 20);
+        vt_vec_set_growth_policy(v, VT_GROWTH_POLICY_FACTOR_1_5);
+        vt_vec_push_backd(v, 1);
+        assert(vt_vec_capacity(v) == 30);
+
+        vt_vec_resize(v, 30);
+        vt_vec_set_growth_policy(v, VT_GROWTH_POLICY_EXACT);
+        vt_vec_push_backd(v, 1);
+        assert(vt_vec_capacity(v) == 31);
+
+        vt_vec_set_growth_policy(v, VT_GROWTH_POLICY_CAPPED);
+        vt_vec_push_backd(v, 1);
+        assert(vt_vec_capacity(v) == 62);
+
+        vt_vec_resize(v, 62);
+        vt_vec_set_growth_policy(v, VT_GROWTH_POLICY_LINEAR);
+        vt_vec_push_backd(v, 1);
+        assert(vt_vec_capacity(v) == 62 + VT_ARRAY_GROWTH_CHUNK_BYTES / sizeof(double));
+        assert(vt_vec_getd(v, 62) == 1);
+    } vt_vec_destroy(v);
+
+    // capped doubling adds at most VT_ARRAY_GROWTH_CAP_BYTES at once
+    v = vt_vec_create(VT_ARRAY_GROWTH_CAP_BYTES, sizeof(char), alloctr); {
+        vt_vec_set_growth_policy(v, VT_GROWTH_POLICY_CAPPED);
+        vt_vec_resize(v, VT_ARRAY_GROWTH_CAP_BYTES);
+        assert(vt_array_growth(v, 1) == VT_ARRAY_GROWTH_CAP_BYTES);
+        vt_vec_resize(v, 2 * VT_ARRAY_GROWTH_CAP_BYTES);
+        assert(vt_array_growth(v, 1) == VT_ARRAY_GROWTH_CAP_BYTES);
+    } vt_vec_destroy(v);
     
     size_t w = 5, h = 5;
     vt_vec_t *vecmat = vt_vec_create(w*h, sizeof(int32_t), alloctr); {